@@ -142,6 +142,8 @@ LOCAL_SRC_FILES := \
         src/armnn/Network.cpp \
         src/armnn/NetworkUtils.cpp \
         src/armnn/WallClockTimer.cpp \
+        src/armnn/WorkingMemHandle.cpp \
+        src/armnn/WorkloadScheduler.cpp \
         src/armnn/ProfilingEvent.cpp \
         src/armnn/Profiling.cpp \
         src/armnn/JsonPrinter.cpp \
@@ -239,6 +241,7 @@ LOCAL_SRC_FILES := \
         src/armnn/test/UnitTests.cpp \
         src/armnn/test/EndToEndTest.cpp \
         src/armnn/test/UtilsTests.cpp \
+        src/armnn/test/WorkloadSchedulerTests.cpp \
         src/armnn/test/GraphTests.cpp \
         src/armnn/test/GraphUtils.cpp \
         src/armnn/test/RuntimeTests.cpp \
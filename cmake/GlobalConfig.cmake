@@ -3,6 +3,7 @@ option(BUILD_TF_PARSER "Build Tensorflow parser" OFF)
 option(BUILD_ONNX_PARSER "Build Onnx parser" OFF)
 option(BUILD_UNIT_TESTS "Build unit tests" ON)
 option(BUILD_TESTS "Build test applications" OFF)
+option(BUILD_BENCHMARKS "Build microbenchmarks of the backend workloads (requires Google Benchmark)" OFF)
 option(BUILD_FOR_COVERAGE "Use no optimization and output .gcno and .gcda files" OFF)
 option(ARMCOMPUTENEON "Build with ARM Compute NEON support" OFF)
 option(ARMCOMPUTECL "Build with ARM Compute OpenCL support" OFF)
@@ -113,6 +114,11 @@ link_directories(${Boost_LIBRARY_DIR})
 # pthread
 find_package (Threads)
 
+# Google Benchmark
+if(BUILD_BENCHMARKS)
+    find_package(benchmark REQUIRED)
+endif()
+
 # Favour the protobuf passed on command line
 if(BUILD_TF_PARSER OR BUILD_CAFFE_PARSER OR BUILD_ONNX_PARSER)
     find_library(PROTOBUF_LIBRARY_DEBUG NAMES "protobufd"
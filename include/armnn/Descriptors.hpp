@@ -527,6 +527,7 @@ struct LstmDescriptor
     , m_CifgEnabled(true)
     , m_PeepholeEnabled(false)
     , m_ProjectionEnabled(false)
+    , m_StatefulSequence(false)
     {}
 
     /// @brief The activation function to use.
@@ -542,6 +543,13 @@ struct LstmDescriptor
     bool m_PeepholeEnabled;
     /// Enable/disable the projection layer.
     bool m_ProjectionEnabled;
+    /// Enable/disable stateful sequence execution. When enabled the input is a [time, batch, input_size] sequence,
+    /// iterated over in one execution, and the output is [time, batch, output_size]. The output and cell states are
+    /// kept by the backend from one execution to the next, separately for each working memory handle, starting from
+    /// the output state and cell state inputs, which are read again once the state is reset (see
+    /// IRuntime::ResetNetworkState() and IWorkingMemHandle::ResetState()). The batch size of such a network cannot
+    /// change (see IRuntime::CreationOptions::m_EnableDynamicBatch).
+    bool m_StatefulSequence;
 };
 
 /// A MeanDescriptor for the MeanLayer.
@@ -4,6 +4,7 @@
 //
 #pragma once
 
+#include <armnn/BackendId.hpp>
 #include <armnn/DescriptorsFwd.hpp>
 #include <armnn/ILayerVisitor.hpp>
 #include <armnn/NetworkFwd.hpp>
@@ -74,6 +75,11 @@ public:
 
     virtual LayerGuid GetGuid() const = 0;
 
+    /// The backend the layer runs on. It is only meaningful in optimized networks and in the networks exported from
+    /// them, see IOptimizedNetwork::ExportNetwork().
+    virtual const BackendId& GetBackendId() const = 0;
+    virtual void SetBackendId(const BackendId& id) = 0;
+
     virtual void Accept(ILayerVisitor& visitor) const = 0;
 protected:
       /// Objects are not deletable via the handle
@@ -406,6 +412,13 @@ public:
 
     virtual void Accept(ILayerVisitor& visitor) const = 0;
 
+    /// Lets the layers added afterwards reference, instead of copying, the constant tensors that lie in the given
+    /// memory region. The region is kept alive by the network, and by the networks optimized from it, for as long as
+    /// they use it, and must not be modified.
+    /// @param memory - Start of the region, owned by the shared pointer.
+    /// @param numBytes - Size of the region.
+    virtual void AddConstantMemory(std::shared_ptr<const void> memory, size_t numBytes) = 0;
+
 protected:
     ~INetwork() {}
 };
@@ -420,6 +433,18 @@ public:
     virtual Status PrintGraph() = 0;
     virtual Status SerializeToDot(std::ostream& stream) const = 0;
 
+    /// Returns a network holding the optimized layers, with the backends they are assigned to and their tensor infos,
+    /// but without the layers copying tensors between backends or debugging them. Serializing it lets the network be
+    /// loaded again without being optimized, see ImportOptimizedNetwork().
+    /// The constant tensors are exported in their original layout. Backends that rearrange them for their kernels,
+    /// such as the reference convolution and fully connected workloads, still do so when the network is loaded.
+    /// Throws an InvalidArgumentException if the network was optimized with m_ReduceFp32ToFp16.
+    virtual INetworkPtr ExportNetwork() const = 0;
+
+    /// Returns the predicted peak number of bytes held by the tensors of the network when it runs in its execution
+    /// order: the constants, and the other tensors from the layer producing them to their last reader. Backends
+    /// reusing or aliasing buffers may need less.
+    virtual size_t GetPeakTensorBytes() const = 0;
 
 protected:
     ~IOptimizedNetwork() {}
@@ -430,11 +455,13 @@ struct OptimizerOptions
     OptimizerOptions()
         : m_ReduceFp32ToFp16(false)
         , m_Debug(false)
+        , m_MinimizePeakMemory(false)
     {}
 
-    OptimizerOptions(bool reduceFp32ToFp16, bool debug)
+    OptimizerOptions(bool reduceFp32ToFp16, bool debug, bool minimizePeakMemory = false)
         : m_ReduceFp32ToFp16(reduceFp32ToFp16)
         , m_Debug(debug)
+        , m_MinimizePeakMemory(minimizePeakMemory)
     {}
 
     // Reduce Fp32 data to Fp16 for faster processing
@@ -442,6 +469,9 @@ struct OptimizerOptions
 
     // Add debug data for easier troubleshooting
     bool m_Debug;
+
+    // Execute the layers in an order keeping few tensor bytes alive at once, rather than by depth
+    bool m_MinimizePeakMemory;
 };
 
 /// Create an optimized version of the network
@@ -458,4 +488,16 @@ IOptimizedNetworkPtr Optimize(const INetwork& network,
                               const IDeviceSpec& deviceSpec,
                               const OptimizerOptions& options = OptimizerOptions(),
                               Optional<std::vector<std::string>&> errMessages = EmptyOptional());
+
+/// Create an optimized network from a network already optimized and assigned to backends, as returned by
+/// IOptimizedNetwork::ExportNetwork(). The optimization passes and the backend assignment are skipped: only the layers
+/// copying tensors between backends and the backend-specific optimizations are added again.
+/// @param network INetwork description of the optimized network, every layer having a backend.
+/// @param deviceSpec DeviceSpec object as queried from the runtime. See IRuntime::GetDeviceSpec()
+/// @param errMessages if there are failures a string describing same will be added to the vector
+/// @return An IOptimizedNetworkPtr interface to the optimized network, or nullptr if a layer is not assigned to a
+/// backend supported by the device.
+IOptimizedNetworkPtr ImportOptimizedNetwork(const INetwork& network,
+                                            const IDeviceSpec& deviceSpec,
+                                            Optional<std::vector<std::string>&> errMessages = EmptyOptional());
 } //namespace armnn
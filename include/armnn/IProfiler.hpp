@@ -6,10 +6,24 @@
 #pragma once
 
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace armnn
 {
 
+/// Timing statistics of the profiling events sharing the same name, see IProfiler::GetEventStatistics().
+struct EventStatistics
+{
+    std::string  m_Name;
+    unsigned int m_Count;
+    double       m_MeanMs;
+    double       m_MinMs;
+    double       m_MaxMs;
+    double       m_P50Ms;
+    double       m_P99Ms;
+};
+
 class IProfiler
 {
 public:
@@ -31,6 +45,24 @@ public:
     /// @param [out] outStream The stream where to write the profiling results to.
     virtual void Print(std::ostream& outStream) const = 0;
 
+    /// Writes the recorded events in the Chrome Trace Event format, which can be loaded into chrome://tracing or
+    /// Perfetto to view them as a timeline. Events are shown on the thread they ran on, with their backend as category
+    /// and their other measurements (e.g. kernel timings) as arguments. Backends are not recorded in ring buffer mode.
+    /// @param [out] outStream The stream where to write the trace to.
+    virtual void WriteChromeTrace(std::ostream& outStream) const = 0;
+
+    /// Switches this profiler to recording events in a bounded ring buffer, so profiling can be kept enabled in
+    /// production. Only the wall clock time of each event is recorded, as a compact record that needs no allocation,
+    /// and only the most recent events are kept. The detailed reports are not available in this mode,
+    /// use GetEventStatistics() instead. Must not be called while workloads are being executed.
+    /// @param [in] capacity Number of events kept (rounded up to a power of two), or 0 to go back to the default
+    ///                      mode, which records all the events with their full details.
+    virtual void EnableRingBufferProfiling(unsigned int capacity) = 0;
+
+    /// Aggregates the durations of the recorded events per event name, in either mode.
+    /// @return The statistics of each event name, sorted by name.
+    virtual std::vector<EventStatistics> GetEventStatistics() const = 0;
+
 protected:
     ~IProfiler() {}
 };
@@ -7,17 +7,18 @@
 
 #include "INetwork.hpp"
 #include "IProfiler.hpp"
+#include "IWorkingMemHandle.hpp"
 #include "Tensor.hpp"
 #include "Types.hpp"
 #include "TypesUtils.hpp"
 
+#include <future>
 #include <memory>
+#include <vector>
 
 namespace armnn
 {
 
-using NetworkId = int;
-
 class IGpuAccTunedParameters;
 
 class IRuntime;
@@ -31,6 +32,12 @@ public:
         CreationOptions()
             : m_GpuAccTunedParameters(nullptr)
             , m_EnableGpuProfiling(false)
+            , m_NumThreads(1)
+            , m_EnableInterOpParallelism(false)
+            , m_EnableDynamicBatch(false)
+            , m_MaxBatchSize(1)
+            , m_BatchTimeoutUs(1000)
+            , m_NumAsyncThreads(1)
         {}
 
         /// If set, uses the GpuAcc tuned parameters from the given object when executing GPU workloads.
@@ -39,6 +46,40 @@ public:
 
         // Setting this flag will allow the user to obtain GPU profiling information from the runtime.
         bool m_EnableGpuProfiling;
+
+        /// Number of threads the CpuRef backend may use to run a single workload, including the thread executing
+        /// the network. 0 uses one per hardware thread. The threads are shared by all the networks of the runtime.
+        unsigned int m_NumThreads;
+
+        /// Processors the threads added by m_NumThreads are pinned to, in turn. Empty leaves them unpinned.
+        std::vector<unsigned int> m_CpuAffinity;
+
+        /// If set, the workloads of independent branches of a network run concurrently on the threads added by
+        /// m_NumThreads, which lowers the latency of a single inference of branchy networks. The intermediate tensors
+        /// of concurrent branches cannot share memory, so such networks use more of it.
+        bool m_EnableInterOpParallelism;
+
+        /// If set, EnqueueWorkload() accepts input tensors whose first dimension, the batch, differs from the one the
+        /// network was optimized for, all the other dimensions being the same. The network is prepared again for each
+        /// new batch size on first use, sharing its weights with the original, and the 8 most recently used batch
+        /// sizes are kept for later calls, so several requests can be coalesced into one call.
+        /// Tensors bound with ImportInputs() or ImportOutputs(), and Execute(), are limited to the original batch size.
+        /// Requests for other batch sizes throw InvalidArgumentException when the network cannot be prepared for them,
+        /// as happens when it holds an LSTM layer with LstmDescriptor::m_StatefulSequence set.
+        bool m_EnableDynamicBatch;
+
+        /// Largest batch EnqueueWorkloadAsync() coalesces requests into. Requests for the same network whose tensors
+        /// only differ by their batch size are evaluated together, on the concatenation of their tensors along the
+        /// first dimension. Ignored unless m_EnableDynamicBatch is set. 1 evaluates each request on its own.
+        unsigned int m_MaxBatchSize;
+
+        /// How long, in microseconds, the oldest request of a batch may wait for others to join it.
+        unsigned int m_BatchTimeoutUs;
+
+        /// Number of threads evaluating the requests queued by EnqueueWorkloadAsync(). Requests are still started in
+        /// submission order, but with more than one thread those for different networks, or for networks that allow
+        /// concurrent execution, may overlap and complete out of order.
+        unsigned int m_NumAsyncThreads;
     };
 
     static IRuntime* CreateRaw(const CreationOptions& options);
@@ -62,6 +103,16 @@ public:
                                IOptimizedNetworkPtr network,
                                std::string & errorMessage) = 0;
 
+    /// Load a network exported from an optimized network into the IRuntime, without optimizing it again.
+    /// See IOptimizedNetwork::ExportNetwork() and ImportOptimizedNetwork().
+    /// @param [out] networkIdOut Unique identifier for the network is returned in this reference.
+    /// @param [in] network Exported network, every layer having a backend supported by the runtime.
+    /// @param [out] errorMessage Error message if there were any errors.
+    /// @return armnn::Status
+    virtual Status LoadNetwork(NetworkId& networkIdOut,
+                               const INetwork& network,
+                               std::string & errorMessage) = 0;
+
     virtual TensorInfo GetInputTensorInfo(NetworkId networkId, LayerBindingId layerId) const = 0;
     virtual TensorInfo GetOutputTensorInfo(NetworkId networkId, LayerBindingId layerId) const = 0;
 
@@ -70,6 +121,67 @@ public:
                                    const InputTensors& inputTensors,
                                    const OutputTensors& outputTensors) = 0;
 
+    /// Queues the evaluation of a network, as done by EnqueueWorkload(), and returns immediately. Requests are started
+    /// in order by threads of the runtime (see CreationOptions::m_NumAsyncThreads), consecutive ones possibly batched
+    /// together (see CreationOptions::m_MaxBatchSize).
+    /// The tensor memory must stay valid, and the network loaded, until the evaluation has completed.
+    /// @return A future holding the status of the evaluation once it has completed.
+    virtual std::future<Status> EnqueueWorkloadAsync(NetworkId networkId,
+                                                     const InputTensors& inputTensors,
+                                                     const OutputTensors& outputTensors) = 0;
+
+    /// Same as above, calling the given function once the evaluation has completed instead. The function is called on
+    /// a thread evaluating the requests, so it must not block. Exceptions it throws are logged and otherwise ignored.
+    virtual void EnqueueWorkloadAsync(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors,
+                                      const CompletionCallbackFunction& callback) = 0;
+
+    /// Binds caller-owned input buffers to a loaded network once, so that later calls to EnqueueWorkload() given
+    /// the returned ids neither wrap nor validate them again. Where the backend allows it the network reads the
+    /// buffers in place, otherwise they are copied in by workloads created here rather than on every call.
+    /// The buffers must stay valid until the ids are passed to ClearImportedInputs() or the network is unloaded.
+    /// @param [in] networkId - Unique identifier of a loaded network. Generated in LoadNetwork().
+    /// @param [in] inputTensors - Buffers to bind, each with the binding id of the input it feeds.
+    /// @return One id per entry of inputTensors, in the same order.
+    virtual std::vector<ImportedInputId> ImportInputs(NetworkId networkId, const InputTensors& inputTensors) = 0;
+
+    /// Binds caller-owned output buffers to a loaded network once. Where the backend allows it the layer producing
+    /// an output writes directly into the buffer. See ImportInputs().
+    virtual std::vector<ImportedOutputId> ImportOutputs(NetworkId networkId, const OutputTensors& outputTensors) = 0;
+
+    /// Releases input buffers bound with ImportInputs(). Their ids become invalid.
+    virtual void ClearImportedInputs(NetworkId networkId, const std::vector<ImportedInputId>& inputIds) = 0;
+
+    /// Releases output buffers bound with ImportOutputs(). Their ids become invalid.
+    virtual void ClearImportedOutputs(NetworkId networkId, const std::vector<ImportedOutputId>& outputIds) = 0;
+
+    /// Evaluates a network using the given tensors together with previously imported inputs and outputs.
+    /// Every input of the network must be provided exactly once, either in inputTensors or in preImportedInputIds.
+    virtual Status EnqueueWorkload(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors,
+                                   const std::vector<ImportedInputId>& preImportedInputIds,
+                                   const std::vector<ImportedOutputId>& preImportedOutputIds) = 0;
+
+    /// Creates a working memory handle for the given network. A handle owns the intermediate tensors of one
+    /// execution context, while constant tensors and weights stay shared with the loaded network, so the same
+    /// network can be evaluated concurrently by calling Execute() from several threads with different handles.
+    /// The handle must be destroyed before the network is unloaded.
+    /// @param [in] networkId - Unique identifier of a loaded network. Generated in LoadNetwork().
+    /// @return A handle whose memory is allocated on first use.
+    virtual std::unique_ptr<IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId) = 0;
+
+    /// Evaluates the network the handle was created for, using the handle's working memory. Calls with different
+    /// handles may run in parallel; calls with the same handle are serialised.
+    /// @param [in] workingMemHandle - Handle created by CreateWorkingMemHandle().
+    /// @param [in] inputTensors - Network inputs.
+    /// @param [in] outputTensors - Network outputs, filled in by the call.
+    /// @return armnn::Status
+    virtual Status Execute(IWorkingMemHandle& workingMemHandle,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors) = 0;
+
     /// Unloads a network from the IRuntime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -89,6 +201,13 @@ public:
     /// @param func callback function to pass to the debug layer.
     virtual void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func) = 0;
 
+    /// Discards the state a network carries from one evaluation to the next, such as the output and cell states of
+    /// LSTM layers with LstmDescriptor::m_StatefulSequence set. Their next evaluation starts again from their state
+    /// inputs. Must not be called while the network is being evaluated. Only the state of the evaluations by
+    /// EnqueueWorkload() is reset: each working memory handle keeps its own (see IWorkingMemHandle::ResetState()).
+    /// @param networkId The id of the network whose state is reset.
+    virtual void ResetNetworkState(NetworkId networkId) = 0;
+
 protected:
     ~IRuntime() {}
 };
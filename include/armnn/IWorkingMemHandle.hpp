@@ -0,0 +1,36 @@
+﻿//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Types.hpp"
+
+namespace armnn
+{
+
+/// Working memory of one execution context of a loaded network (see IRuntime::CreateWorkingMemHandle).
+class IWorkingMemHandle
+{
+public:
+    virtual ~IWorkingMemHandle() {}
+
+    /// Returns the identifier of the network this handle was created for.
+    virtual NetworkId GetNetworkId() const = 0;
+
+    /// Allocates the memory backing the intermediate tensors. Done automatically by IRuntime::Execute().
+    virtual void Allocate() = 0;
+
+    /// Releases the memory backing the intermediate tensors. It is allocated again when next needed.
+    virtual void Free() = 0;
+
+    /// Returns true if the memory backing the intermediate tensors is currently allocated.
+    virtual bool IsAllocated() const = 0;
+
+    /// Discards the state the network carries from one execution with this handle to the next, such as the output
+    /// and cell states of LSTM layers with LstmDescriptor::m_StatefulSequence set. The state of other handles is
+    /// left as it is. Must not be called while the handle is in use.
+    virtual void ResetState() = 0;
+};
+
+} // namespace armnn
@@ -123,6 +123,15 @@ protected:
 /// Type of identifiers for bindable layers (inputs, outputs).
 using LayerBindingId = int;
 
+/// Type of identifiers for networks loaded into an IRuntime.
+using NetworkId = int;
+
+/// Type of identifiers for input buffers bound to a loaded network with IRuntime::ImportInputs().
+using ImportedInputId = unsigned int;
+
+/// Type of identifiers for output buffers bound to a loaded network with IRuntime::ImportOutputs().
+using ImportedOutputId = unsigned int;
+
 class PermutationVector
 {
 public:
@@ -189,4 +198,8 @@ class ITensorHandle;
 /// @param tensorHandle - TensorHandle for the input tensor to the Debug layer
 using DebugCallbackFunction = std::function<void(LayerGuid guid, unsigned int slotIndex, ITensorHandle* tensorHandle)>;
 
+/// Define the type of callback for the completion of IRuntime::EnqueueWorkloadAsync().
+/// @param status - Status the evaluation would have returned had it been synchronous
+using CompletionCallbackFunction = std::function<void(Status status)>;
+
 } // namespace armnn
@@ -37,6 +37,10 @@ public:
     /// Create an input network from a binary input stream
     virtual armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent) = 0;
 
+    /// Create an input network from a binary file, which is mapped into memory rather than read. The constant
+    /// tensors of the network reference the mapped file, which stays mapped for as long as they are used.
+    virtual armnn::INetworkPtr CreateNetworkFromFile(const char* graphFile) = 0;
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by
     /// the given layer name and layers id
     virtual BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId,
@@ -22,6 +22,8 @@ public:
     static void Destroy(ISerializer* serializer);
 
     /// Serializes the network to ArmNN SerializedGraph.
+    /// The backends of the layers of a network exported with IOptimizedNetwork::ExportNetwork() are serialized too,
+    /// so that the deserialized network can be passed to IRuntime::LoadNetwork() without being optimized again.
     /// @param [in] inNetwork The network to be serialized.
     virtual void Serialize(const armnn::INetwork& inNetwork) = 0;
 
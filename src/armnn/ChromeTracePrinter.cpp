@@ -0,0 +1,94 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ChromeTracePrinter.hpp"
+
+#include <iomanip>
+
+namespace armnn
+{
+
+void ChromeTracePrinter::PrintHeader()
+{
+    m_OutputStream << "{" << std::endl;
+    m_OutputStream << "\t\"displayTimeUnit\": \"ms\"," << std::endl;
+    m_OutputStream << "\t\"traceEvents\": [";
+    m_NumEvents = 0;
+}
+
+void ChromeTracePrinter::PrintFooter()
+{
+    m_OutputStream << std::endl << "\t]" << std::endl;
+    m_OutputStream << "}" << std::endl;
+}
+
+void ChromeTracePrinter::PrintEvent(const std::string& name,
+                                    const std::string& category,
+                                    uint32_t threadId,
+                                    double startUs,
+                                    double durationUs,
+                                    const std::vector<Measurement>& measurements)
+{
+    m_OutputStream << (m_NumEvents++ == 0 ? "" : ",") << std::endl;
+    m_OutputStream << "\t\t{ \"name\": ";
+    PrintString(name);
+    m_OutputStream << ", \"cat\": ";
+    PrintString(category);
+    m_OutputStream << ", \"ph\": \"X\", \"pid\": 0, \"tid\": " << threadId
+                   << ", \"ts\": " << startUs
+                   << ", \"dur\": " << durationUs;
+
+    if (!measurements.empty())
+    {
+        m_OutputStream << ", \"args\": { ";
+        for (unsigned int i = 0; i < measurements.size(); ++i)
+        {
+            const Measurement& measurement = measurements[i];
+            m_OutputStream << (i == 0 ? "" : ", ");
+            PrintString(measurement.m_Name + " (" + Measurement::ToString(measurement.m_Unit) + ")");
+            m_OutputStream << ": " << measurement.m_Value;
+        }
+        m_OutputStream << " }";
+    }
+    m_OutputStream << " }";
+}
+
+double ChromeTracePrinter::ToMicroseconds(const Measurement& measurement)
+{
+    switch (measurement.m_Unit)
+    {
+        case Measurement::Unit::TIME_NS: return measurement.m_Value / 1000.0;
+        case Measurement::Unit::TIME_MS: return measurement.m_Value * 1000.0;
+        default:                         return measurement.m_Value;
+    }
+}
+
+void ChromeTracePrinter::PrintString(const std::string& string)
+{
+    m_OutputStream << "\"";
+    for (char c : string)
+    {
+        switch (c)
+        {
+            case '"':  m_OutputStream << "\\\""; break;
+            case '\\': m_OutputStream << "\\\\"; break;
+            case '\n': m_OutputStream << "\\n"; break;
+            case '\t': m_OutputStream << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    m_OutputStream << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                                   << static_cast<unsigned int>(c) << std::dec << std::setfill(' ');
+                }
+                else
+                {
+                    m_OutputStream << c;
+                }
+        }
+    }
+    m_OutputStream << "\"";
+}
+
+} // namespace armnn
@@ -0,0 +1,49 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Instrument.hpp"
+
+namespace armnn
+{
+
+// Writes profiling events in the Chrome Trace Event format, as a JSON object holding a list of complete events,
+// which timeline viewers such as chrome://tracing or Perfetto can load.
+class ChromeTracePrinter
+{
+public:
+    ChromeTracePrinter(std::ostream& outputStream)
+        : m_OutputStream(outputStream), m_NumEvents(0)
+    {}
+
+    void PrintHeader();
+    void PrintFooter();
+
+    // Prints an event of the given thread, starting and lasting for the given times in microseconds.
+    // The category is usually the backend the event ran on, and the measurements are shown as the event's arguments.
+    void PrintEvent(const std::string& name,
+                    const std::string& category,
+                    uint32_t threadId,
+                    double startUs,
+                    double durationUs,
+                    const std::vector<Measurement>& measurements);
+
+    // Converts the value of a time measurement to microseconds.
+    static double ToMicroseconds(const Measurement& measurement);
+
+private:
+    void PrintString(const std::string& string);
+
+    std::ostream& m_OutputStream;
+    unsigned int m_NumEvents;
+};
+
+} // namespace armnn
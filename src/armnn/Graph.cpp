@@ -15,6 +15,7 @@
 #include <boost/assert.hpp>
 #include <boost/format.hpp>
 
+#include <algorithm>
 #include <unordered_map>
 #include <DotSerializer.hpp>
 #include <sstream>
@@ -136,7 +137,7 @@ Status Graph::SerializeToDot(std::ostream& stream)
     return Status::Success;
 }
 
-Status Graph::AllocateDynamicBuffers()
+Status Graph::AllocateDynamicBuffers(bool layersRunInOrder)
 {
     // Layers must be sorted in topological order
     BOOST_ASSERT(m_LayersInOrder);
@@ -144,6 +145,12 @@ Status Graph::AllocateDynamicBuffers()
     std::unordered_set<const ITensorHandle*> preallocatedTensors;
     std::unordered_map<const ITensorHandle*, unsigned int> handleReferenceCounts;
 
+    // The lifetime of a tensor handle ends before the layer at the latest completion position of its readers. The
+    // last entry holds the tensor handles living until the end.
+    const std::vector<size_t> completionPositions = GetCompletionPositions(layersRunInOrder);
+    std::unordered_map<const ITensorHandle*, size_t> releasePositions;
+    std::vector<std::vector<ITensorHandle*>> tensorsToRelease(m_Layers.size() + 1);
+
     // Finds the first TensorHandle ancestor of a SubTensorHandle. If the ITensorHandle provided
     // is a TensorHandle, the function just returns it
     auto TraceSubTensorHandleAncestry = [](ITensorHandle* const subTensorHandle)
@@ -182,8 +189,14 @@ Status Graph::AllocateDynamicBuffers()
     }
 
     // Iterate over the network in topological order
+    size_t position = 0;
     for (auto&& layer : m_Layers)
     {
+        for (ITensorHandle* tensorHandle : tensorsToRelease[position])
+        {
+            tensorHandle->Allocate();
+        }
+
         // Count the amount of times each output slot references a certain buffer (ITensorHandle).
         // The first time we encounter a new tensor handle, we start managing its lifetime.
         for (auto&& slot = layer->BeginOutputSlots(); slot != layer->EndOutputSlots(); ++slot)
@@ -216,19 +229,120 @@ Status Graph::AllocateDynamicBuffers()
             {
                 --handleReferenceCounts[tensorHandle];
 
+                size_t& releasePosition = releasePositions[tensorHandle];
+                releasePosition = std::max(releasePosition, completionPositions[position]);
+
                 if (handleReferenceCounts[tensorHandle] == 0u)
                 {
-                    // Stop managing lifetime of tensor handle
-                    tensorHandle->Allocate();
+                    // Stop managing lifetime of tensor handle once all of its readers are certain to have completed.
+                    tensorsToRelease[releasePosition].push_back(tensorHandle);
                     handleReferenceCounts.erase(tensorHandle);
+                    releasePositions.erase(tensorHandle);
                 }
             }
         }
+        ++position;
+    }
+
+    for (ITensorHandle* tensorHandle : tensorsToRelease.back())
+    {
+        tensorHandle->Allocate();
     }
 
     return Status::Success;
 }
 
+std::vector<size_t> Graph::GetCompletionPositions(bool layersRunInOrder) const
+{
+    // Layers must be sorted in topological order
+    BOOST_ASSERT(m_LayersInOrder);
+
+    const size_t numLayers = m_Layers.size();
+    std::vector<size_t> completionPositions(numLayers);
+    if (layersRunInOrder)
+    {
+        for (size_t i = 0; i < numLayers; ++i)
+        {
+            completionPositions[i] = i + 1;
+        }
+        return completionPositions;
+    }
+
+    const std::vector<const Layer*> layers(m_Layers.begin(), m_Layers.end());
+    std::unordered_map<const Layer*, size_t> layerPositions;
+    for (size_t i = 0; i < numLayers; ++i)
+    {
+        layerPositions.emplace(layers[i], i);
+    }
+
+    // Constant layers may run at any time and output layers run after all others, so neither bounds a completion.
+    auto IsOrdered = [](const Layer& layer)
+    {
+        return layer.GetType() != LayerType::Constant && layer.GetType() != LayerType::Output;
+    };
+
+    // Whether a layer runs after another, earlier one: searches back through its inputs for the other layer, only
+    // over the layers in between since the earlier ones cannot read from it. Layers already found to run after the
+    // other one end the search early.
+    std::vector<size_t> visitedBySearch(numLayers, 0);
+    std::vector<size_t> runsAfterLayer(numLayers, numLayers);
+    std::vector<size_t> toVisit;
+    size_t search = 0;
+    auto RunsAfter = [&](size_t layer, size_t other)
+    {
+        ++search;
+        toVisit.assign(1, layer);
+        while (!toVisit.empty())
+        {
+            const Layer& current = *layers[toVisit.back()];
+            toVisit.pop_back();
+            for (auto&& inputSlot : current.GetInputSlots())
+            {
+                const OutputSlot* source = inputSlot.GetConnectedOutputSlot();
+                if (!source)
+                {
+                    continue;
+                }
+                const size_t sourcePosition = layerPositions.at(&source->GetOwningLayer());
+                if (sourcePosition == other || runsAfterLayer[sourcePosition] == other)
+                {
+                    runsAfterLayer[layer] = other;
+                    return true;
+                }
+                if (sourcePosition > other && visitedBySearch[sourcePosition] != search)
+                {
+                    visitedBySearch[sourcePosition] = search;
+                    toVisit.push_back(sourcePosition);
+                }
+            }
+        }
+        return false;
+    };
+
+    // Everything from the completion position of a reader on runs after the layer too, so only the layers before
+    // the earliest of them are searched, from the last one backwards. In a chain of layers no search is needed.
+    for (size_t i = numLayers; i-- > 0;)
+    {
+        size_t completionPosition = numLayers;
+        for (auto&& outputSlot : layers[i]->GetOutputSlots())
+        {
+            for (auto&& connection : outputSlot.GetConnections())
+            {
+                const size_t reader = layerPositions.at(&connection->GetOwningLayer());
+                completionPosition = std::min(completionPosition, completionPositions[reader]);
+            }
+        }
+
+        while (completionPosition > i + 1 &&
+               (!IsOrdered(*layers[completionPosition - 1]) || RunsAfter(completionPosition - 1, i)))
+        {
+            --completionPosition;
+        }
+        completionPositions[i] = completionPosition;
+    }
+    return completionPositions;
+}
+
 const Graph& Graph::TopologicalSort() const
 {
     if (!m_LayersInOrder)
@@ -252,6 +366,172 @@ const Graph& Graph::TopologicalSort() const
     return *this;
 }
 
+namespace
+{
+
+// Bytes of the output tensors of a layer which live from the layer to their last reader.
+size_t GetTransientOutputBytes(const Layer& layer)
+{
+    if (layer.GetType() == LayerType::Constant)
+    {
+        return 0;
+    }
+
+    size_t numBytes = 0;
+    for (auto&& outputSlot : layer.GetOutputSlots())
+    {
+        numBytes += outputSlot.GetTensorInfo().GetNumBytes();
+    }
+    return numBytes;
+}
+
+// Bytes of the input tensors which running the layer releases, given the number of readers each tensor has left.
+size_t GetReleasedInputBytes(const Layer& layer,
+                             const std::unordered_map<const OutputSlot*, unsigned int>& remainingReaders)
+{
+    std::unordered_map<const OutputSlot*, unsigned int> numReads;
+    for (auto&& inputSlot : layer.GetInputSlots())
+    {
+        ++numReads[inputSlot.GetConnectedOutputSlot()];
+    }
+
+    size_t numBytes = 0;
+    for (auto&& read : numReads)
+    {
+        if (read.first->GetOwningLayer().GetType() != LayerType::Constant &&
+            remainingReaders.at(read.first) == read.second)
+        {
+            numBytes += read.first->GetTensorInfo().GetNumBytes();
+        }
+    }
+    return numBytes;
+}
+
+} // anonymous namespace
+
+size_t Graph::MemoryAwareTopologicalSort()
+{
+    TopologicalSort();
+
+    std::unordered_map<const Layer*, size_t> depthRanks;
+    std::unordered_map<const Layer*, unsigned int> remainingInputs;
+    std::unordered_map<const OutputSlot*, unsigned int> remainingReaders;
+    std::vector<const Layer*> readyLayers;
+    for (auto&& layer : m_Layers)
+    {
+        depthRanks.emplace(layer, depthRanks.size());
+        remainingInputs.emplace(layer, layer->GetNumInputSlots());
+        for (auto&& outputSlot : layer->GetOutputSlots())
+        {
+            remainingReaders.emplace(&outputSlot, outputSlot.GetNumConnections());
+        }
+        if (layer->GetNumInputSlots() == 0 && layer->GetType() != LayerType::Input)
+        {
+            readyLayers.push_back(layer);
+        }
+    }
+
+    // The inputs keep coming first and the outputs last. In between, runs the ready layer which grows the live tensors
+    // the least, the shallowest one among equals so that the depth order is kept when it makes no difference.
+    std::unordered_map<const Layer*, size_t> ranks;
+    auto schedule = [&](const Layer* layer)
+    {
+        ranks.emplace(layer, ranks.size());
+        for (auto&& inputSlot : layer->GetInputSlots())
+        {
+            --remainingReaders.at(inputSlot.GetConnectedOutputSlot());
+        }
+        for (auto&& outputSlot : layer->GetOutputSlots())
+        {
+            for (auto&& connection : outputSlot.GetConnections())
+            {
+                const Layer& reader = connection->GetOwningLayer();
+                if (--remainingInputs.at(&reader) == 0 && reader.GetType() != LayerType::Output)
+                {
+                    readyLayers.push_back(&reader);
+                }
+            }
+        }
+    };
+
+    for (auto&& inputLayer : GetInputLayers())
+    {
+        schedule(inputLayer);
+    }
+
+    while (!readyLayers.empty())
+    {
+        auto growth = [&remainingReaders](const Layer* layer)
+        {
+            return static_cast<long long>(GetTransientOutputBytes(*layer)) -
+                   static_cast<long long>(GetReleasedInputBytes(*layer, remainingReaders));
+        };
+        auto next = std::min_element(readyLayers.begin(), readyLayers.end(), [&](const Layer* lhs, const Layer* rhs)
+        {
+            const long long lhsGrowth = growth(lhs);
+            const long long rhsGrowth = growth(rhs);
+            return lhsGrowth < rhsGrowth || (lhsGrowth == rhsGrowth && depthRanks.at(lhs) < depthRanks.at(rhs));
+        });
+        const Layer* layer = *next;
+        readyLayers.erase(next);
+        schedule(layer);
+    }
+
+    for (auto&& outputLayer : GetOutputLayers())
+    {
+        ranks.emplace(outputLayer, ranks.size());
+    }
+    BOOST_ASSERT(ranks.size() == m_Layers.size());
+
+    m_Layers.sort([&ranks](const Layer* lhs, const Layer* rhs) { return ranks.at(lhs) < ranks.at(rhs); });
+
+    return GetPeakTensorBytes();
+}
+
+size_t Graph::GetPeakTensorBytes() const
+{
+    size_t constantBytes = 0;
+    std::unordered_map<const OutputSlot*, unsigned int> remainingReaders;
+    for (auto&& layer : TopologicalSort())
+    {
+        for (auto&& outputSlot : layer->GetOutputSlots())
+        {
+            remainingReaders.emplace(&outputSlot, outputSlot.GetNumConnections());
+            if (layer->GetType() == LayerType::Constant)
+            {
+                constantBytes += outputSlot.GetTensorInfo().GetNumBytes();
+            }
+        }
+    }
+
+    size_t liveBytes = 0;
+    size_t peakBytes = 0;
+    for (auto&& layer : m_Layers)
+    {
+        // The inputs of a layer are alive while it writes its outputs.
+        liveBytes += GetTransientOutputBytes(*layer);
+        peakBytes = std::max(peakBytes, liveBytes);
+        liveBytes -= GetReleasedInputBytes(*layer, remainingReaders);
+
+        for (auto&& inputSlot : layer->GetInputSlots())
+        {
+            --remainingReaders.at(inputSlot.GetConnectedOutputSlot());
+        }
+        if (layer->GetType() != LayerType::Constant)
+        {
+            for (auto&& outputSlot : layer->GetOutputSlots())
+            {
+                if (outputSlot.GetNumConnections() == 0)
+                {
+                    liveBytes -= outputSlot.GetTensorInfo().GetNumBytes();
+                }
+            }
+        }
+    }
+
+    return constantBytes + peakBytes;
+}
+
 void Graph::AddCopyLayers()
 {
     // Returns true if the given layer could potentially need an intermediate copy layer (depending on its
@@ -385,6 +665,145 @@ void Graph::EraseSubGraphLayers(const SubGraph &subGraph)
     }
 }
 
+namespace
+{
+
+InvalidArgumentException CannotSetBatchSize(const Layer& layer, const char* reason)
+{
+    return InvalidArgumentException(boost::str(
+        boost::format("Cannot change the batch size of the network: %1% layer '%2%' %3%")
+        % GetLayerTypeAsCString(layer.GetType()) % layer.GetNameStr() % reason));
+}
+
+// The target shape of a reshape follows the batch size when its first dimension is the batch.
+void SetReshapeBatchSize(ReshapeLayer& layer, const TensorShape& inputShape, unsigned int oldBatchSize,
+                         unsigned int batchSize)
+{
+    ReshapeDescriptor descriptor = layer.GetParameters();
+    if (descriptor.m_TargetShape[0] == oldBatchSize)
+    {
+        descriptor.m_TargetShape[0] = batchSize;
+    }
+    if (descriptor.m_TargetShape.GetNumElements() != inputShape.GetNumElements())
+    {
+        throw CannotSetBatchSize(layer, "reshapes across the batch dimension");
+    }
+    layer.SetParameters(descriptor);
+}
+
+// Views must span the whole batch, as does the input of the splitter.
+void SetSplitterBatchSize(SplitterLayer& layer, unsigned int oldBatchSize, unsigned int batchSize)
+{
+    ViewsDescriptor descriptor = layer.GetParameters();
+    for (unsigned int i = 0; i < descriptor.GetNumViews(); ++i)
+    {
+        if (descriptor.GetViewOrigin(i)[0] != 0 || descriptor.GetViewSizes(i)[0] != oldBatchSize)
+        {
+            throw CannotSetBatchSize(layer, "splits along the batch dimension");
+        }
+        descriptor.SetViewSize(i, 0, batchSize);
+    }
+    layer.SetParameters(descriptor);
+}
+
+void CheckBatchSizeCanChange(const MergerLayer& layer)
+{
+    const OriginsDescriptor& descriptor = layer.GetParameters();
+    for (unsigned int i = 0; i < descriptor.GetNumViews(); ++i)
+    {
+        if (descriptor.GetViewOrigin(i)[0] != 0)
+        {
+            throw CannotSetBatchSize(layer, "concatenates along the batch dimension");
+        }
+    }
+}
+
+} // anonymous namespace
+
+void Graph::SetBatchSize(unsigned int batchSize)
+{
+    if (GetNumInputs() == 0 || batchSize == 0)
+    {
+        throw InvalidArgumentException("Cannot change the batch size of a network without inputs, or to zero");
+    }
+    const unsigned int oldBatchSize = (*GetInputLayers().begin())->GetOutputSlot(0).GetTensorInfo().GetShape()[0];
+
+    // The first dimension of the outputs of the layers computed from the network inputs is the batch. Those of the
+    // layers computed from constants only stay as they are.
+    std::unordered_set<const OutputSlot*> batchSlots;
+    for (auto&& layer : TopologicalSort())
+    {
+        const bool isBatched = layer->GetType() == LayerType::Input ||
+            std::any_of(layer->GetInputSlots().begin(), layer->GetInputSlots().end(),
+                        [&batchSlots](const InputSlot& input)
+                        {
+                            return batchSlots.count(input.GetConnectedOutputSlot()) != 0;
+                        });
+        if (!isBatched)
+        {
+            continue;
+        }
+
+        // The first dimension of a stateful sequence is time, and its state is kept for the batch it started with.
+        if (layer->GetType() == LayerType::Lstm &&
+            boost::polymorphic_downcast<LstmLayer*>(layer)->GetParameters().m_StatefulSequence)
+        {
+            throw CannotSetBatchSize(*layer, "runs a stateful sequence, whose first dimension is time");
+        }
+
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            OutputSlot& output = layer->GetOutputSlot(i);
+            TensorInfo tensorInfo = output.GetTensorInfo();
+            TensorShape shape = tensorInfo.GetShape();
+            if (shape[0] != oldBatchSize)
+            {
+                throw CannotSetBatchSize(*layer, "has an output whose first dimension is not the batch");
+            }
+            shape[0] = batchSize;
+            tensorInfo.SetShape(shape);
+            output.SetTensorInfo(tensorInfo);
+            batchSlots.insert(&output);
+        }
+
+        switch (layer->GetType())
+        {
+            case LayerType::Reshape:
+            {
+                auto reshapeLayer = boost::polymorphic_downcast<ReshapeLayer*>(layer);
+                SetReshapeBatchSize(*reshapeLayer,
+                                    reshapeLayer->GetInputSlot(0).GetConnectedOutputSlot()->GetTensorInfo().GetShape(),
+                                    oldBatchSize, batchSize);
+                break;
+            }
+            case LayerType::Splitter:
+            {
+                SetSplitterBatchSize(*boost::polymorphic_downcast<SplitterLayer*>(layer), oldBatchSize, batchSize);
+                break;
+            }
+            case LayerType::Merger:
+            {
+                CheckBatchSizeCanChange(*boost::polymorphic_downcast<MergerLayer*>(layer));
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    // Catches the layers whose parameters still depend on the previous batch size.
+    try
+    {
+        InferTensorInfos();
+    }
+    catch (const LayerValidationException& error)
+    {
+        throw InvalidArgumentException(std::string("Cannot change the batch size of the network: ") + error.what());
+    }
+}
+
 void Graph::InferTensorInfos()
 {
     for (auto&& layer : TopologicalSort())
@@ -141,6 +141,15 @@ public:
     Graph& TopologicalSort() { const_cast<const Graph*>(this)->TopologicalSort(); return *this; }
     const Graph& TopologicalSort() const;
 
+    /// Sorts layers in a topological order chosen to keep few tensor bytes alive at once, rather than by depth, and
+    /// returns the peak of those bytes (see GetPeakTensorBytes()). The order holds until the graph is next modified.
+    size_t MemoryAwareTopologicalSort();
+
+    /// Returns the peak number of bytes held by the output tensors of the layers when they run in topological order:
+    /// the tensor of a constant lives throughout, any other from its producer to its last reader. Backends reusing or
+    /// aliasing buffers may need less.
+    size_t GetPeakTensorBytes() const;
+
     size_t GetNumInputs() const { return m_InputIds.size(); }
     size_t GetNumOutputs() const { return m_OutputIds.size(); }
 
@@ -155,7 +164,18 @@ public:
     size_t GetNumLayers() const { return m_Layers.size(); }
 
     /// Allocates memory for all tensors under output tensor handers of each layer.
-    Status AllocateDynamicBuffers();
+    /// @param layersRunInOrder - Whether the layers run one after the other in the topological order. If not, they
+    ///                           only wait for the layers they read from, and a tensor only shares memory with those
+    ///                           of the layers that are certain to run after all its readers (see
+    ///                           GetCompletionPositions()).
+    Status AllocateDynamicBuffers(bool layersRunInOrder = true);
+
+    /// Returns, for each layer in topological order, the position in that order from which all layers run after the
+    /// layer has completed, apart from constant and output layers. When the layers run in order, it is the next one.
+    /// Otherwise the layers are assumed to only wait for the layers they read from, input layers running before all
+    /// others. A tensor whose readers have all completed before a position may share memory with the tensors of the
+    /// layers from that position on.
+    std::vector<size_t> GetCompletionPositions(bool layersRunInOrder) const;
 
     /// Modifies the graph in-place, removing edges connecting layers using different compute devices,
     /// and relinking them via an intermediary copy layers.
@@ -168,6 +188,11 @@ public:
 
     void InferTensorInfos();
 
+    /// Sets the first dimension of the network inputs, which must all have the same, to batchSize and infers the
+    /// tensor infos of the other layers from them, adjusting the shapes held by the parameters of Reshape, Splitter
+    /// and Merger layers. Throws InvalidArgumentException if a layer cannot follow the new batch size.
+    void SetBatchSize(unsigned int batchSize);
+
     void AttachObservable(IGraphObservable* const observable, GraphEvent notifyOnEvent) {
         m_Views[notifyOnEvent].emplace_back(observable);
     }
@@ -12,7 +12,8 @@
 #include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
 
-#include <numeric>
+#include <algorithm>
+#include <vector>
 
 namespace armnn
 {
@@ -255,27 +256,60 @@ LayerPriority Layer::GetPriority() const
     }
     else if (m_Priority == 0)
     {
-        if (m_Visiting)
+        // Walks up to the layers whose priority is known with an explicit stack rather than recursively, so that deep
+        // graphs don't overflow the call stack. The stack holds the path being walked, whose layers are visiting.
+        std::vector<const Layer*> path = { this };
+        m_Visiting = true;
+
+        while (!path.empty())
         {
-            throw GraphValidationException("Graph has circular dependencies: cannot walk");
-        }
+            const Layer& layer = *path.back();
 
-        auto maxPrio = [](const LayerPriority prio, const InputSlot& slot) -> LayerPriority
+            LayerPriority parentPrio = 0U;
+            const Layer* unknownParent = nullptr;
+            for (auto&& slot : layer.GetInputSlots())
             {
-                const Layer& input = slot.GetConnectedOutputSlot()->GetOwningLayer();
-                return std::max(prio, input.GetPriority());
-            };
-
-        m_Visiting = true;
-        LayerPriority parentPrio = std::accumulate(GetInputSlots().cbegin(), GetInputSlots().cend(), 0U, maxPrio);
-        m_Visiting = false;
+                const Layer& parent = slot.GetConnectedOutputSlot()->GetOwningLayer();
+                if (parent.GetType() == LayerType::Input)
+                {
+                    parentPrio = std::max(parentPrio, inputPrio);
+                }
+                else if (parent.m_Priority != 0)
+                {
+                    parentPrio = std::max(parentPrio, parent.m_Priority);
+                }
+                else
+                {
+                    unknownParent = &parent;
+                    break;
+                }
+            }
+
+            if (unknownParent != nullptr)
+            {
+                if (unknownParent->m_Visiting)
+                {
+                    for (const Layer* visiting : path)
+                    {
+                        visiting->m_Visiting = false;
+                    }
+                    throw GraphValidationException("Graph has circular dependencies: cannot walk");
+                }
+
+                unknownParent->m_Visiting = true;
+                path.push_back(unknownParent);
+                continue;
+            }
+
+            if (parentPrio >= outputPrio)
+            {
+                throw GraphValidationException("Graph has too many edges");
+            }
 
-        if (parentPrio >= outputPrio)
-        {
-            throw GraphValidationException("Graph has too many edges");
+            layer.m_Priority = parentPrio + 1U;
+            layer.m_Visiting = false;
+            path.pop_back();
         }
-
-        m_Priority = parentPrio + 1U;
     }
 
     return m_Priority;
@@ -241,8 +241,8 @@ public:
 
     DataType GetDataType() const;
 
-    const BackendId& GetBackendId() const { return m_BackendId; }
-    void SetBackendId(const BackendId& id) { m_BackendId = id; }
+    const BackendId& GetBackendId() const override { return m_BackendId; }
+    void SetBackendId(const BackendId& id) override { m_BackendId = id; }
 
     // Virtuals
 
@@ -19,6 +19,7 @@
 #include <boost/assert.hpp>
 #include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
+#include <boost/numeric/conversion/cast.hpp>
 
 namespace armnn
 {
@@ -36,10 +37,34 @@ std::string ToErrorMessage(const char * prefix, const ExceptionType & error)
     return ss.str();
 }
 
+// Whether each element of the output of layers of the given type only depends on the elements at the same index in
+// their inputs of the same shape, so that the output can overwrite one of those inputs.
+bool IsElementwise(LayerType layerType)
+{
+    switch (layerType)
+    {
+        case LayerType::Activation:
+        case LayerType::Addition:
+        case LayerType::BatchNormalization:
+        case LayerType::Division:
+        case LayerType::Floor:
+        case LayerType::Maximum:
+        case LayerType::Minimum:
+        case LayerType::Multiplication:
+        case LayerType::Rsqrt:
+        case LayerType::Subtraction:
+            return true;
+        default:
+            return false;
+    }
+}
+
 } // anonymous
 
 std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
-                                                                std::string & errorMessage)
+                                                                std::string & errorMessage,
+                                                                std::shared_ptr<ThreadPool> interOpThreadPool,
+                                                                bool enableDynamicBatch)
 {
     std::unique_ptr<LoadedNetwork> loadedNetwork;
 
@@ -53,7 +78,8 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
 
     try
     {
-        loadedNetwork.reset(new LoadedNetwork(std::move(net)));
+        loadedNetwork.reset(new LoadedNetwork(std::move(net), std::move(interOpThreadPool), enableDynamicBatch,
+                                              nullptr));
     }
     catch (const armnn::RuntimeException& error)
     {
@@ -71,18 +97,34 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
     return loadedNetwork;
 }
 
-LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net)
+LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
+                             std::shared_ptr<ThreadPool> interOpThreadPool,
+                             bool enableDynamicBatch,
+                             std::shared_ptr<Profiler> profiler)
     : m_OptimizedNetwork(std::move(net))
+    , m_Profiler(std::move(profiler))
 {
-    // Create a profiler and register it for the current thread.
-    m_Profiler = std::make_shared<Profiler>();
-    ProfilerManager::GetInstance().RegisterProfiler(m_Profiler.get());
+    if (!m_Profiler)
+    {
+        // Create a profiler and register it for the current thread.
+        m_Profiler = std::make_shared<Profiler>();
+        ProfilerManager::GetInstance().RegisterProfiler(m_Profiler.get());
+    }
+
+    if (enableDynamicBatch && m_OptimizedNetwork->GetGraph().GetNumInputs() != 0)
+    {
+        // The constant tensors of the copied layers share their memory with the original ones.
+        m_BatchGraph = std::make_unique<Graph>(m_OptimizedNetwork->GetGraph());
+        m_BatchSize = (*m_BatchGraph->GetInputLayers().begin())->GetOutputSlot(0).GetTensorInfo().GetShape()[0];
+        m_InterOpThreadPool = interOpThreadPool;
+    }
 
     Graph& order = m_OptimizedNetwork->GetGraph().TopologicalSort();
     //First create tensor handlers, backends and workload factories.
     //Handlers are created before workloads are.
     //Because workload creation can modify some of the handlers,
     //(for example the splitter and merger layers).
+    std::unordered_set<const OutputSlot*> overwritableSlots;
     for (auto&& layer : order)
     {
         auto const& backend = layer->GetBackendId();
@@ -98,6 +140,7 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net)
                 std::make_pair(std::move(workloadFactory), memoryManager)));
         }
         layer->CreateTensorHandles(m_OptimizedNetwork->GetGraph(), GetWorkloadFactory(*layer));
+        AliasOutputs(*layer, overwritableSlots);
     }
 
     //Then create workloads.
@@ -127,6 +170,7 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net)
                 }
 
                 m_WorkloadQueue.push_back(move(workload));
+                m_WorkloadLayers.push_back(layer);
                 // release the constant data in the layer..
                 layer->ReleaseConstantData();
                 break;
@@ -134,8 +178,30 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net)
         }
     }
 
-    // Set up memory.
-    m_OptimizedNetwork->GetGraph().AllocateDynamicBuffers();
+    // Each workload depends on those producing its inputs, the network inputs being set before any workload runs.
+    if (interOpThreadPool && interOpThreadPool->GetNumThreads() > 1)
+    {
+        std::unordered_map<const Layer*, unsigned int> workloadIndices;
+        std::vector<std::vector<unsigned int>> dependencies(m_WorkloadLayers.size());
+        for (unsigned int i = 0; i < m_WorkloadLayers.size(); ++i)
+        {
+            for (auto&& inputSlot : m_WorkloadLayers[i]->GetInputSlots())
+            {
+                auto producer = workloadIndices.find(&inputSlot.GetConnectedOutputSlot()->GetOwningLayer());
+                if (producer != workloadIndices.end() &&
+                    std::find(dependencies[i].begin(), dependencies[i].end(), producer->second) ==
+                    dependencies[i].end())
+                {
+                    dependencies[i].push_back(producer->second);
+                }
+            }
+            workloadIndices.emplace(m_WorkloadLayers[i], i);
+        }
+        m_WorkloadScheduler = std::make_unique<WorkloadScheduler>(dependencies, std::move(interOpThreadPool));
+    }
+
+    // Set up memory. Tensors may only share memory if the workloads using them cannot run at the same time.
+    m_OptimizedNetwork->GetGraph().AllocateDynamicBuffers(!m_WorkloadScheduler);
 
     // Now that the intermediate tensor memory has been set-up, do any post allocation configuration for each workload.
     for (auto& workload : m_WorkloadQueue)
@@ -199,6 +265,54 @@ const IWorkloadFactory& LoadedNetwork::GetWorkloadFactory(const Layer& layer) co
     return *workloadFactory;
 }
 
+void LoadedNetwork::AliasOutputs(Layer& layer, std::unordered_set<const OutputSlot*>& overwritableSlots) const
+{
+    const bool isReshape = layer.GetType() == LayerType::Reshape;
+    if (layer.GetNumOutputSlots() == 1 && (isReshape || IsElementwise(layer.GetType())))
+    {
+        OutputSlot& outputSlot = layer.GetOutputSlot(0);
+        for (auto&& inputSlot : layer.GetInputSlots())
+        {
+            // Being the only reader of the input, the layer is also the last one, so there is no need to order the
+            // workloads any further when they run concurrently.
+            const OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot();
+            ITensorHandle* inputHandle = connectedSlot->GetOutputHandler().GetData();
+            const bool isOverwritable = overwritableSlots.count(connectedSlot) != 0;
+            if (!inputHandle ||
+                connectedSlot->GetNumConnections() != 1 ||
+                (!isReshape && (!isOverwritable || connectedSlot->GetTensorInfo() != outputSlot.GetTensorInfo())))
+            {
+                continue;
+            }
+
+            std::unique_ptr<ITensorHandle> aliasHandle =
+                GetWorkloadFactory(layer).CreateAliasTensorHandle(*inputHandle, outputSlot.GetTensorInfo());
+            if (aliasHandle)
+            {
+                outputSlot.GetOutputHandler().SetData(std::move(aliasHandle));
+                if (isOverwritable)
+                {
+                    overwritableSlots.insert(&outputSlot);
+                }
+                return;
+            }
+        }
+    }
+
+    if (layer.GetType() != LayerType::Input && layer.GetType() != LayerType::Constant)
+    {
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            // Views made by splitters or mergers are not, as their parent is read or written by other layers.
+            const ITensorHandle* outputHandle = layer.GetOutputSlot(i).GetOutputHandler().GetData();
+            if (outputHandle && !outputHandle->GetParent())
+            {
+                overwritableSlots.insert(&layer.GetOutputSlot(i));
+            }
+        }
+    }
+}
+
 namespace {
 
 // Non-copyable class owning accelerator-specific tensor data.
@@ -294,10 +408,28 @@ private:
 }
 
 Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
-                                      const OutputTensors& outputTensors)
+                                      const OutputTensors& outputTensors,
+                                      const std::vector<ImportedInputId>& preImportedInputIds,
+                                      const std::vector<ImportedOutputId>& preImportedOutputIds)
 {
+    if (m_BatchGraph)
+    {
+        const unsigned int batchSize = GetRequestedBatchSize(inputTensors);
+        if (batchSize != m_BatchSize)
+        {
+            if (!preImportedInputIds.empty() || !preImportedOutputIds.empty())
+            {
+                throw InvalidArgumentException("Imported tensors can only be used at the batch size the network was "
+                                               "optimized for");
+            }
+            return GetBatchNetwork(batchSize)->EnqueueWorkload(inputTensors, outputTensors);
+        }
+    }
+
     ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "EnqueueWorkload");
 
+    std::unique_lock<std::shared_timed_mutex> executionLock(m_ExecutionMutex);
+
     const Graph& graph = m_OptimizedNetwork->GetGraph();
 
     // Walk graph to determine the order of execution.
@@ -310,27 +442,69 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
     // Data that must be kept alive for the entire execution of the workload.
     WorkloadData workloadData(inputTensors, outputTensors);
 
-    if (graph.GetNumInputs() != inputTensors.size())
+    if (graph.GetNumInputs() != inputTensors.size() + preImportedInputIds.size())
     {
         throw InvalidArgumentException("Number of inputs provided does not match network.");
     }
 
-    // For each input to the network, call EnqueueInput with the data passed by the user.
+    // Network tensors made to alias imported memory for this execution only. A tensor can alias a single buffer,
+    // so any further imported tensor bound to it is copied instead.
+    std::vector<ITensorHandle*> aliasedTensorHandles;
+    auto Alias = [&aliasedTensorHandles](const ImportedTensor& importedTensor)
+    {
+        ITensorHandle* tensorHandle = importedTensor.m_NetworkTensorHandle;
+        if (!tensorHandle ||
+            std::find(aliasedTensorHandles.begin(), aliasedTensorHandles.end(), tensorHandle) !=
+            aliasedTensorHandles.end() ||
+            !tensorHandle->Import(importedTensor.m_Memory))
+        {
+            return false;
+        }
+        aliasedTensorHandles.push_back(tensorHandle);
+        return true;
+    };
+
+    // For each input to the network, call EnqueueInput with the data passed by the user, unless it was imported.
     m_InputQueue.clear();
-    m_InputQueue.reserve(graph.GetNumInputs());
+    m_PreImportedInputQueue.clear();
     for (const BindableLayer* inputLayer : graph.GetInputLayers())
     {
+        const ImportedTensor* importedInput =
+            FindImportedTensor(m_ImportedInputs, preImportedInputIds, inputLayer->GetBindingId());
+        if (importedInput)
+        {
+            if (!Alias(*importedInput))
+            {
+                m_PreImportedInputQueue.push_back(importedInput->m_CopyWorkload.get());
+            }
+            continue;
+        }
+
         const TensorPin& pin = workloadData.GetInputTensorPin(inputLayer->GetBindingId());
-        EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+        EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(),
+                     inputLayer->GetOutputHandler().GetData(), m_InputQueue);
     }
 
-    // For each output to the network, call EnqueueOutput with the data passed by the user.
+    // For each output to the network, call EnqueueOutput with the data passed by the user, unless it was imported.
     m_OutputQueue.clear();
-    m_OutputQueue.reserve(graph.GetNumOutputs());
+    m_PreImportedOutputQueue.clear();
     for (const BindableLayer* outputLayer : graph.GetOutputLayers())
     {
+        const ImportedTensor* importedOutput =
+            FindImportedTensor(m_ImportedOutputs, preImportedOutputIds, outputLayer->GetBindingId());
+        if (importedOutput)
+        {
+            if (!Alias(*importedOutput))
+            {
+                m_PreImportedOutputQueue.push_back(importedOutput->m_CopyWorkload.get());
+            }
+            continue;
+        }
+
         const TensorPin& pin = workloadData.GetOutputTensorPin(outputLayer->GetBindingId());
-        EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+        EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(),
+                      outputLayer->GetInputSlots()[0].GetConnectedOutputSlot()->GetOutputHandler().GetData(),
+                      m_OutputQueue);
     }
 
     bool executionSucceeded = true;
@@ -341,10 +515,155 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         executionSucceeded = Execute();
     }
 
+    for (ITensorHandle* tensorHandle : aliasedTensorHandles)
+    {
+        tensorHandle->Import(nullptr);
+    }
+
     return executionSucceeded ? Status::Success : Status::Failure;
 }
 
-void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+std::vector<ImportedInputId> LoadedNetwork::ImportInputs(const InputTensors& inputTensors)
+{
+    std::unique_lock<std::shared_timed_mutex> executionLock(m_ExecutionMutex);
+
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    std::vector<ImportedInputId> importedInputIds;
+    for (auto&& inputTensorPair : inputTensors)
+    {
+        const ConstTensor& inputTensor = inputTensorPair.second;
+
+        auto inputLayer = std::find_if(graph.GetInputLayers().begin(), graph.GetInputLayers().end(),
+            [&](const BindableLayer* layer) { return layer->GetBindingId() == inputTensorPair.first; });
+        if (inputLayer == graph.GetInputLayers().end())
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("No input with binding id %1% to import a tensor for") % inputTensorPair.first));
+        }
+
+        ITensorHandle* networkTensorHandle = (*inputLayer)->GetOutputHandler().GetData();
+        if ((*inputLayer)->GetOutputHandler().GetTensorInfo().GetNumBytes() != inputTensor.GetInfo().GetNumBytes())
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("Size of the tensor imported for input %1% does not match network")
+                % inputTensorPair.first));
+        }
+
+        ImportedTensor importedInput;
+        importedInput.m_BindingId = inputTensorPair.first;
+        // Inputs are only ever read from, even when the network tensor aliases them.
+        importedInput.m_Memory = const_cast<void*>(inputTensor.GetMemoryArea());
+        importedInput.m_NetworkTensorHandle = networkTensorHandle;
+        importedInput.m_TensorHandle =
+            std::make_unique<ConstPassthroughCpuTensorHandle>(inputTensor.GetInfo(), inputTensor.GetMemoryArea());
+
+        WorkloadQueue copyQueue;
+        EnqueueInput(**inputLayer, importedInput.m_TensorHandle.get(), inputTensor.GetInfo(),
+                     networkTensorHandle, copyQueue);
+        importedInput.m_CopyWorkload = std::move(copyQueue.back());
+
+        importedInputIds.push_back(boost::numeric_cast<ImportedInputId>(m_ImportedInputs.size()));
+        m_ImportedInputs.push_back(std::move(importedInput));
+    }
+    return importedInputIds;
+}
+
+std::vector<ImportedOutputId> LoadedNetwork::ImportOutputs(const OutputTensors& outputTensors)
+{
+    std::unique_lock<std::shared_timed_mutex> executionLock(m_ExecutionMutex);
+
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    std::vector<ImportedOutputId> importedOutputIds;
+    for (auto&& outputTensorPair : outputTensors)
+    {
+        const Tensor& outputTensor = outputTensorPair.second;
+
+        auto outputLayer = std::find_if(graph.GetOutputLayers().begin(), graph.GetOutputLayers().end(),
+            [&](const BindableLayer* layer) { return layer->GetBindingId() == outputTensorPair.first; });
+        if (outputLayer == graph.GetOutputLayers().end())
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("No output with binding id %1% to import a tensor for") % outputTensorPair.first));
+        }
+
+        const OutputSlot* producerSlot = (*outputLayer)->GetInputSlots()[0].GetConnectedOutputSlot();
+        ITensorHandle* networkTensorHandle = producerSlot->GetOutputHandler().GetData();
+        if (producerSlot->GetTensorInfo().GetNumBytes() != outputTensor.GetInfo().GetNumBytes())
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("Size of the tensor imported for output %1% does not match network")
+                % outputTensorPair.first));
+        }
+
+        ImportedTensor importedOutput;
+        importedOutput.m_BindingId = outputTensorPair.first;
+        importedOutput.m_Memory = outputTensor.GetMemoryArea();
+        // The data of constant layers is set once, so their tensors must never alias anything.
+        importedOutput.m_NetworkTensorHandle =
+            producerSlot->GetOwningLayer().GetType() == LayerType::Constant ? nullptr : networkTensorHandle;
+        importedOutput.m_TensorHandle =
+            std::make_unique<PassthroughCpuTensorHandle>(outputTensor.GetInfo(), outputTensor.GetMemoryArea());
+
+        WorkloadQueue copyQueue;
+        EnqueueOutput(**outputLayer, importedOutput.m_TensorHandle.get(), outputTensor.GetInfo(),
+                      networkTensorHandle, copyQueue);
+        importedOutput.m_CopyWorkload = std::move(copyQueue.back());
+
+        importedOutputIds.push_back(boost::numeric_cast<ImportedOutputId>(m_ImportedOutputs.size()));
+        m_ImportedOutputs.push_back(std::move(importedOutput));
+    }
+    return importedOutputIds;
+}
+
+void LoadedNetwork::ClearImportedInputs(const std::vector<ImportedInputId>& inputIds)
+{
+    std::unique_lock<std::shared_timed_mutex> executionLock(m_ExecutionMutex);
+    for (ImportedInputId id : inputIds)
+    {
+        if (id >= m_ImportedInputs.size() || !m_ImportedInputs[id].m_TensorHandle)
+        {
+            throw InvalidArgumentException(boost::str(boost::format("Unknown imported input id %1%") % id));
+        }
+        m_ImportedInputs[id] = ImportedTensor();
+    }
+}
+
+void LoadedNetwork::ClearImportedOutputs(const std::vector<ImportedOutputId>& outputIds)
+{
+    std::unique_lock<std::shared_timed_mutex> executionLock(m_ExecutionMutex);
+    for (ImportedOutputId id : outputIds)
+    {
+        if (id >= m_ImportedOutputs.size() || !m_ImportedOutputs[id].m_TensorHandle)
+        {
+            throw InvalidArgumentException(boost::str(boost::format("Unknown imported output id %1%") % id));
+        }
+        m_ImportedOutputs[id] = ImportedTensor();
+    }
+}
+
+const LoadedNetwork::ImportedTensor* LoadedNetwork::FindImportedTensor(
+    const std::vector<ImportedTensor>& importedTensors,
+    const std::vector<unsigned int>& importedIds,
+    LayerBindingId bindingId) const
+{
+    for (unsigned int id : importedIds)
+    {
+        if (id >= importedTensors.size() || !importedTensors[id].m_TensorHandle)
+        {
+            throw InvalidArgumentException(boost::str(boost::format("Unknown imported tensor id %1%") % id));
+        }
+        if (importedTensors[id].m_BindingId == bindingId)
+        {
+            return &importedTensors[id];
+        }
+    }
+    return nullptr;
+}
+
+void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo,
+                                 ITensorHandle* networkTensorHandle, WorkloadQueue& inputQueue) const
 {
     if (layer.GetType() != LayerType::Input)
     {
@@ -365,19 +684,19 @@ void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tens
     BOOST_ASSERT_MSG(layer.GetNumOutputSlots() == 1, "Can only handle Input Layer with one output");
     const OutputHandler& handler = layer.GetOutputHandler();
     const TensorInfo& outputTensorInfo = handler.GetTensorInfo();
-    ITensorHandle* outputTensorHandle = handler.GetData();
-    BOOST_ASSERT_MSG(outputTensorHandle != nullptr,
+    BOOST_ASSERT_MSG(networkTensorHandle != nullptr,
                      "Data should have been allocated.");
-    inputQueueDescriptor.m_Outputs.push_back(outputTensorHandle);
+    inputQueueDescriptor.m_Outputs.push_back(networkTensorHandle);
     info.m_OutputTensorInfos.push_back(outputTensorInfo);
 
     const IWorkloadFactory& workloadFactory = GetWorkloadFactory(layer);
     auto inputWorkload = workloadFactory.CreateInput(inputQueueDescriptor, info);
     BOOST_ASSERT_MSG(inputWorkload, "No input workload created");
-    m_InputQueue.push_back(move(inputWorkload));
+    inputQueue.push_back(move(inputWorkload));
 }
 
-void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo,
+                                  ITensorHandle* networkTensorHandle, WorkloadQueue& outputQueue) const
 {
     if (layer.GetType() != LayerType::Output)
     {
@@ -401,16 +720,15 @@ void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* ten
     const OutputHandler& outputHandler = layer.GetInputSlots()[0].GetConnectedOutputSlot()->GetOutputHandler();
 
     const TensorInfo& inputTensorInfo = outputHandler.GetTensorInfo();
-    ITensorHandle* inputTensorHandle = outputHandler.GetData();
-    BOOST_ASSERT_MSG(inputTensorHandle != nullptr, "Data should have been allocated.");
+    BOOST_ASSERT_MSG(networkTensorHandle != nullptr, "Data should have been allocated.");
 
-    outputQueueDescriptor.m_Inputs.push_back(inputTensorHandle);
+    outputQueueDescriptor.m_Inputs.push_back(networkTensorHandle);
     info.m_InputTensorInfos.push_back(inputTensorInfo);
 
     const IWorkloadFactory& workloadFactory = GetWorkloadFactory(layer);
     auto outputWorkload = workloadFactory.CreateOutput(outputQueueDescriptor, info);
     BOOST_ASSERT_MSG(outputWorkload, "No output workload created");
-    m_OutputQueue.push_back(move(outputWorkload));
+    outputQueue.push_back(move(outputWorkload));
 }
 
 void LoadedNetwork::AllocateWorkingMemory()
@@ -432,6 +750,14 @@ void LoadedNetwork::AllocateWorkingMemory()
 
 void LoadedNetwork::FreeWorkingMemory()
 {
+    {
+        std::lock_guard<std::mutex> lockGuard(m_BatchNetworksMutex);
+        for (auto&& batchNetwork : m_BatchNetworks)
+        {
+            batchNetwork.second->FreeWorkingMemory();
+        }
+    }
+
     std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
     if (!m_IsWorkingMemAllocated)
     {
@@ -469,15 +795,22 @@ bool LoadedNetwork::Execute()
             input->Execute();
         }
 
-        for (auto& workload : m_WorkloadQueue)
+        for (auto& input : m_PreImportedInputQueue)
         {
-            workload->Execute();
+            input->Execute();
         }
 
+        ExecuteWorkloads([this](unsigned int i) { m_WorkloadQueue[i]->Execute(); });
+
         for (auto& output: m_OutputQueue)
         {
             output->Execute();
         }
+
+        for (auto& output : m_PreImportedOutputQueue)
+        {
+            output->Execute();
+        }
     }
     catch (const RuntimeException& error)
     {
@@ -491,12 +824,316 @@ bool LoadedNetwork::Execute()
     return success;
 }
 
+void LoadedNetwork::ExecuteWorkloads(const std::function<void(unsigned int)>& executeWorkload) const
+{
+    if (m_WorkloadScheduler)
+    {
+        m_WorkloadScheduler->Execute(executeWorkload);
+        return;
+    }
+
+    for (unsigned int i = 0; i < m_WorkloadQueue.size(); ++i)
+    {
+        executeWorkload(i);
+    }
+}
+
 void LoadedNetwork::RegisterDebugCallback(const DebugCallbackFunction& func)
 {
     for (auto&& workloadPtr: m_WorkloadQueue)
     {
         workloadPtr.get()->RegisterDebugCallback(func);
     }
+
+    std::lock_guard<std::mutex> lockGuard(m_BatchNetworksMutex);
+    m_DebugCallback = func;
+    for (auto&& batchNetwork : m_BatchNetworks)
+    {
+        batchNetwork.second->RegisterDebugCallback(func);
+    }
+}
+
+void LoadedNetwork::ResetState()
+{
+    for (auto&& workloadPtr: m_WorkloadQueue)
+    {
+        workloadPtr->ResetState();
+    }
+
+    std::lock_guard<std::mutex> lockGuard(m_BatchNetworksMutex);
+    for (auto&& batchNetwork : m_BatchNetworks)
+    {
+        batchNetwork.second->ResetState();
+    }
+}
+
+unsigned int LoadedNetwork::GetRequestedBatchSize(const InputTensors& inputTensors) const
+{
+    // Inputs differing in any other way are left for the usual checks to report.
+    unsigned int batchSize = 0;
+    for (auto&& inputTensor : inputTensors)
+    {
+        const TensorShape& shape = inputTensor.second.GetShape();
+        const TensorShape networkShape = GetInputTensorInfo(inputTensor.first).GetShape();
+        if (shape.GetNumDimensions() != networkShape.GetNumDimensions() || shape[0] == 0 ||
+            (batchSize != 0 && shape[0] != batchSize))
+        {
+            return m_BatchSize;
+        }
+        for (unsigned int i = 1; i < shape.GetNumDimensions(); ++i)
+        {
+            if (shape[i] != networkShape[i])
+            {
+                return m_BatchSize;
+            }
+        }
+        batchSize = shape[0];
+    }
+    return batchSize != 0 ? batchSize : m_BatchSize;
+}
+
+std::shared_ptr<LoadedNetwork> LoadedNetwork::GetBatchNetwork(unsigned int batchSize)
+{
+    std::lock_guard<std::mutex> lockGuard(m_BatchNetworksMutex);
+
+    auto it = std::find_if(m_BatchNetworks.begin(), m_BatchNetworks.end(),
+                           [batchSize](const std::pair<unsigned int, std::shared_ptr<LoadedNetwork>>& batchNetwork)
+                           {
+                               return batchNetwork.first == batchSize;
+                           });
+    if (it != m_BatchNetworks.end())
+    {
+        m_BatchNetworks.splice(m_BatchNetworks.begin(), m_BatchNetworks, it);
+        return m_BatchNetworks.front().second;
+    }
+
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareBatchNetwork");
+
+    // The constant tensors of the layers, and the data the workloads derive from them, are shared with the other
+    // networks.
+    auto graph = std::make_unique<Graph>(*m_BatchGraph);
+    graph->SetBatchSize(batchSize);
+
+    std::shared_ptr<LoadedNetwork> batchNetwork(new LoadedNetwork(
+        std::make_unique<OptimizedNetwork>(std::move(graph)), m_InterOpThreadPool, false, m_Profiler));
+    if (m_DebugCallback)
+    {
+        batchNetwork->RegisterDebugCallback(m_DebugCallback);
+    }
+
+    m_BatchNetworks.emplace_front(batchSize, batchNetwork);
+    if (m_BatchNetworks.size() > MaxBatchNetworks)
+    {
+        m_BatchNetworks.pop_back();
+    }
+    return batchNetwork;
+}
+
+std::unique_ptr<IWorkingMemHandle> LoadedNetwork::CreateWorkingMemHandle(NetworkId networkId)
+{
+    Graph& order = m_OptimizedNetwork->GetGraph().TopologicalSort();
+
+    // Each context gets its own memory managers, so that the intermediate tensors of concurrent executions never
+    // share memory. Their lifetimes are reported in the same way as Graph::AllocateDynamicBuffers() does.
+    WorkingMemHandle::MemoryManagers memoryManagers;
+    std::unordered_map<BackendId, IBackendInternal::IWorkloadFactoryPtr> workloadFactories;
+    for (auto&& backend : m_Backends)
+    {
+        IBackendInternal::IMemoryManagerSharedPtr memoryManager = backend.second->CreateMemoryManager();
+        workloadFactories.emplace(std::make_pair(backend.first, backend.second->CreateWorkloadFactory(memoryManager)));
+        if (memoryManager)
+        {
+            memoryManagers.push_back(memoryManager);
+        }
+    }
+
+    WorkingMemHandle::TensorHandles tensorHandles;
+    WorkingMemHandle::SlotHandleMap slotHandles;
+    std::unordered_map<ITensorHandle*, unsigned int> handleReferenceCounts;
+    std::unordered_map<ITensorHandle*, size_t> releasePositions;
+    const std::vector<size_t> completionPositions = order.GetCompletionPositions(!m_WorkloadScheduler);
+    std::vector<std::vector<ITensorHandle*>> tensorsToRelease(order.GetNumLayers() + 1);
+
+    size_t position = 0;
+    for (auto&& layer : order)
+    {
+        for (ITensorHandle* tensorHandle : tensorsToRelease[position])
+        {
+            tensorHandle->Allocate();
+        }
+
+        for (auto&& slot = layer->BeginOutputSlots(); slot != layer->EndOutputSlots(); ++slot)
+        {
+            if (layer->GetType() == LayerType::Constant)
+            {
+                // Constant tensors are read-only during execution, so all contexts share those of the network.
+                slotHandles.emplace(&(*slot), slot->GetOutputHandler().GetData());
+                continue;
+            }
+
+            const IWorkloadFactory& workloadFactory = *workloadFactories.at(layer->GetBackendId());
+            std::unique_ptr<ITensorHandle> tensorHandle = workloadFactory.CreateTensorHandle(slot->GetTensorInfo());
+            tensorHandle->Manage();
+            handleReferenceCounts[tensorHandle.get()] = slot->GetNumConnections();
+            slotHandles.emplace(&(*slot), tensorHandle.get());
+            tensorHandles.push_back(std::move(tensorHandle));
+        }
+
+        for (auto&& slot = layer->BeginInputSlots(); slot != layer->EndInputSlots(); ++slot)
+        {
+            auto it = handleReferenceCounts.find(slotHandles.at(slot->GetConnectedOutputSlot()));
+            if (it == handleReferenceCounts.end())
+            {
+                continue;
+            }
+
+            // Workloads run by the scheduler only wait for those they read from, so a tensor lives until all of its
+            // readers are certain to have completed.
+            size_t& releasePosition = releasePositions[it->first];
+            releasePosition = std::max(releasePosition, completionPositions[position]);
+            if (--it->second == 0)
+            {
+                tensorsToRelease[releasePosition].push_back(it->first);
+                releasePositions.erase(it->first);
+                handleReferenceCounts.erase(it);
+            }
+        }
+        ++position;
+    }
+
+    for (ITensorHandle* tensorHandle : tensorsToRelease.back())
+    {
+        tensorHandle->Allocate();
+    }
+
+    // Tensors that nothing reads from still need their memory.
+    for (auto&& handleReferenceCount : handleReferenceCounts)
+    {
+        handleReferenceCount.first->Allocate();
+    }
+
+    std::vector<WorkingMemDescriptor> workingMemDescriptors;
+    workingMemDescriptors.reserve(m_WorkloadLayers.size());
+    for (size_t i = 0; i < m_WorkloadLayers.size(); ++i)
+    {
+        const Layer* layer = m_WorkloadLayers[i];
+        WorkingMemDescriptor workingMemDescriptor;
+        workingMemDescriptor.m_State = m_WorkloadQueue[i]->CreateState();
+        for (auto&& inputSlot : layer->GetInputSlots())
+        {
+            workingMemDescriptor.m_Inputs.push_back(slotHandles.at(inputSlot.GetConnectedOutputSlot()));
+        }
+        for (auto&& outputSlot : layer->GetOutputSlots())
+        {
+            workingMemDescriptor.m_Outputs.push_back(slotHandles.at(&outputSlot));
+        }
+        workingMemDescriptors.push_back(std::move(workingMemDescriptor));
+    }
+
+    {
+        // Fills the shared constant tensors, in case the network has not been run yet.
+        std::unique_lock<std::shared_timed_mutex> executionLock(m_ExecutionMutex);
+        for (size_t i = 0; i < m_WorkloadQueue.size(); ++i)
+        {
+            if (m_WorkloadLayers[i]->GetType() == LayerType::Constant)
+            {
+                m_WorkloadQueue[i]->Execute();
+            }
+        }
+    }
+
+    return std::make_unique<WorkingMemHandle>(networkId,
+                                              std::move(memoryManagers),
+                                              std::move(tensorHandles),
+                                              std::move(slotHandles),
+                                              std::move(workingMemDescriptors));
+}
+
+Status LoadedNetwork::Execute(const InputTensors& inputTensors,
+                              const OutputTensors& outputTensors,
+                              IWorkingMemHandle& iWorkingMemHandle)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
+
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    if (graph.GetNumLayers() < 2)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "IRuntime::Execute()::Less than two nodes in graph";
+        return Status::Failure;
+    }
+
+    if (graph.GetNumInputs() != inputTensors.size())
+    {
+        throw InvalidArgumentException("Number of inputs provided does not match network.");
+    }
+
+    WorkingMemHandle& workingMemHandle = *boost::polymorphic_downcast<WorkingMemHandle*>(&iWorkingMemHandle);
+    std::lock_guard<std::mutex> workingMemLock(workingMemHandle.GetMutex());
+    std::shared_lock<std::shared_timed_mutex> executionLock(m_ExecutionMutex);
+
+    // Data that must be kept alive for the entire execution of the workload.
+    WorkloadData workloadData(inputTensors, outputTensors);
+
+    WorkloadQueue inputQueue;
+    inputQueue.reserve(graph.GetNumInputs());
+    for (const BindableLayer* inputLayer : graph.GetInputLayers())
+    {
+        const TensorPin& pin = workloadData.GetInputTensorPin(inputLayer->GetBindingId());
+        EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(),
+                     workingMemHandle.GetTensorHandle(inputLayer->GetOutputSlot(0)), inputQueue);
+    }
+
+    WorkloadQueue outputQueue;
+    outputQueue.reserve(graph.GetNumOutputs());
+    for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+    {
+        const TensorPin& pin = workloadData.GetOutputTensorPin(outputLayer->GetBindingId());
+        EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(),
+                      workingMemHandle.GetTensorHandle(*outputLayer->GetInputSlots()[0].GetConnectedOutputSlot()),
+                      outputQueue);
+    }
+
+    bool success = true;
+
+    auto Fail = [&](const std::exception& error)
+    {
+        BOOST_LOG_TRIVIAL(error) << "An error occurred attempting to execute a workload: " << error.what();
+        success = false;
+    };
+
+    try
+    {
+        workingMemHandle.Allocate();
+
+        for (auto& input : inputQueue)
+        {
+            input->Execute();
+        }
+
+        ExecuteWorkloads([&](unsigned int i)
+        {
+            if (m_WorkloadLayers[i]->GetType() != LayerType::Constant)
+            {
+                m_WorkloadQueue[i]->ExecuteAsync(workingMemHandle.GetWorkingMemDescriptorAt(i));
+            }
+        });
+
+        for (auto& output : outputQueue)
+        {
+            output->Execute();
+        }
+    }
+    catch (const RuntimeException& error)
+    {
+        Fail(error);
+    }
+    catch (const std::runtime_error& error)
+    {
+        Fail(error);
+    }
+
+    return success ? Status::Success : Status::Failure;
 }
 
 }
@@ -10,13 +10,18 @@
 #include "Network.hpp"
 #include "LayerFwd.hpp"
 #include "Profiling.hpp"
+#include "WorkingMemHandle.hpp"
+#include "WorkloadScheduler.hpp"
 
 #include <backendsCommon/IBackendInternal.hpp>
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadFactory.hpp>
 
+#include <list>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace cl
 {
@@ -37,10 +42,33 @@ public:
     TensorInfo GetInputTensorInfo(LayerBindingId layerId) const;
     TensorInfo GetOutputTensorInfo(LayerBindingId layerId) const;
 
-    Status EnqueueWorkload(const InputTensors& inputTensors, const OutputTensors& outputTensors);
+    Status EnqueueWorkload(const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors,
+                           const std::vector<ImportedInputId>& preImportedInputIds = {},
+                           const std::vector<ImportedOutputId>& preImportedOutputIds = {});
 
+    std::vector<ImportedInputId> ImportInputs(const InputTensors& inputTensors);
+    std::vector<ImportedOutputId> ImportOutputs(const OutputTensors& outputTensors);
+
+    void ClearImportedInputs(const std::vector<ImportedInputId>& inputIds);
+    void ClearImportedOutputs(const std::vector<ImportedOutputId>& outputIds);
+
+    /// Creates the working memory of a new execution context for this network.
+    std::unique_ptr<IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId);
+
+    /// Evaluates the network on the working memory of the given execution context.
+    /// Safe to call concurrently with different handles.
+    Status Execute(const InputTensors& inputTensors,
+                   const OutputTensors& outputTensors,
+                   IWorkingMemHandle& workingMemHandle);
+
+    /// @param interOpThreadPool - If set, the workloads of independent branches of the network run concurrently on
+    ///                            this pool.
+    /// @param enableDynamicBatch - If set, EnqueueWorkload() accepts inputs of any batch size.
     static std::unique_ptr<LoadedNetwork> MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
-                                                            std::string & errorMessage);
+                                                            std::string & errorMessage,
+                                                            std::shared_ptr<ThreadPool> interOpThreadPool = nullptr,
+                                                            bool enableDynamicBatch = false);
 
     // NOTE we return by reference as the purpose of this method is only to provide
     // access to the private m_Profiler and in theory we should not need to increment
@@ -51,19 +79,60 @@ public:
 
     void RegisterDebugCallback(const DebugCallbackFunction& func);
 
+    void ResetState();
+
 private:
     void AllocateWorkingMemory();
 
-    LoadedNetwork(std::unique_ptr<OptimizedNetwork> net);
+    // Networks prepared for another batch size share the profiler of the network they were derived from.
+    LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
+                  std::shared_ptr<ThreadPool> interOpThreadPool,
+                  bool enableDynamicBatch,
+                  std::shared_ptr<Profiler> profiler);
 
-    void EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
+    void EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo,
+                      ITensorHandle* networkTensorHandle, WorkloadQueue& inputQueue) const;
 
-    void EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
+    void EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo,
+                       ITensorHandle* networkTensorHandle, WorkloadQueue& outputQueue) const;
 
     bool Execute();
 
+    // Calls executeWorkload(i) for each entry i of m_WorkloadQueue, in order or through m_WorkloadScheduler.
+    void ExecuteWorkloads(const std::function<void(unsigned int)>& executeWorkload) const;
+
     const IWorkloadFactory& GetWorkloadFactory(const Layer& layer) const;
 
+    // Makes the output of a layer share the memory of an input that nothing else reads, when the backend allows it:
+    // reshapes reinterpret the input, and elementwise layers overwrite it. overwritableSlots holds the outputs whose
+    // only reader may overwrite them, which excludes the network inputs (they may be imported) and the constants.
+    void AliasOutputs(Layer& layer, std::unordered_set<const OutputSlot*>& overwritableSlots) const;
+
+    // Gets the batch size of the given inputs if they only differ from the network inputs by their first dimension,
+    // and m_BatchSize otherwise.
+    unsigned int GetRequestedBatchSize(const InputTensors& inputTensors) const;
+
+    // Gets the network prepared for the given batch size, preparing it if it is not among m_BatchNetworks.
+    std::shared_ptr<LoadedNetwork> GetBatchNetwork(unsigned int batchSize);
+
+    // A caller-owned buffer bound to an input or output of the network by ImportInputs() or ImportOutputs().
+    struct ImportedTensor
+    {
+        LayerBindingId m_BindingId;
+        void* m_Memory;
+
+        // The network tensor that aliases m_Memory during executions, when it can.
+        ITensorHandle* m_NetworkTensorHandle;
+
+        // Wraps m_Memory, and copies between it and m_NetworkTensorHandle when the latter cannot alias it.
+        std::unique_ptr<ITensorHandle> m_TensorHandle;
+        std::unique_ptr<IWorkload> m_CopyWorkload;
+    };
+
+    const ImportedTensor* FindImportedTensor(const std::vector<ImportedTensor>& importedTensors,
+                                             const std::vector<unsigned int>& importedIds,
+                                             LayerBindingId bindingId) const;
+
     using BackendPtrMap = std::unordered_map<BackendId, IBackendInternalUniquePtr>;
 
     using WorkloadFactoryWithMemoryManager =
@@ -78,11 +147,41 @@ private:
     WorkloadQueue m_InputQueue;
     WorkloadQueue m_WorkloadQueue;
     WorkloadQueue m_OutputQueue;
+
+    // Copy workloads of the imported tensors used by the current execution that could not be aliased.
+    std::vector<IWorkload*> m_PreImportedInputQueue;
+    std::vector<IWorkload*> m_PreImportedOutputQueue;
+
+    std::vector<ImportedTensor> m_ImportedInputs;
+    std::vector<ImportedTensor> m_ImportedOutputs;
     std::shared_ptr<Profiler> m_Profiler;
 
+    // The layer each entry of m_WorkloadQueue was created for.
+    std::vector<const Layer*> m_WorkloadLayers;
+
+    // Set when independent workloads run concurrently.
+    std::unique_ptr<WorkloadScheduler> m_WorkloadScheduler;
+
     mutable std::mutex m_WorkingMemMutex;
 
+    // Held exclusively by EnqueueWorkload and shared by executions on working memory handles, as the
+    // latter may temporarily rebind the tensors of workloads that cannot run on other tensors natively.
+    std::shared_timed_mutex m_ExecutionMutex;
+
     bool m_IsWorkingMemAllocated=false;
+
+    // Set when inputs may have any batch size: a copy of the graph taken before the constant data of its layers was
+    // released, from which the networks for other batch sizes are prepared.
+    std::unique_ptr<Graph> m_BatchGraph;
+    unsigned int m_BatchSize = 0;
+    std::shared_ptr<ThreadPool> m_InterOpThreadPool;
+
+    // The networks prepared for other batch sizes, most recently used first. Only the MaxBatchNetworks most recently
+    // used are kept: an evicted network lives on until the executions running on it complete.
+    static constexpr size_t MaxBatchNetworks = 8;
+    std::mutex m_BatchNetworksMutex;
+    std::list<std::pair<unsigned int, std::shared_ptr<LoadedNetwork>>> m_BatchNetworks;
+    DebugCallbackFunction m_DebugCallback;
 };
 
 }
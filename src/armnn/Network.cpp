@@ -74,6 +74,11 @@ Status OptimizedNetwork::SerializeToDot(std::ostream& stream) const
     return m_Graph->SerializeToDot(stream);
 }
 
+size_t OptimizedNetwork::GetPeakTensorBytes() const
+{
+    return m_Graph->GetPeakTensorBytes();
+}
+
 struct OptimizationResult
 {
     bool m_Warning;
@@ -309,6 +314,22 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
                           errMessages);
 }
 
+void RunBackendSpecificOptimizations(Graph& optGraph, const BackendIdSet& selectedBackends)
+{
+    for (auto&& chosenBackend : selectedBackends)
+    {
+        auto factoryFun = BackendRegistryInstance().GetFactory(chosenBackend);
+        auto backendPtr = factoryFun();
+        BOOST_ASSERT(backendPtr.get() != nullptr);
+
+        auto backendSpecificOptimizations = backendPtr->GetOptimizations();
+        if (!backendSpecificOptimizations.empty())
+        {
+            Optimizer::Pass(optGraph, backendSpecificOptimizations);
+        }
+    }
+}
+
 OptimizationResult ApplyBackendOptimizations(OptimizedNetwork* optNetObjPtr,
                                              BackendSettings& backendSettings,
                                              Optional<std::vector<std::string>&> errMessages)
@@ -436,11 +457,22 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
                                                 OptimizeInversePermutes(),
                                                 MovePermuteUp(),
                                                 PermuteAsReshape(),
-                                                OptimizeConsecutiveReshapes()));
+                                                OptimizeConsecutiveReshapes(),
+                                                FuseBatchNormIntoConvolution2d(),
+                                                FuseBatchNormIntoDepthwiseConvolution2d()));
 
     // Infer the tensor infos for all output slots. Throws an exception on failure
     optGraph.InferTensorInfos();
 
+    // Precompute the layers whose inputs are all constants, using the reference workloads when they are available
+    BackendRegistry& backendRegistry = BackendRegistryInstance();
+    if (backendRegistry.IsBackendRegistered(Compute::CpuRef))
+    {
+        auto refBackend = backendRegistry.GetFactory(Compute::CpuRef)();
+        std::shared_ptr<IWorkloadFactory> refWorkloadFactory = refBackend->CreateWorkloadFactory();
+        Optimizer::Pass(optGraph, MakeOptimizations(FoldConstants(refWorkloadFactory)));
+    }
+
     // If Fp32 to Fp16 optimization is set convert Fp32 network to Fp16
     if (options.m_ReduceFp32ToFp16)
     {
@@ -499,19 +531,55 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
     Optimizer::Pass(optGraph, MakeOptimizations(ConvertConstantsHalfToFloat()));
 
     // Run backend specific optimizations
-    for (auto&& chosenBackend : backendSettings.m_SelectedBackends)
+    RunBackendSpecificOptimizations(optGraph, backendSettings.m_SelectedBackends);
+
+    // Choose the execution order last, as modifying the graph sorts it by depth again
+    if (options.m_MinimizePeakMemory)
     {
-        auto factoryFun = BackendRegistryInstance().GetFactory(chosenBackend);
-        auto backendPtr = factoryFun();
-        BOOST_ASSERT(backendPtr.get() != nullptr);
+        const size_t depthOrderPeakBytes = optGraph.GetPeakTensorBytes();
+        const size_t peakBytes = optGraph.MemoryAwareTopologicalSort();
+        BOOST_LOG_TRIVIAL(info) << "Optimize: the execution order needs " << peakBytes
+                                << " bytes of tensors at peak, instead of " << depthOrderPeakBytes;
+    }
 
-        auto backendSpecificOptimizations = backendPtr->GetOptimizations();
-        if (!backendSpecificOptimizations.empty())
+    return optNet;
+}
+
+IOptimizedNetworkPtr ImportOptimizedNetwork(const INetwork& inNetwork,
+                                            const IDeviceSpec& deviceSpec,
+                                            Optional<std::vector<std::string>&> errMessages)
+{
+    const Network& network = *boost::polymorphic_downcast<const Network*>(&inNetwork);
+    std::unique_ptr<Graph> graph = std::make_unique<Graph>(network.GetGraph());
+
+    auto optNet = IOptimizedNetworkPtr(new OptimizedNetwork(std::move(graph)), &IOptimizedNetwork::Destroy);
+    Graph& optGraph = boost::polymorphic_downcast<OptimizedNetwork*>(optNet.get())->GetGraph();
+
+    // The backends were assigned when the network was optimized: only checks that they can still run their layers
+    BackendSettings backendSettings(BackendIdVector(), deviceSpec);
+    for (auto&& layer : optGraph)
+    {
+        const BackendId& backend = layer->GetBackendId();
+        std::string reasonIfUnsupported;
+        if (!backendSettings.IsBackendSupported(backend) ||
+            !IWorkloadFactory::IsLayerSupported(backend, *layer, EmptyOptional(), reasonIfUnsupported))
         {
-            Optimizer::Pass(optNetObjPtr->GetGraph(), backendSpecificOptimizations);
+            std::stringstream failureMsg;
+            failureMsg << "Layer of type " << GetLayerTypeAsCString(layer->GetType())
+                       << " is assigned to backend " << backend << ", which cannot run it. " << reasonIfUnsupported;
+            ReportError(failureMsg.str(), errMessages);
+            return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
         }
+        backendSettings.m_SelectedBackends.insert(backend);
     }
 
+    // Checks the tensor infos the network was exported with. Throws an exception on failure
+    optGraph.InferTensorInfos();
+
+    optGraph.AddCopyLayers();
+
+    RunBackendSpecificOptimizations(optGraph, backendSettings.m_SelectedBackends);
+
     return optNet;
 }
 
@@ -520,6 +588,11 @@ Network::Network()
 {
 }
 
+Network::Network(std::unique_ptr<Graph> graph)
+: m_Graph(std::move(graph))
+{
+}
+
 Network::~Network()
 {
 }
@@ -547,11 +620,11 @@ IConnectableLayer* Network::AddFullyConnectedLayerImpl(const FullyConnectedDescr
 
     const auto layer = m_Graph->AddLayer<FullyConnectedLayer>(fullyConnectedDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = CreateConstantHandle(weights);
 
     if (fullyConnectedDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = CreateConstantHandle(biases.value());
     }
 
     return layer;
@@ -596,11 +669,11 @@ IConnectableLayer* Network::AddConvolution2dLayerImpl(const Convolution2dDescrip
 
     const auto layer = m_Graph->AddLayer<Convolution2dLayer>(convolution2dDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = CreateConstantHandle(weights);
 
     if (convolution2dDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = CreateConstantHandle(biases.value());
     }
 
     return layer;
@@ -646,11 +719,11 @@ IConnectableLayer* Network::AddDepthwiseConvolution2dLayerImpl(
 
     const auto layer = m_Graph->AddLayer<DepthwiseConvolution2dLayer>(convolution2dDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = CreateConstantHandle(weights);
 
     if (convolution2dDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = CreateConstantHandle(biases.value());
     }
 
     return layer;
@@ -691,7 +764,7 @@ IConnectableLayer* Network::AddDetectionPostProcessLayer(const armnn::DetectionP
 {
     const auto layer = m_Graph->AddLayer<DetectionPostProcessLayer>(descriptor, name);
 
-    layer->m_Anchors = std::make_unique<ScopedCpuTensorHandle>(anchors);
+    layer->m_Anchors = CreateConstantHandle(anchors);
 
     return layer;
 }
@@ -773,10 +846,10 @@ IConnectableLayer* Network::AddBatchNormalizationLayer(const BatchNormalizationD
 {
     const auto layer = m_Graph->AddLayer<BatchNormalizationLayer>(desc, name);
 
-    layer->m_Mean = std::make_unique<ScopedCpuTensorHandle>(mean);
-    layer->m_Variance = std::make_unique<ScopedCpuTensorHandle>(variance);
-    layer->m_Beta = std::make_unique<ScopedCpuTensorHandle>(beta);
-    layer->m_Gamma = std::make_unique<ScopedCpuTensorHandle>(gamma);
+    layer->m_Mean = CreateConstantHandle(mean);
+    layer->m_Variance = CreateConstantHandle(variance);
+    layer->m_Beta = CreateConstantHandle(beta);
+    layer->m_Gamma = CreateConstantHandle(gamma);
 
     return layer;
 }
@@ -797,7 +870,7 @@ IConnectableLayer* Network::AddConstantLayer(const ConstTensor& input, const cha
 {
     auto layer = m_Graph->AddLayer<ConstantLayer>(name);
 
-    layer->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(input);
+    layer->m_LayerOutput = CreateConstantHandle(input);
 
     return layer;
 }
@@ -827,23 +900,23 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
 
     //Lstm Basic Parameters
     layer->m_BasicParameters.m_InputToForgetWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToForgetWeights));
+        CreateConstantHandle(*(params.m_InputToForgetWeights));
     layer->m_BasicParameters.m_InputToCellWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToCellWeights));
+        CreateConstantHandle(*(params.m_InputToCellWeights));
     layer->m_BasicParameters.m_InputToOutputWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToOutputWeights));
+        CreateConstantHandle(*(params.m_InputToOutputWeights));
     layer->m_BasicParameters.m_RecurrentToForgetWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToForgetWeights));
+        CreateConstantHandle(*(params.m_RecurrentToForgetWeights));
     layer->m_BasicParameters.m_RecurrentToCellWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToCellWeights));
+        CreateConstantHandle(*(params.m_RecurrentToCellWeights));
     layer->m_BasicParameters.m_RecurrentToOutputWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToOutputWeights));
+        CreateConstantHandle(*(params.m_RecurrentToOutputWeights));
     layer->m_BasicParameters.m_ForgetGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_ForgetGateBias));
+            CreateConstantHandle(*(params.m_ForgetGateBias));
     layer->m_BasicParameters.m_CellBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellBias));
+            CreateConstantHandle(*(params.m_CellBias));
     layer->m_BasicParameters.m_OutputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_OutputGateBias));
+            CreateConstantHandle(*(params.m_OutputGateBias));
 
     //Lstm Cifg parameters
     if(!descriptor.m_CifgEnabled)
@@ -862,17 +935,17 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             throw InvalidArgumentException("AddLstmLayer: Input Gate Bias cannot be NULL");
         }
         layer->m_CifgParameters.m_InputToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToInputWeights));
+            CreateConstantHandle(*(params.m_InputToInputWeights));
         layer->m_CifgParameters.m_RecurrentToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToInputWeights));
+            CreateConstantHandle(*(params.m_RecurrentToInputWeights));
         // In the VTS tests, cell-to-input weights may be null, even if the other CIFG params are not.
         if(params.m_CellToInputWeights != nullptr)
         {
             layer->m_CifgParameters.m_CellToInputWeights =
-                    std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToInputWeights));
+                    CreateConstantHandle(*(params.m_CellToInputWeights));
         }
         layer->m_CifgParameters.m_InputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputGateBias));
+            CreateConstantHandle(*(params.m_InputGateBias));
     }
 
     //Lstm projection parameters
@@ -883,11 +956,11 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             throw InvalidArgumentException("AddLstmLayer: Projection Weights cannot be NULL");
         }
         layer->m_ProjectionParameters.m_ProjectionWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_ProjectionWeights));
+            CreateConstantHandle(*(params.m_ProjectionWeights));
         if(params.m_ProjectionBias != nullptr)
         {
             layer->m_ProjectionParameters.m_ProjectionBias =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_ProjectionBias));
+                CreateConstantHandle(*(params.m_ProjectionBias));
         }
     }
 
@@ -903,9 +976,9 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             throw InvalidArgumentException("AddLstmLayer: Cell To Output Weights cannot be NULL");
         }
         layer->m_PeepholeParameters.m_CellToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToForgetWeights));
+            CreateConstantHandle(*(params.m_CellToForgetWeights));
         layer->m_PeepholeParameters.m_CellToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToOutputWeights));
+            CreateConstantHandle(*(params.m_CellToOutputWeights));
     }
     return layer;
 }
@@ -984,6 +1057,34 @@ void Network::Accept(ILayerVisitor& visitor) const
     };
 }
 
+void Network::AddConstantMemory(std::shared_ptr<const void> memory, size_t numBytes)
+{
+    if (!memory)
+    {
+        throw InvalidArgumentException("AddConstantMemory: memory cannot be NULL");
+    }
+    m_ConstantMemory.emplace_back(std::move(memory), numBytes);
+}
+
+std::unique_ptr<ScopedCpuTensorHandle> Network::CreateConstantHandle(const ConstTensor& tensor) const
+{
+    const TensorInfo& info = tensor.GetInfo();
+    const char* data = static_cast<const char*>(tensor.GetMemoryArea());
+    const bool aligned = reinterpret_cast<uintptr_t>(data) % GetDataTypeSize(info.GetDataType()) == 0;
+
+    for (auto&& region : m_ConstantMemory)
+    {
+        const char* begin = static_cast<const char*>(region.first.get());
+        if (aligned && data >= begin && data + tensor.GetNumBytes() <= begin + region.second)
+        {
+            // Shares the ownership of the region, but points to the tensor in it.
+            std::shared_ptr<void> memory(region.first, const_cast<char*>(data));
+            return std::make_unique<ScopedCpuTensorHandle>(info, std::move(memory));
+        }
+    }
+    return std::make_unique<ScopedCpuTensorHandle>(tensor);
+}
+
 OptimizedNetwork::OptimizedNetwork(std::unique_ptr<Graph> graph)
     : m_Graph(std::move(graph))
 {
@@ -993,4 +1094,62 @@ OptimizedNetwork::~OptimizedNetwork()
 {
 }
 
+namespace
+{
+
+/// Moves the activation fused into a layer back into an ActivationLayer of its own, run on the same backend.
+template<typename LayerT>
+void UnfuseActivation(Graph& graph, LayerT& layer)
+{
+    if (!layer.m_FusedActivation.has_value())
+    {
+        return;
+    }
+
+    const std::string name = layer.GetNameStr() + "-activation";
+    auto activation = graph.InsertNewLayer<ActivationLayer>(layer.GetOutputSlot(0),
+                                                            layer.m_FusedActivation.value(),
+                                                            name.c_str());
+    activation->SetBackendId(layer.GetBackendId());
+    activation->GetOutputSlot(0).SetTensorInfo(layer.GetOutputSlot(0).GetTensorInfo());
+    layer.m_FusedActivation = EmptyOptional();
+}
+
+} // anonymous namespace
+
+INetworkPtr OptimizedNetwork::ExportNetwork() const
+{
+    std::unique_ptr<Graph> graph = std::make_unique<Graph>(*m_Graph);
+
+    // Only keeps what INetwork can describe: ImportOptimizedNetwork() adds the copies and the fusions back.
+    const std::vector<Layer*> layers(graph->begin(), graph->end());
+    for (Layer* layer : layers)
+    {
+        switch (layer->GetType())
+        {
+            case LayerType::MemCopy:
+            case LayerType::Debug:
+                layer->GetOutputSlot(0).MoveAllConnections(*layer->GetInputSlot(0).GetConnectedOutputSlot());
+                graph->EraseLayer(layer);
+                break;
+            case LayerType::ConvertFp16ToFp32:
+            case LayerType::ConvertFp32ToFp16:
+                throw InvalidArgumentException("ExportNetwork: networks reduced to Float16 cannot be exported");
+            case LayerType::Convolution2d:
+                UnfuseActivation(*graph, *boost::polymorphic_downcast<Convolution2dLayer*>(layer));
+                break;
+            case LayerType::DepthwiseConvolution2d:
+                UnfuseActivation(*graph, *boost::polymorphic_downcast<DepthwiseConvolution2dLayer*>(layer));
+                break;
+            case LayerType::FullyConnected:
+                UnfuseActivation(*graph, *boost::polymorphic_downcast<FullyConnectedLayer*>(layer));
+                break;
+            default:
+                break;
+        }
+    }
+
+    return INetworkPtr(new Network(std::move(graph)), &INetwork::Destroy);
+}
+
 } // namespace armnn
@@ -20,12 +20,14 @@
 namespace armnn
 {
 class Graph;
+class ScopedCpuTensorHandle;
 
 /// Private implementation of INetwork.
 class Network final : public INetwork
 {
 public:
     Network();
+    explicit Network(std::unique_ptr<Graph> graph);
     ~Network();
 
     const Graph& GetGraph() const { return *m_Graph; }
@@ -180,6 +182,8 @@ public:
 
     void Accept(ILayerVisitor& visitor) const override;
 
+    void AddConstantMemory(std::shared_ptr<const void> memory, size_t numBytes) override;
+
 private:
     IConnectableLayer* AddFullyConnectedLayerImpl(const FullyConnectedDescriptor& fullyConnectedDescriptor,
                                                   const ConstTensor& weights,
@@ -197,7 +201,14 @@ private:
         const Optional<ConstTensor>& biases,
         const char* name);
 
+    /// Creates the handle holding a constant tensor of a layer. The tensor is referenced if it lies, suitably
+    /// aligned, in one of the regions given to AddConstantMemory(), and copied otherwise.
+    std::unique_ptr<ScopedCpuTensorHandle> CreateConstantHandle(const ConstTensor& tensor) const;
+
     std::unique_ptr<Graph> m_Graph;
+
+    /// Regions of memory holding constant tensors that may be referenced by the layers.
+    std::vector<std::pair<std::shared_ptr<const void>, size_t>> m_ConstantMemory;
 };
 
 class OptimizedNetwork final : public IOptimizedNetwork
@@ -209,6 +220,10 @@ public:
     Status PrintGraph() override;
     Status SerializeToDot(std::ostream& stream) const override;
 
+    INetworkPtr ExportNetwork() const override;
+
+    size_t GetPeakTensorBytes() const override;
+
     Graph& GetGraph() { return *m_Graph; }
 
 private:
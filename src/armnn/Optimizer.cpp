@@ -6,9 +6,173 @@
 #include "Observable.hpp"
 #include "optimizations/All.hpp"
 
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
 namespace armnn
 {
 
+namespace
+{
+
+/// The layers left to visit by Optimizer::Pass(), which are visited from the back, i.e. from the outputs up to the
+/// inputs at first. When the optimizations change the graph, only the layers they add and the neighbours of the
+/// layers they erase are pushed again, rather than walking the whole graph again. Erased layers are dropped.
+class Worklist
+{
+public:
+    explicit Worklist(Graph& graph)
+        : m_Graph(graph)
+        , m_AddedLayerObserver(*this)
+        , m_ErasedLayerObserver(*this)
+    {
+        m_Graph.AttachObservable(&m_AddedLayerObserver, GraphEvent::LayerAdded);
+        m_Graph.AttachObservable(&m_ErasedLayerObserver, GraphEvent::LayerErased);
+
+        for (auto&& layer : m_Graph.TopologicalSort())
+        {
+            Push(*layer);
+        }
+    }
+
+    ~Worklist()
+    {
+        m_Graph.DetachObservable(&m_AddedLayerObserver, GraphEvent::LayerAdded);
+        m_Graph.DetachObservable(&m_ErasedLayerObserver, GraphEvent::LayerErased);
+    }
+
+    /// Returns the next layer to visit, or nullptr if there are none left.
+    Layer* Pop()
+    {
+        while (!m_Layers.empty())
+        {
+            Layer* const layer = m_Layers.back();
+            m_Layers.pop_back();
+
+            // Layers erased while in the stack are only removed from the pending ones.
+            if (m_Pending.erase(layer) != 0)
+            {
+                return layer;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Pushes the layers added since the last call, once the optimization which added them has connected them, and
+    /// returns them.
+    std::vector<Layer*> PushAddedLayers()
+    {
+        std::vector<Layer*> addedLayers;
+        addedLayers.swap(m_AddedLayers);
+
+        for (Layer* addedLayer : addedLayers)
+        {
+            UpdatePriorities(*addedLayer);
+            Push(*addedLayer);
+        }
+        return addedLayers;
+    }
+
+private:
+    class AddedLayerObserver : public IGraphObservable
+    {
+    public:
+        explicit AddedLayerObserver(Worklist& worklist) : m_Worklist(worklist) {}
+
+        void Update(Layer* graphLayer) override
+        {
+            m_Worklist.m_AddedLayers.push_back(graphLayer);
+        }
+
+    private:
+        Worklist& m_Worklist;
+    };
+
+    class ErasedLayerObserver : public IGraphObservable
+    {
+    public:
+        explicit ErasedLayerObserver(Worklist& worklist) : m_Worklist(worklist) {}
+
+        void Update(Layer* graphLayer) override
+        {
+            m_Worklist.Erase(*graphLayer);
+        }
+
+    private:
+        Worklist& m_Worklist;
+    };
+
+    void Push(Layer& layer)
+    {
+        if (m_Pending.insert(&layer).second)
+        {
+            m_Layers.push_back(&layer);
+        }
+    }
+
+    /// Called before the layer is deleted, while it's still connected.
+    void Erase(Layer& layer)
+    {
+        m_Pending.erase(&layer);
+        m_AddedLayers.erase(std::remove(m_AddedLayers.begin(), m_AddedLayers.end(), &layer), m_AddedLayers.end());
+
+        // The optimizations may now match around the neighbours of the erased layer.
+        for (auto inputSlot = layer.BeginInputSlots(); inputSlot != layer.EndInputSlots(); ++inputSlot)
+        {
+            if (OutputSlot* parentOut = inputSlot->GetConnectedOutputSlot())
+            {
+                Push(parentOut->GetOwningLayer());
+            }
+        }
+        for (auto&& outputSlot : layer.GetOutputSlots())
+        {
+            for (auto&& connection : outputSlot.GetConnections())
+            {
+                Push(connection->GetOwningLayer());
+            }
+        }
+    }
+
+    /// Keeps the priority of every layer above those of its parents once the given layer has been added, so the
+    /// priorities remain a topological order without sorting the whole graph. Only the priorities downstream of the
+    /// layer which are not above it any more are computed again.
+    static void UpdatePriorities(const Layer& addedLayer)
+    {
+        std::vector<const Layer*> layers = { &addedLayer };
+        while (!layers.empty())
+        {
+            const Layer& layer = *layers.back();
+            layers.pop_back();
+
+            layer.ResetPriority();
+            const LayerPriority priority = layer.GetPriority();
+
+            for (auto&& outputSlot : layer.GetOutputSlots())
+            {
+                for (auto&& connection : outputSlot.GetConnections())
+                {
+                    const Layer& child = connection->GetOwningLayer();
+                    if (child.GetPriority() <= priority)
+                    {
+                        layers.push_back(&child);
+                    }
+                }
+            }
+        }
+    }
+
+    Graph& m_Graph;
+    AddedLayerObserver m_AddedLayerObserver;
+    ErasedLayerObserver m_ErasedLayerObserver;
+
+    std::vector<Layer*> m_Layers;
+    std::unordered_set<const Layer*> m_Pending;
+    std::vector<Layer*> m_AddedLayers;
+};
+
+} // anonymous namespace
+
 Optimizer::Optimizer()
 {
 }
@@ -16,45 +180,40 @@ Optimizer::Optimizer()
 void Optimizer::Pass(Graph& graph, const Optimizations& optimizations)
 {
     // Create observables to observe changes to the graph
-    AddedLayerObservable addedLayerObservable(graph);
     ErasedLayerNamesObservable erasedLayerNamesObservable(graph);
+    Worklist worklist(graph);
 
-    bool graphNeedsSorting = false;
-    auto it = graph.TopologicalSort().end();
-
-    // Calls TopologicalSort() for every iteration to re-order the list in case layers were added/removed.
-    while (it != graph.TopologicalSort().begin())
+    while (Layer* layer = worklist.Pop())
     {
-        --it;
         for (auto&& optimization : optimizations)
         {
-            optimization->Run(graph, **it);
+            optimization->Run(graph, *layer);
 
-            if ((*it)->IsOutputUnconnected())
+            if (layer->IsOutputUnconnected())
             {
-                it = graph.EraseLayer(it);
-                graphNeedsSorting = true;
+                graph.EraseLayer(layer);
             }
 
             // Add the names of erased layers as related layers to the new added layers
-            for (auto& erasedLayerName : erasedLayerNamesObservable)
+            for (auto& addedLayer : worklist.PushAddedLayers())
             {
-                for (auto& addedLayer : addedLayerObservable)
+                for (auto& erasedLayerName : erasedLayerNamesObservable)
                 {
                     addedLayer->AddRelatedLayerName(erasedLayerName);
                 }
             }
 
             erasedLayerNamesObservable.Clear();
-            addedLayerObservable.Clear();
 
-            if (graphNeedsSorting)
+            if (layer == nullptr)
             {
-                graphNeedsSorting = false;
                 break;
             }
         }
     }
+
+    // Layers added by AddLayer() are only moved into place here, rather than after every optimization.
+    graph.TopologicalSort();
 }
 
 } // namespace armnn
@@ -6,6 +6,7 @@
 
 #include <armnn/BackendId.hpp>
 
+#include "ChromeTracePrinter.hpp"
 #include "JsonPrinter.hpp"
 
 #if ARMNN_STREAMLINE_ENABLED
@@ -13,10 +14,12 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 #include <fstream>
 #include <map>
+#include <numeric>
 #include <stack>
 
 #include <boost/algorithm/string.hpp>
@@ -107,6 +110,56 @@ std::map<std::string, Profiler::ProfilingEventStats> Profiler::CalculateProfilin
     return nameToStatsMap;
 }
 
+// Gets the value at the given percentile of the given values, using the nearest-rank method. Reorders the values.
+double FindPercentile(std::vector<double>& values, double percentile)
+{
+    BOOST_ASSERT(!values.empty());
+    const double rank = std::ceil(percentile / 100.0 * static_cast<double>(values.size()));
+    const size_t index = std::max<size_t>(static_cast<size_t>(rank), 1) - 1;
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+    return values[index];
+}
+
+std::vector<EventStatistics> Profiler::GetEventStatistics() const
+{
+    std::map<std::string, std::vector<double>> nameToDurationsMap;
+    if (m_RingBuffer)
+    {
+        for (const ProfilingRingBuffer::Record& record : m_RingBuffer->GetRecords())
+        {
+            const double durationMs = static_cast<double>(record.m_StopNs - record.m_StartNs) / 1000000.0;
+            nameToDurationsMap[m_RingBuffer->GetLabel(record.m_LabelId)].push_back(durationMs);
+        }
+    }
+    else
+    {
+        for (const auto& event : m_EventSequence)
+        {
+            const Measurement measurement = FindMeasurement(WallClockTimer::WALL_CLOCK_TIME, event.get());
+            nameToDurationsMap[event->GetName()].push_back(measurement.m_Value);
+        }
+    }
+
+    std::vector<EventStatistics> statistics;
+    statistics.reserve(nameToDurationsMap.size());
+    for (auto& pair : nameToDurationsMap)
+    {
+        std::vector<double>& durationsMs = pair.second;
+
+        EventStatistics eventStatistics;
+        eventStatistics.m_Name   = pair.first;
+        eventStatistics.m_Count  = static_cast<unsigned int>(durationsMs.size());
+        eventStatistics.m_MeanMs = std::accumulate(durationsMs.begin(), durationsMs.end(), 0.0) /
+                                   static_cast<double>(durationsMs.size());
+        eventStatistics.m_MinMs  = *std::min_element(durationsMs.begin(), durationsMs.end());
+        eventStatistics.m_MaxMs  = *std::max_element(durationsMs.begin(), durationsMs.end());
+        eventStatistics.m_P50Ms  = FindPercentile(durationsMs, 50.0);
+        eventStatistics.m_P99Ms  = FindPercentile(durationsMs, 99.0);
+        statistics.push_back(std::move(eventStatistics));
+    }
+    return statistics;
+}
+
 const Event* GetEventPtr(const Event* ptr) { return ptr;}
 const Event* GetEventPtr(const std::unique_ptr<Event>& ptr) {return ptr.get(); }
 
@@ -197,6 +250,12 @@ void Profiler::EnableProfiling(bool enableProfiling)
     m_ProfilingEnabled = enableProfiling;
 }
 
+void Profiler::EnableRingBufferProfiling(unsigned int capacity)
+{
+    BOOST_ASSERT_MSG(m_Parents.empty(), "Cannot switch profiling mode while events are being recorded");
+    m_RingBuffer = capacity > 0 ? std::make_unique<ProfilingRingBuffer>(capacity) : nullptr;
+}
+
 Event* Profiler::BeginEvent(const BackendId& backendId,
                             const std::string& label,
                             std::vector<InstrumentPtr>&& instruments)
@@ -387,8 +446,81 @@ void Profiler::Print(std::ostream& outStream) const
     outStream.precision(oldPrecision);
 }
 
+void Profiler::WriteChromeTrace(std::ostream& outStream) const
+{
+    // Makes sure timestamps are output in microseconds with 3 decimals, and save old settings.
+    std::streamsize oldPrecision = outStream.precision();
+    outStream.precision(3);
+    std::ios_base::fmtflags oldFlags = outStream.flags();
+    outStream.setf(std::ios::fixed);
+    ChromeTracePrinter printer(outStream);
+
+    printer.PrintHeader();
+    if (m_RingBuffer)
+    {
+        for (const ProfilingRingBuffer::Record& record : m_RingBuffer->GetRecords())
+        {
+            printer.PrintEvent(m_RingBuffer->GetLabel(record.m_LabelId), "", record.m_ThreadId,
+                               static_cast<double>(record.m_StartNs) / 1000.0,
+                               static_cast<double>(record.m_StopNs - record.m_StartNs) / 1000.0, {});
+        }
+    }
+    else
+    {
+        for (const auto& event : m_EventSequence)
+        {
+            // Events are placed on the timeline by their wall clock times, the other measurements become arguments.
+            std::vector<Measurement> measurements = event->GetMeasurements();
+            auto IsWallClockMeasurement = [](const Measurement& measurement)
+            {
+                return measurement.m_Name.rfind(WallClockTimer::WALL_CLOCK_TIME, 0) == 0;
+            };
+            auto start = std::find_if(measurements.begin(), measurements.end(), [](const Measurement& measurement)
+            {
+                return measurement.m_Name == WallClockTimer::WALL_CLOCK_TIME_START;
+            });
+            auto duration = std::find_if(measurements.begin(), measurements.end(), [](const Measurement& measurement)
+            {
+                return measurement.m_Name == WallClockTimer::WALL_CLOCK_TIME;
+            });
+            if (start == measurements.end() || duration == measurements.end())
+            {
+                continue;
+            }
+
+            const double startUs = ChromeTracePrinter::ToMicroseconds(*start);
+            const double durationUs = ChromeTracePrinter::ToMicroseconds(*duration);
+            measurements.erase(std::remove_if(measurements.begin(), measurements.end(), IsWallClockMeasurement),
+                               measurements.end());
+
+            printer.PrintEvent(event->GetName(), event->GetBackendId().Get(), event->GetThreadId(),
+                               startUs, durationUs, measurements);
+        }
+    }
+    printer.PrintFooter();
+
+    // Restores previous precision settings.
+    outStream.flags(oldFlags);
+    outStream.precision(oldPrecision);
+}
+
 void Profiler::AnalyzeEventsAndWriteResults(std::ostream& outStream) const
 {
+    // Only the aggregated stats are available in ring buffer mode.
+    if (m_RingBuffer)
+    {
+        outStream << "Event Stats - Name | Avg (ms) | Min (ms) | Max (ms) | P50 (ms) | P99 (ms) | Count" << std::endl;
+        for (const EventStatistics& eventStats : GetEventStatistics())
+        {
+            outStream << "\t" << std::setw(50) << eventStats.m_Name << " " << std::setw(9) << eventStats.m_MeanMs << " "
+                << std::setw(9) << eventStats.m_MinMs << " " << std::setw(9) << eventStats.m_MaxMs << " "
+                << std::setw(9) << eventStats.m_P50Ms << " " << std::setw(9) << eventStats.m_P99Ms << " "
+                << std::setw(9) << eventStats.m_Count << std::endl;
+        }
+        outStream << std::endl;
+        return;
+    }
+
     // Stack should be empty now.
     const bool saneMarkerSequence = m_Parents.empty();
 
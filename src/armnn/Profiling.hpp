@@ -5,12 +5,14 @@
 #pragma once
 
 #include "ProfilingEvent.hpp"
+#include "ProfilingRingBuffer.hpp"
 
 #include "armnn/ArmNN.hpp"
 #include "armnn/IProfiler.hpp"
 
 #include "WallClockTimer.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <iosfwd>
 #include <ctime>
@@ -26,6 +28,8 @@ namespace armnn
 // Simple single-threaded profiler.
 // Tracks events reported by BeginEvent()/EndEvent() and outputs detailed information and stats when
 // Profiler::AnalyzeEventsAndWriteResults() is called.
+// In ring buffer mode, events are instead recorded by ScopedProfilingEvent into a bounded ProfilingRingBuffer,
+// which may be done from several threads at once.
 class Profiler final : public IProfiler
 {
 public:
@@ -46,6 +50,12 @@ public:
     // Checks if profiling is enabled.
     bool IsProfilingEnabled() override;
 
+    // Switches to recording events in a ring buffer of the given capacity, or back to the default mode if 0.
+    void EnableRingBufferProfiling(unsigned int capacity) override;
+
+    // Gets the ring buffer events are recorded into, or nullptr if not in ring buffer mode.
+    ProfilingRingBuffer* GetRingBuffer() { return m_RingBuffer.get(); }
+
     // Increments the event tag, allowing grouping of events in a user-defined manner (e.g. per inference).
     void UpdateEventTag();
 
@@ -56,6 +66,12 @@ public:
     // Print stats for events in JSON Format to the given output stream.
     void Print(std::ostream& outStream) const override;
 
+    // Writes the events in the Chrome Trace Event format to the given output stream.
+    void WriteChromeTrace(std::ostream& outStream) const override;
+
+    // Aggregates the durations of the recorded events per event name.
+    std::vector<EventStatistics> GetEventStatistics() const override;
+
     // Gets the color to render an event with, based on which device it denotes.
     uint32_t GetEventColor(const BackendId& backendId) const;
 
@@ -83,7 +99,8 @@ private:
 
     std::stack<Event*> m_Parents;
     std::vector<EventPtr> m_EventSequence;
-    bool m_ProfilingEnabled;
+    std::atomic<bool> m_ProfilingEnabled;
+    std::unique_ptr<ProfilingRingBuffer> m_RingBuffer;
 
 private:
     // Friend functions for unit testing, see ProfilerTests.cpp.
@@ -116,13 +133,26 @@ class ScopedProfilingEvent
 public:
     using InstrumentPtr = std::unique_ptr<Instrument>;
 
-    template<typename... Args>
-    ScopedProfilingEvent(const BackendId& backendId, const std::string& name, Args... args)
+    // The name is either a string literal, interned by address in ring buffer mode, or a std::string.
+    template<typename Name, typename... Args>
+    ScopedProfilingEvent(const BackendId& backendId, const Name& name, Args... args)
         : m_Event(nullptr)
         , m_Profiler(ProfilerManager::GetInstance().GetProfiler())
+        , m_RingBuffer(nullptr)
+        , m_LabelId(ProfilingRingBuffer::InvalidLabelId)
+        , m_StartNs(0)
     {
         if (m_Profiler && m_Profiler->IsProfilingEnabled())
         {
+            m_RingBuffer = m_Profiler->GetRingBuffer();
+            if (m_RingBuffer)
+            {
+                // Only the wall clock time is recorded in ring buffer mode, the instruments are ignored.
+                m_LabelId = m_RingBuffer->InternLabel(name);
+                m_StartNs = ProfilingRingBuffer::Now();
+                return;
+            }
+
             std::vector<InstrumentPtr> instruments(0);
             instruments.reserve(sizeof...(args)); //One allocation
             ConstructNextInVector(instruments, args...);
@@ -132,7 +162,11 @@ public:
 
     ~ScopedProfilingEvent()
     {
-        if (m_Profiler && m_Event)
+        if (m_RingBuffer)
+        {
+            m_RingBuffer->Push(m_LabelId, m_StartNs, ProfilingRingBuffer::Now());
+        }
+        else if (m_Profiler && m_Event)
         {
             m_Profiler->EndEvent(m_Event);
         }
@@ -154,6 +188,9 @@ private:
 
     Event* m_Event;       ///< Event to track
     Profiler* m_Profiler; ///< Profiler used
+    ProfilingRingBuffer* m_RingBuffer; ///< Ring buffer the event is recorded into, in ring buffer mode
+    uint32_t m_LabelId;   ///< Interned name of the event, in ring buffer mode
+    uint64_t m_StartNs;   ///< Start time of the event, in ring buffer mode
 };
 
 } // namespace armnn
@@ -6,8 +6,18 @@
 #include "Profiling.hpp"
 #include "ProfilingEvent.hpp"
 
+#include <atomic>
+
 namespace armnn
 {
+
+uint32_t GetProfilingThreadId()
+{
+    static std::atomic<uint32_t> s_NextThreadId(0);
+    thread_local uint32_t tl_ThreadId = s_NextThreadId++;
+    return tl_ThreadId;
+}
+
 Event::Event(const std::string& eventName,
              Profiler* profiler,
              Event* parent,
@@ -17,6 +27,7 @@ Event::Event(const std::string& eventName,
     , m_Profiler(profiler)
     , m_Parent(parent)
     , m_BackendId(backendId)
+    , m_ThreadId(GetProfilingThreadId())
     , m_Instruments(std::move(instruments))
 {
 }
@@ -26,6 +37,7 @@ Event::Event(Event&& other) noexcept
     , m_Profiler(other.m_Profiler)
     , m_Parent(other.m_Parent)
     , m_BackendId(other.m_BackendId)
+    , m_ThreadId(other.m_ThreadId)
     , m_Instruments(std::move(other.m_Instruments))
 
 {
@@ -84,6 +96,11 @@ BackendId Event::GetBackendId() const
     return m_BackendId;
 }
 
+uint32_t Event::GetThreadId() const
+{
+    return m_ThreadId;
+}
+
 Event& Event::operator=(Event&& other) noexcept
 {
     if (this == &other)
@@ -95,6 +112,7 @@ Event& Event::operator=(Event&& other) noexcept
     m_Profiler = other.m_Profiler;
     m_Parent = other.m_Parent;
     m_BackendId = other.m_BackendId;
+    m_ThreadId = other.m_ThreadId;
     other.m_Profiler = nullptr;
     other.m_Parent = nullptr;
     return *this;
@@ -18,6 +18,10 @@ namespace armnn
 /// Forward declaration
 class Profiler;
 
+/// Gets a small number identifying the calling thread in profiling results, assigned on first use
+/// \return Id of the calling thread
+uint32_t GetProfilingThreadId();
+
 /// Event class records measurements reported by BeginEvent()/EndEvent() and returns measurements when
 /// Event::GetMeasurements() is called.
 class Event
@@ -66,6 +70,10 @@ public:
     /// \return Backend id of the event
     BackendId GetBackendId() const;
 
+    /// Get the id of the thread the event was created on, see GetProfilingThreadId()
+    /// \return Thread id of the event
+    uint32_t GetThreadId() const;
+
     /// Assignment operator
     Event& operator=(const Event& other) = delete;
 
@@ -85,6 +93,9 @@ private:
     /// Backend id
     BackendId m_BackendId;
 
+    /// Id of the thread the event was created on
+    uint32_t m_ThreadId;
+
     /// Instruments to use
     Instruments m_Instruments;
 };
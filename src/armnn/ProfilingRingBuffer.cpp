@@ -0,0 +1,150 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "ProfilingRingBuffer.hpp"
+
+#include "ProfilingEvent.hpp"
+#include "WallClockTimer.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/assert.hpp>
+
+namespace armnn
+{
+
+namespace
+{
+
+uint64_t RoundUpToPowerOfTwo(uint64_t value)
+{
+    uint64_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+// Spreads the label addresses over the label table (literals are usually close to each other in memory).
+uint32_t HashLabel(const char* label)
+{
+    const uint64_t address = reinterpret_cast<uintptr_t>(label);
+    return static_cast<uint32_t>((address * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+} // anonymous namespace
+
+ProfilingRingBuffer::ProfilingRingBuffer(unsigned int capacity)
+    : m_Mask(RoundUpToPowerOfTwo(capacity) - 1)
+    , m_NumPushed(0)
+    , m_Labels(std::make_unique<std::atomic<const char*>[]>(MaxNumLabels))
+{
+    if (capacity == 0)
+    {
+        throw InvalidArgumentException("ProfilingRingBuffer: the capacity must not be zero");
+    }
+
+    m_Slots = std::make_unique<Slot[]>(m_Mask + 1);
+    for (uint64_t i = 0; i <= m_Mask; ++i)
+    {
+        m_Slots[i].m_Sequence.store(0, std::memory_order_relaxed);
+    }
+    for (uint32_t i = 0; i < MaxNumLabels; ++i)
+    {
+        m_Labels[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+uint32_t ProfilingRingBuffer::InternLabel(const char* label)
+{
+    BOOST_ASSERT(label != nullptr);
+    static_assert((MaxNumLabels & (MaxNumLabels - 1)) == 0, "The label table is indexed with a mask");
+
+    // Open addressing with linear probing: entries are never removed, so a label is either found on its probe
+    // sequence before the first free entry, or claims that entry.
+    const uint32_t hash = HashLabel(label);
+    for (uint32_t probe = 0; probe < MaxNumLabels; ++probe)
+    {
+        const uint32_t labelId = (hash + probe) & (MaxNumLabels - 1);
+        const char* entry = m_Labels[labelId].load(std::memory_order_acquire);
+        if (entry == nullptr &&
+            m_Labels[labelId].compare_exchange_strong(entry, label, std::memory_order_acq_rel))
+        {
+            return labelId;
+        }
+        if (entry == label)
+        {
+            return labelId;
+        }
+    }
+    return InvalidLabelId;
+}
+
+uint32_t ProfilingRingBuffer::InternLabel(const std::string& label)
+{
+    std::lock_guard<std::mutex> lock(m_CopiedLabelsMutex);
+    return InternLabel(m_CopiedLabels.insert(label).first->c_str());
+}
+
+const char* ProfilingRingBuffer::GetLabel(uint32_t labelId) const
+{
+    return labelId < MaxNumLabels ? m_Labels[labelId].load(std::memory_order_acquire) : nullptr;
+}
+
+uint64_t ProfilingRingBuffer::Now()
+{
+    return static_cast<uint64_t>(monotonic_clock_raw::now().time_since_epoch().count());
+}
+
+void ProfilingRingBuffer::Push(uint32_t labelId, uint64_t startNs, uint64_t stopNs)
+{
+    if (labelId == InvalidLabelId)
+    {
+        return;
+    }
+
+    const uint64_t sequence = m_NumPushed.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = m_Slots[sequence & m_Mask];
+
+    slot.m_Sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.m_LabelId.store(labelId, std::memory_order_relaxed);
+    slot.m_ThreadId.store(GetProfilingThreadId(), std::memory_order_relaxed);
+    slot.m_StartNs.store(startNs, std::memory_order_relaxed);
+    slot.m_StopNs.store(stopNs, std::memory_order_relaxed);
+    slot.m_Sequence.store(sequence + 1, std::memory_order_release);
+}
+
+std::vector<ProfilingRingBuffer::Record> ProfilingRingBuffer::GetRecords() const
+{
+    const uint64_t numPushed = m_NumPushed.load(std::memory_order_acquire);
+    const uint64_t first = numPushed > m_Mask ? numPushed - m_Mask - 1 : 0;
+
+    std::vector<Record> records;
+    records.reserve(numPushed - first);
+    for (uint64_t sequence = first; sequence < numPushed; ++sequence)
+    {
+        const Slot& slot = m_Slots[sequence & m_Mask];
+        if (slot.m_Sequence.load(std::memory_order_acquire) != sequence + 1)
+        {
+            continue;
+        }
+
+        Record record;
+        record.m_LabelId  = slot.m_LabelId.load(std::memory_order_relaxed);
+        record.m_ThreadId = slot.m_ThreadId.load(std::memory_order_relaxed);
+        record.m_StartNs  = slot.m_StartNs.load(std::memory_order_relaxed);
+        record.m_StopNs   = slot.m_StopNs.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.m_Sequence.load(std::memory_order_relaxed) == sequence + 1)
+        {
+            records.push_back(record);
+        }
+    }
+    return records;
+}
+
+} // namespace armnn
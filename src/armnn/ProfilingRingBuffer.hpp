@@ -0,0 +1,85 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+
+// Fixed-size store of the most recent profiling events, cheap enough to keep profiling enabled permanently.
+// Each event is a compact record made of an interned label id, the id of the thread it ran on and its start/stop
+// times, taken with monotonic_clock_raw. Recording neither allocates nor locks, and may happen concurrently on any
+// number of threads. Once the buffer is full, the oldest records are overwritten.
+class ProfilingRingBuffer
+{
+public:
+    struct Record
+    {
+        uint32_t m_LabelId;
+        uint32_t m_ThreadId;
+        uint64_t m_StartNs;
+        uint64_t m_StopNs;
+    };
+
+    // Maximum number of distinct labels, events with labels beyond it are dropped.
+    static constexpr uint32_t MaxNumLabels = 1024;
+    static constexpr uint32_t InvalidLabelId = MaxNumLabels;
+
+    // The capacity is rounded up to the next power of two.
+    explicit ProfilingRingBuffer(unsigned int capacity);
+
+    unsigned int GetCapacity() const { return static_cast<unsigned int>(m_Mask + 1); }
+
+    // Gets the id of the given label, which is interned by address: it must outlive the buffer (e.g. a literal).
+    // Returns InvalidLabelId when the label table is full.
+    uint32_t InternLabel(const char* label);
+
+    // Same as above for labels built at runtime: a copy of the label is kept, looked up with a lock.
+    uint32_t InternLabel(const std::string& label);
+
+    // Gets the label interned with the given id.
+    const char* GetLabel(uint32_t labelId) const;
+
+    // Current time in nanoseconds, on the clock used for the records.
+    static uint64_t Now();
+
+    // Records an event of the calling thread, overwriting the oldest one if the buffer is full.
+    void Push(uint32_t labelId, uint64_t startNs, uint64_t stopNs);
+
+    // Copies the records currently held, oldest first. Records still being written are skipped.
+    std::vector<Record> GetRecords() const;
+
+    // Number of events recorded since the buffer was created, including the overwritten ones.
+    uint64_t GetNumPushed() const { return m_NumPushed.load(std::memory_order_relaxed); }
+
+private:
+    // A slot holds a record together with the sequence number (plus one) of the event written into it.
+    // The sequence is cleared while the slot is written, so readers can detect and skip torn records.
+    struct Slot
+    {
+        std::atomic<uint64_t> m_Sequence;
+        std::atomic<uint32_t> m_LabelId;
+        std::atomic<uint32_t> m_ThreadId;
+        std::atomic<uint64_t> m_StartNs;
+        std::atomic<uint64_t> m_StopNs;
+    };
+
+    std::unique_ptr<Slot[]> m_Slots;
+    uint64_t m_Mask;
+    std::atomic<uint64_t> m_NumPushed;
+    std::unique_ptr<std::atomic<const char*>[]> m_Labels;
+
+    std::mutex m_CopiedLabelsMutex;
+    std::set<std::string> m_CopiedLabels;
+};
+
+} // namespace armnn
@@ -0,0 +1,313 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RequestBatcher.hpp"
+
+#include <boost/log/trivial.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Whether the two tensors hold items of the same type and shape, possibly in batches of different sizes.
+bool HaveSameItems(const TensorInfo& first, const TensorInfo& second)
+{
+    const TensorShape& firstShape = first.GetShape();
+    const TensorShape& secondShape = second.GetShape();
+    if (firstShape.GetNumDimensions() != secondShape.GetNumDimensions() ||
+        first.GetDataType() != second.GetDataType() ||
+        first.GetQuantizationScale() != second.GetQuantizationScale() ||
+        first.GetQuantizationOffset() != second.GetQuantizationOffset())
+    {
+        return false;
+    }
+    for (unsigned int i = 1; i < firstShape.GetNumDimensions(); ++i)
+    {
+        if (firstShape[i] != secondShape[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Tensors>
+bool HaveSameItems(const Tensors& first, const Tensors& second)
+{
+    if (first.size() != second.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < first.size(); ++i)
+    {
+        if (first[i].first != second[i].first || !HaveSameItems(first[i].second.GetInfo(), second[i].second.GetInfo()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Tensors>
+bool HaveBatchSize(const Tensors& tensors, unsigned int batchSize)
+{
+    return std::all_of(tensors.begin(), tensors.end(), [batchSize](const typename Tensors::value_type& tensor)
+    {
+        const TensorShape& shape = tensor.second.GetShape();
+        return shape.GetNumDimensions() != 0 && shape[0] == batchSize;
+    });
+}
+
+TensorInfo WithBatchSize(const TensorInfo& tensorInfo, unsigned int batchSize)
+{
+    TensorShape shape = tensorInfo.GetShape();
+    shape[0] = batchSize;
+
+    TensorInfo batchInfo = tensorInfo;
+    batchInfo.SetShape(shape);
+    return batchInfo;
+}
+
+} // anonymous namespace
+
+RequestBatcher::RequestBatcher(ExecuteFunction execute,
+                               unsigned int maxBatchSize,
+                               std::chrono::microseconds batchTimeout,
+                               unsigned int numThreads)
+    : m_Execute(std::move(execute))
+    , m_MaxBatchSize(std::max(maxBatchSize, 1u))
+    , m_BatchTimeout(batchTimeout)
+    , m_Stop(false)
+    , m_Collecting(false)
+{
+    numThreads = std::max(numThreads, 1u);
+    m_Threads.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        m_Threads.emplace_back(&RequestBatcher::Run, this);
+    }
+}
+
+RequestBatcher::~RequestBatcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_Condition.notify_all();
+    for (auto& thread : m_Threads)
+    {
+        thread.join();
+    }
+}
+
+void RequestBatcher::Push(NetworkId networkId,
+                          const InputTensors& inputTensors,
+                          const OutputTensors& outputTensors,
+                          CompletionCallback callback)
+{
+    Request request;
+    request.m_NetworkId = networkId;
+    request.m_InputTensors = inputTensors;
+    request.m_OutputTensors = outputTensors;
+    request.m_Callback = std::move(callback);
+    request.m_SubmitTime = std::chrono::steady_clock::now();
+
+    request.m_BatchSize = 0;
+    if (!inputTensors.empty() && inputTensors[0].second.GetShape().GetNumDimensions() != 0)
+    {
+        const unsigned int batchSize = inputTensors[0].second.GetShape()[0];
+        if (HaveBatchSize(inputTensors, batchSize) && HaveBatchSize(outputTensors, batchSize))
+        {
+            request.m_BatchSize = batchSize;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Requests.push_back(std::move(request));
+    }
+    // Wakes the thread forming a batch as well as an idle one.
+    m_Condition.notify_all();
+}
+
+void RequestBatcher::Run()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        m_Condition.wait(lock, [this] { return !m_Collecting && (m_Stop || !m_Requests.empty()); });
+        if (m_Requests.empty())
+        {
+            return;
+        }
+
+        // The oldest request opens the batch, which the following requests join until it is full, a request that
+        // cannot join is queued or the oldest one has waited for long enough. Pending requests are not held back once
+        // the batcher is stopping.
+        Batch batch;
+        batch.push_back(std::move(m_Requests.front()));
+        m_Requests.pop_front();
+
+        unsigned int batchSize = batch.front().m_BatchSize;
+        if (batchSize != 0)
+        {
+            m_Collecting = true;
+            const auto deadline = batch.front().m_SubmitTime + m_BatchTimeout;
+            TakeCompatibleRequests(batch, batchSize);
+            while (batchSize < m_MaxBatchSize && m_Requests.empty() && !m_Stop &&
+                   std::chrono::steady_clock::now() < deadline)
+            {
+                m_Condition.wait_until(lock, deadline);
+                TakeCompatibleRequests(batch, batchSize);
+            }
+            m_Collecting = false;
+        }
+
+        // Another thread can start on the next requests while this one executes the batch.
+        lock.unlock();
+        m_Condition.notify_all();
+        Execute(batch);
+        lock.lock();
+    }
+}
+
+void RequestBatcher::TakeCompatibleRequests(Batch& batch, unsigned int& batchSize)
+{
+    // Stops at the first request that cannot join, so that it is not overtaken by later ones.
+    while (!m_Requests.empty())
+    {
+        // Adding to the batch may move its requests.
+        const Request& first = batch.front();
+        const Request& next = m_Requests.front();
+        if (next.m_NetworkId != first.m_NetworkId ||
+            next.m_BatchSize == 0 ||
+            batchSize + next.m_BatchSize > m_MaxBatchSize ||
+            !HaveSameItems(next.m_InputTensors, first.m_InputTensors) ||
+            !HaveSameItems(next.m_OutputTensors, first.m_OutputTensors))
+        {
+            return;
+        }
+
+        batchSize += next.m_BatchSize;
+        batch.push_back(std::move(m_Requests.front()));
+        m_Requests.pop_front();
+    }
+}
+
+void RequestBatcher::Execute(Batch& batch) const
+{
+    if (batch.size() == 1)
+    {
+        Execute(batch.front());
+        return;
+    }
+
+    const Request& first = batch.front();
+    unsigned int batchSize = 0;
+    for (const Request& request : batch)
+    {
+        batchSize += request.m_BatchSize;
+    }
+
+    // Concatenating tensors along their first dimension lays out their data one after the other.
+    std::vector<std::vector<uint8_t>> inputData(first.m_InputTensors.size());
+    InputTensors inputTensors;
+    for (size_t i = 0; i < first.m_InputTensors.size(); ++i)
+    {
+        const TensorInfo tensorInfo = WithBatchSize(first.m_InputTensors[i].second.GetInfo(), batchSize);
+        inputData[i].reserve(tensorInfo.GetNumBytes());
+        for (const Request& request : batch)
+        {
+            const ConstTensor& tensor = request.m_InputTensors[i].second;
+            const uint8_t* data = static_cast<const uint8_t*>(tensor.GetMemoryArea());
+            inputData[i].insert(inputData[i].end(), data, data + tensor.GetNumBytes());
+        }
+        inputTensors.emplace_back(first.m_InputTensors[i].first, ConstTensor(tensorInfo, inputData[i].data()));
+    }
+
+    std::vector<std::vector<uint8_t>> outputData(first.m_OutputTensors.size());
+    OutputTensors outputTensors;
+    for (size_t i = 0; i < first.m_OutputTensors.size(); ++i)
+    {
+        const TensorInfo tensorInfo = WithBatchSize(first.m_OutputTensors[i].second.GetInfo(), batchSize);
+        outputData[i].resize(tensorInfo.GetNumBytes());
+        outputTensors.emplace_back(first.m_OutputTensors[i].first, Tensor(tensorInfo, outputData[i].data()));
+    }
+
+    Status status = Status::Failure;
+    try
+    {
+        status = m_Execute(first.m_NetworkId, inputTensors, outputTensors);
+    }
+    catch (const std::exception& error)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "RequestBatcher: failed to execute a batch of " << batch.size()
+                                   << " requests, executing them separately: " << error.what();
+    }
+
+    if (status != Status::Success)
+    {
+        // For instance if the network cannot change its batch size.
+        for (Request& request : batch)
+        {
+            Execute(request);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < outputData.size(); ++i)
+    {
+        size_t offset = 0;
+        for (const Request& request : batch)
+        {
+            const Tensor& tensor = request.m_OutputTensors[i].second;
+            std::memcpy(tensor.GetMemoryArea(), outputData[i].data() + offset, tensor.GetNumBytes());
+            offset += tensor.GetNumBytes();
+        }
+    }
+
+    for (const Request& request : batch)
+    {
+        Complete(request, Status::Success);
+    }
+}
+
+void RequestBatcher::Execute(Request& request) const
+{
+    Status status = Status::Failure;
+    try
+    {
+        status = m_Execute(request.m_NetworkId, request.m_InputTensors, request.m_OutputTensors);
+    }
+    catch (const std::exception& error)
+    {
+        BOOST_LOG_TRIVIAL(error) << "RequestBatcher: failed to execute a request: " << error.what();
+    }
+    Complete(request, status);
+}
+
+void RequestBatcher::Complete(const Request& request, Status status)
+{
+    try
+    {
+        request.m_Callback(status);
+    }
+    catch (const std::exception& error)
+    {
+        BOOST_LOG_TRIVIAL(error) << "RequestBatcher: completion callback threw: " << error.what();
+    }
+    catch (...)
+    {
+        BOOST_LOG_TRIVIAL(error) << "RequestBatcher: completion callback threw an unknown exception";
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,91 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+/// Queue of inference requests started in submission order by threads of its own, so that the submitting threads
+/// never wait for them. Consecutive requests for the same network whose tensors only differ by their first dimension,
+/// the batch, are coalesced into a single execution on the concatenation of their tensors. Only consecutive requests
+/// are coalesced, so a request never starts before one submitted earlier. With several threads, requests may complete
+/// out of order.
+class RequestBatcher
+{
+public:
+    using ExecuteFunction = std::function<Status(NetworkId, const InputTensors&, const OutputTensors&)>;
+    using CompletionCallback = std::function<void(Status)>;
+
+    /// @param execute - Evaluates a network, as IRuntime::EnqueueWorkload() does.
+    /// @param maxBatchSize - Largest batch requests are coalesced into. 1 executes each request on its own.
+    /// @param batchTimeout - How long the oldest request of a batch may wait for others to join it.
+    /// @param numThreads - Number of threads executing requests. Batches are formed by one thread at a time.
+    RequestBatcher(ExecuteFunction execute,
+                   unsigned int maxBatchSize,
+                   std::chrono::microseconds batchTimeout,
+                   unsigned int numThreads = 1);
+
+    /// Completes the pending requests before returning.
+    ~RequestBatcher();
+
+    /// Queues a request. The memory of its tensors must stay valid until the callback, which is called on a thread
+    /// of the batcher, has been called. Exceptions thrown by the callback are logged and otherwise ignored.
+    void Push(NetworkId networkId,
+              const InputTensors& inputTensors,
+              const OutputTensors& outputTensors,
+              CompletionCallback callback);
+
+private:
+    struct Request
+    {
+        NetworkId m_NetworkId;
+        InputTensors m_InputTensors;
+        OutputTensors m_OutputTensors;
+        CompletionCallback m_Callback;
+        std::chrono::steady_clock::time_point m_SubmitTime;
+
+        // First dimension of all the tensors of the request, 0 if they differ (the request cannot be coalesced).
+        unsigned int m_BatchSize;
+    };
+
+    using Batch = std::vector<Request>;
+
+    void Run();
+
+    // Moves the requests at the front of the queue into the batch, as long as they can join it and it has room.
+    void TakeCompatibleRequests(Batch& batch, unsigned int& batchSize);
+
+    void Execute(Batch& batch) const;
+    void Execute(Request& request) const;
+
+    static void Complete(const Request& request, Status status);
+
+    ExecuteFunction m_Execute;
+    unsigned int m_MaxBatchSize;
+    std::chrono::microseconds m_BatchTimeout;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::deque<Request> m_Requests;
+    bool m_Stop;
+
+    // Whether a thread is forming a batch, in which case the others leave the queue to it.
+    bool m_Collecting;
+
+    std::vector<std::thread> m_Threads;
+};
+
+} // namespace armnn
@@ -7,6 +7,7 @@
 #include <armnn/Version.hpp>
 #include <backendsCommon/BackendRegistry.hpp>
 #include <backendsCommon/IBackendContext.hpp>
+#include <backendsCommon/ThreadPool.hpp>
 
 #include <iostream>
 
@@ -45,6 +46,26 @@ Status Runtime::LoadNetwork(NetworkId& networkIdOut, IOptimizedNetworkPtr inNetw
     return LoadNetwork(networkIdOut, std::move(inNetwork), ignoredErrorMessage);
 }
 
+Status Runtime::LoadNetwork(NetworkId& networkIdOut,
+                            const INetwork& inNetwork,
+                            std::string & errorMessage)
+{
+    std::vector<std::string> errMessages;
+    IOptimizedNetworkPtr optNet = ImportOptimizedNetwork(inNetwork,
+                                                         GetDeviceSpec(),
+                                                         Optional<std::vector<std::string>&>(errMessages));
+    if (!optNet)
+    {
+        errorMessage.clear();
+        for (auto&& message : errMessages)
+        {
+            errorMessage += message + "\n";
+        }
+        return Status::Failure;
+    }
+    return LoadNetwork(networkIdOut, std::move(optNet), errorMessage);
+}
+
 Status Runtime::LoadNetwork(NetworkId& networkIdOut,
                             IOptimizedNetworkPtr inNetwork,
                             std::string & errorMessage)
@@ -60,7 +81,9 @@ Status Runtime::LoadNetwork(NetworkId& networkIdOut,
 
     unique_ptr<LoadedNetwork> loadedNetwork = LoadedNetwork::MakeLoadedNetwork(
         std::unique_ptr<OptimizedNetwork>(boost::polymorphic_downcast<OptimizedNetwork*>(rawNetwork)),
-        errorMessage);
+        errorMessage,
+        m_EnableInterOpParallelism ? m_ThreadPool : nullptr,
+        m_EnableDynamicBatch);
 
     if (!loadedNetwork)
     {
@@ -131,6 +154,11 @@ const std::shared_ptr<IProfiler> Runtime::GetProfiler(NetworkId networkId) const
 Runtime::Runtime(const CreationOptions& options)
     : m_NetworkIdCounter(0)
     , m_DeviceSpec{BackendRegistryInstance().GetBackendIds()}
+    , m_EnableInterOpParallelism(options.m_EnableInterOpParallelism)
+    , m_EnableDynamicBatch(options.m_EnableDynamicBatch)
+    , m_MaxBatchSize(options.m_EnableDynamicBatch ? options.m_MaxBatchSize : 1)
+    , m_BatchTimeout(options.m_BatchTimeoutUs)
+    , m_NumAsyncThreads(options.m_NumAsyncThreads)
 {
     BOOST_LOG_TRIVIAL(info) << "ArmNN v" << ARMNN_VERSION << "\n";
 
@@ -153,10 +181,19 @@ Runtime::Runtime(const CreationOptions& options)
             }
         }
     }
+
+    if (options.m_NumThreads != 1)
+    {
+        m_ThreadPool = std::make_shared<ThreadPool>(options.m_NumThreads, options.m_CpuAffinity);
+        ThreadPool::SetDefault(m_ThreadPool);
+    }
 }
 
 Runtime::~Runtime()
 {
+    // Completes the pending asynchronous requests while their networks are still loaded.
+    m_RequestBatcher.reset();
+
     std::vector<int> networkIDs;
     try
     {
@@ -193,6 +230,8 @@ Runtime::~Runtime()
                       << std::endl;
         }
     }
+
+    ThreadPool::ClearDefault(m_ThreadPool.get());
 }
 
 LoadedNetwork* Runtime::GetLoadedNetworkPtr(NetworkId networkId) const
@@ -215,6 +254,65 @@ TensorInfo Runtime::GetOutputTensorInfo(NetworkId networkId, LayerBindingId laye
 Status Runtime::EnqueueWorkload(NetworkId networkId,
                                 const InputTensors& inputTensors,
                                 const OutputTensors& outputTensors)
+{
+    return EnqueueWorkload(networkId, inputTensors, outputTensors, {}, {});
+}
+
+std::future<Status> Runtime::EnqueueWorkloadAsync(NetworkId networkId,
+                                                  const InputTensors& inputTensors,
+                                                  const OutputTensors& outputTensors)
+{
+    auto promise = std::make_shared<std::promise<Status>>();
+    EnqueueWorkloadAsync(networkId, inputTensors, outputTensors,
+                         [promise](Status status) { promise->set_value(status); });
+    return promise->get_future();
+}
+
+void Runtime::EnqueueWorkloadAsync(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors,
+                                   const CompletionCallbackFunction& callback)
+{
+    std::call_once(m_RequestBatcherCreated, [this]
+    {
+        auto execute = [this](NetworkId id, const InputTensors& inputs, const OutputTensors& outputs)
+        {
+            // Profiling events go to the profiler of the network, as they do on the thread that loaded it.
+            ProfilerManager::GetInstance().RegisterProfiler(GetLoadedNetworkPtr(id)->GetProfiler().get());
+            return EnqueueWorkload(id, inputs, outputs);
+        };
+        m_RequestBatcher = std::make_unique<RequestBatcher>(execute, m_MaxBatchSize, m_BatchTimeout,
+                                                            m_NumAsyncThreads);
+    });
+
+    m_RequestBatcher->Push(networkId, inputTensors, outputTensors, callback);
+}
+
+std::vector<ImportedInputId> Runtime::ImportInputs(NetworkId networkId, const InputTensors& inputTensors)
+{
+    return GetLoadedNetworkPtr(networkId)->ImportInputs(inputTensors);
+}
+
+std::vector<ImportedOutputId> Runtime::ImportOutputs(NetworkId networkId, const OutputTensors& outputTensors)
+{
+    return GetLoadedNetworkPtr(networkId)->ImportOutputs(outputTensors);
+}
+
+void Runtime::ClearImportedInputs(NetworkId networkId, const std::vector<ImportedInputId>& inputIds)
+{
+    GetLoadedNetworkPtr(networkId)->ClearImportedInputs(inputIds);
+}
+
+void Runtime::ClearImportedOutputs(NetworkId networkId, const std::vector<ImportedOutputId>& outputIds)
+{
+    GetLoadedNetworkPtr(networkId)->ClearImportedOutputs(outputIds);
+}
+
+Status Runtime::EnqueueWorkload(NetworkId networkId,
+                                const InputTensors& inputTensors,
+                                const OutputTensors& outputTensors,
+                                const std::vector<ImportedInputId>& preImportedInputIds,
+                                const std::vector<ImportedOutputId>& preImportedOutputIds)
 {
     LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
 
@@ -228,7 +326,20 @@ Status Runtime::EnqueueWorkload(NetworkId networkId,
     }
     lastId=networkId;
 
-    return loadedNetwork->EnqueueWorkload(inputTensors, outputTensors);
+    return loadedNetwork->EnqueueWorkload(inputTensors, outputTensors, preImportedInputIds, preImportedOutputIds);
+}
+
+std::unique_ptr<IWorkingMemHandle> Runtime::CreateWorkingMemHandle(NetworkId networkId)
+{
+    return GetLoadedNetworkPtr(networkId)->CreateWorkingMemHandle(networkId);
+}
+
+Status Runtime::Execute(IWorkingMemHandle& workingMemHandle,
+                        const InputTensors& inputTensors,
+                        const OutputTensors& outputTensors)
+{
+    return GetLoadedNetworkPtr(workingMemHandle.GetNetworkId())->Execute(inputTensors, outputTensors,
+                                                                         workingMemHandle);
 }
 
 void Runtime::RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func)
@@ -237,4 +348,9 @@ void Runtime::RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunc
     loadedNetwork->RegisterDebugCallback(func);
 }
 
+void Runtime::ResetNetworkState(NetworkId networkId)
+{
+    GetLoadedNetworkPtr(networkId)->ResetState();
+}
+
 }
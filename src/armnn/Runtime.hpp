@@ -6,11 +6,14 @@
 
 #include "LoadedNetwork.hpp"
 #include "DeviceSpec.hpp"
+#include "RequestBatcher.hpp"
 #include <armnn/INetwork.hpp>
 #include <armnn/IRuntime.hpp>
 #include <armnn/Tensor.hpp>
 #include <armnn/BackendId.hpp>
 
+#include <backendsCommon/ThreadPool.hpp>
+
 #include <mutex>
 #include <unordered_map>
 
@@ -37,6 +40,11 @@ public:
                                IOptimizedNetworkPtr network,
                                std::string & errorMessage) override;
 
+    /// Load a network exported from an optimized network into the IRuntime, without optimizing it again.
+    virtual Status LoadNetwork(NetworkId& networkIdOut,
+                               const INetwork& network,
+                               std::string & errorMessage) override;
+
     virtual TensorInfo GetInputTensorInfo(NetworkId networkId, LayerBindingId layerId) const override;
     virtual TensorInfo GetOutputTensorInfo(NetworkId networkId, LayerBindingId layerId) const override;
 
@@ -45,6 +53,37 @@ public:
         const InputTensors& inputTensors,
         const OutputTensors& outputTensors) override;
 
+    virtual std::future<Status> EnqueueWorkloadAsync(NetworkId networkId,
+                                                     const InputTensors& inputTensors,
+                                                     const OutputTensors& outputTensors) override;
+
+    virtual void EnqueueWorkloadAsync(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors,
+                                      const CompletionCallbackFunction& callback) override;
+
+    virtual std::vector<ImportedInputId> ImportInputs(NetworkId networkId, const InputTensors& inputTensors) override;
+    virtual std::vector<ImportedOutputId> ImportOutputs(NetworkId networkId,
+                                                        const OutputTensors& outputTensors) override;
+
+    virtual void ClearImportedInputs(NetworkId networkId, const std::vector<ImportedInputId>& inputIds) override;
+    virtual void ClearImportedOutputs(NetworkId networkId, const std::vector<ImportedOutputId>& outputIds) override;
+
+    // Evaluates network using input in inputTensors and the imported inputs, outputs filled into outputTensors and
+    // the imported outputs.
+    virtual Status EnqueueWorkload(NetworkId networkId,
+        const InputTensors& inputTensors,
+        const OutputTensors& outputTensors,
+        const std::vector<ImportedInputId>& preImportedInputIds,
+        const std::vector<ImportedOutputId>& preImportedOutputIds) override;
+
+    virtual std::unique_ptr<IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId) override;
+
+    // Evaluates network on the working memory of the given handle; may be called concurrently with different handles.
+    virtual Status Execute(IWorkingMemHandle& workingMemHandle,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors) override;
+
     /// Unloads a network from the Runtime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -64,6 +103,8 @@ public:
     /// @param func callback function to pass to the debug layer.
     virtual void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func) override;
 
+    virtual void ResetNetworkState(NetworkId networkId) override;
+
     /// Creates a runtime for workload execution.
     /// May throw a ClRuntimeUnavailableException if @a defaultComputeDevice requires a CL runtime but
     /// it cannot be setup for some reason.
@@ -97,6 +138,22 @@ private:
     int m_NetworkIdCounter;
 
     DeviceSpec m_DeviceSpec;
+
+    // Shared out the iterations of the heavy CpuRef kernels, while it is the default pool.
+    std::shared_ptr<ThreadPool> m_ThreadPool;
+
+    // Whether m_ThreadPool also runs independent workloads of the loaded networks concurrently.
+    bool m_EnableInterOpParallelism;
+
+    // Whether the loaded networks accept inputs of any batch size.
+    bool m_EnableDynamicBatch;
+
+    // Evaluates the asynchronous requests, created on first use.
+    unsigned int m_MaxBatchSize;
+    std::chrono::microseconds m_BatchTimeout;
+    unsigned int m_NumAsyncThreads;
+    std::once_flag m_RequestBatcherCreated;
+    std::unique_ptr<RequestBatcher> m_RequestBatcher;
 };
 
 }
@@ -0,0 +1,78 @@
+﻿//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "WorkingMemHandle.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+namespace armnn
+{
+
+WorkingMemHandle::WorkingMemHandle(NetworkId networkId,
+                                   MemoryManagers memoryManagers,
+                                   TensorHandles tensorHandles,
+                                   SlotHandleMap slotHandles,
+                                   std::vector<WorkingMemDescriptor> workingMemDescriptors)
+    : m_NetworkId(networkId)
+    , m_MemoryManagers(std::move(memoryManagers))
+    , m_TensorHandles(std::move(tensorHandles))
+    , m_SlotHandles(std::move(slotHandles))
+    , m_WorkingMemDescriptors(std::move(workingMemDescriptors))
+    , m_IsAllocated(false)
+{
+}
+
+WorkingMemHandle::~WorkingMemHandle()
+{
+    Free();
+}
+
+void WorkingMemHandle::Allocate()
+{
+    if (m_IsAllocated)
+    {
+        return;
+    }
+    for (auto&& memoryManager : m_MemoryManagers)
+    {
+        memoryManager->Acquire();
+    }
+    m_IsAllocated = true;
+}
+
+void WorkingMemHandle::Free()
+{
+    if (!m_IsAllocated)
+    {
+        return;
+    }
+    for (auto&& memoryManager : m_MemoryManagers)
+    {
+        memoryManager->Release();
+    }
+    m_IsAllocated = false;
+}
+
+void WorkingMemHandle::ResetState()
+{
+    for (auto&& workingMemDescriptor : m_WorkingMemDescriptors)
+    {
+        if (workingMemDescriptor.m_State)
+        {
+            workingMemDescriptor.m_State->Reset();
+        }
+    }
+}
+
+ITensorHandle* WorkingMemHandle::GetTensorHandle(const OutputSlot& outputSlot) const
+{
+    auto it = m_SlotHandles.find(&outputSlot);
+    if (it == m_SlotHandles.end())
+    {
+        throw InvalidArgumentException("WorkingMemHandle: no tensor for the given output slot");
+    }
+    return it->second;
+}
+
+} // namespace armnn
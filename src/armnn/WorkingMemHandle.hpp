@@ -0,0 +1,70 @@
+﻿//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/IWorkingMemHandle.hpp>
+
+#include <backendsCommon/IMemoryManager.hpp>
+#include <backendsCommon/ITensorHandle.hpp>
+#include <backendsCommon/WorkingMemDescriptor.hpp>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+class OutputSlot;
+
+/// Intermediate tensors of one execution context of a LoadedNetwork, together with the memory managers that back
+/// them and the per-workload views of those tensors.
+class WorkingMemHandle final : public IWorkingMemHandle
+{
+public:
+    using MemoryManagers = std::vector<std::shared_ptr<IMemoryManager>>;
+    using TensorHandles  = std::vector<std::unique_ptr<ITensorHandle>>;
+    using SlotHandleMap  = std::unordered_map<const OutputSlot*, ITensorHandle*>;
+
+    WorkingMemHandle(NetworkId networkId,
+                     MemoryManagers memoryManagers,
+                     TensorHandles tensorHandles,
+                     SlotHandleMap slotHandles,
+                     std::vector<WorkingMemDescriptor> workingMemDescriptors);
+
+    ~WorkingMemHandle();
+
+    NetworkId GetNetworkId() const override { return m_NetworkId; }
+
+    void Allocate() override;
+    void Free() override;
+    bool IsAllocated() const override { return m_IsAllocated; }
+    void ResetState() override;
+
+    /// Returns the tensor handle holding the data of the given output slot in this context.
+    ITensorHandle* GetTensorHandle(const OutputSlot& outputSlot) const;
+
+    /// Returns the tensors the workload at the given position of the network's workload queue runs on.
+    WorkingMemDescriptor& GetWorkingMemDescriptorAt(size_t workloadIndex)
+    {
+        return m_WorkingMemDescriptors[workloadIndex];
+    }
+
+    /// Serialises the executions that use this handle.
+    std::mutex& GetMutex() { return m_Mutex; }
+
+private:
+    NetworkId m_NetworkId;
+    MemoryManagers m_MemoryManagers;
+    TensorHandles m_TensorHandles;
+    SlotHandleMap m_SlotHandles;
+    std::vector<WorkingMemDescriptor> m_WorkingMemDescriptors;
+
+    bool m_IsAllocated;
+    std::mutex m_Mutex;
+};
+
+} // namespace armnn
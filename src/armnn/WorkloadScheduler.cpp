@@ -0,0 +1,171 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "WorkloadScheduler.hpp"
+
+#include "Profiling.hpp"
+#include "WallClockTimer.hpp"
+
+#include <boost/assert.hpp>
+
+#include <chrono>
+#include <exception>
+#include <mutex>
+
+namespace armnn
+{
+
+const std::string WorkloadScheduler::WORKLOAD_BUSY_TIME("Workload busy time");
+
+WorkloadScheduler::BusyTimer::BusyTimer(std::shared_ptr<Counter> busyTimeNs)
+    : m_BusyTimeNs(std::move(busyTimeNs))
+{
+}
+
+void WorkloadScheduler::BusyTimer::Start()
+{
+    *m_BusyTimeNs = 0;
+}
+
+void WorkloadScheduler::BusyTimer::Stop()
+{
+}
+
+std::vector<Measurement> WorkloadScheduler::BusyTimer::GetMeasurements() const
+{
+    return { { WORKLOAD_BUSY_TIME, static_cast<double>(m_BusyTimeNs->load()) / 1000.0, Measurement::Unit::TIME_US } };
+}
+
+const char* WorkloadScheduler::BusyTimer::GetName() const
+{
+    return "WorkloadBusyTimer";
+}
+
+WorkloadScheduler::WorkloadScheduler(const std::vector<std::vector<unsigned int>>& dependencies,
+                                     std::shared_ptr<ThreadPool> threadPool)
+    : m_NumDependencies(dependencies.size())
+    , m_Dependents(dependencies.size())
+    , m_ThreadPool(std::move(threadPool))
+{
+    BOOST_ASSERT(m_ThreadPool);
+
+    for (unsigned int workload = 0; workload < dependencies.size(); ++workload)
+    {
+        m_NumDependencies[workload] = static_cast<unsigned int>(dependencies[workload].size());
+        for (unsigned int dependency : dependencies[workload])
+        {
+            BOOST_ASSERT_MSG(dependency < workload, "Workloads must be in topological order");
+            m_Dependents[dependency].push_back(workload);
+        }
+    }
+}
+
+void WorkloadScheduler::Execute(const std::function<void(unsigned int)>& executeWorkload) const
+{
+    auto busyTimeNs = std::make_shared<BusyTimer::Counter>(0);
+    ARMNN_SCOPED_PROFILING_EVENT_WITH_INSTRUMENTS(Compute::Undefined, "ScheduleWorkloads",
+                                                  WallClockTimer(), BusyTimer(busyTimeNs));
+
+    const unsigned int numWorkloads = GetNumWorkloads();
+
+    // Events recorded in a ring buffer may come from any thread, so the pool threads report them to the caller's
+    // profiler in that mode. The default mode is single-threaded: only the caller's events are recorded.
+    ProfilerManager& profilerManager = ProfilerManager::GetInstance();
+    Profiler* profiler = profilerManager.GetProfiler();
+    Profiler* poolProfiler = (profiler && profiler->GetRingBuffer()) ? profiler : nullptr;
+
+    std::vector<unsigned int> numPendingDependencies = m_NumDependencies;
+    unsigned int numRunning = 0;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::atomic<bool> done(numWorkloads == 0);
+
+    // Each workload is a task of the pool, submitted once the workloads it depends on have completed. No thread waits
+    // for workloads to become ready, so the threads left idle by a narrow part of the network are free to help with
+    // the loops the running workloads share out on the same pool.
+    std::function<void(unsigned int)> Submit = [&](unsigned int workload)
+    {
+        m_ThreadPool->Submit([&, workload]()
+        {
+            Profiler* threadProfiler = profilerManager.GetProfiler();
+            if (threadProfiler != profiler)
+            {
+                profilerManager.RegisterProfiler(poolProfiler);
+            }
+
+            std::exception_ptr workloadError;
+            const auto start = std::chrono::steady_clock::now();
+            try
+            {
+                executeWorkload(workload);
+            }
+            catch (...)
+            {
+                workloadError = std::current_exception();
+            }
+            *busyTimeNs += static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count());
+
+            profilerManager.RegisterProfiler(threadProfiler);
+
+            std::vector<unsigned int> ready;
+            bool isLast = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                --numRunning;
+                if (workloadError && !error)
+                {
+                    error = workloadError;
+                }
+                if (!error)
+                {
+                    for (unsigned int dependent : m_Dependents[workload])
+                    {
+                        if (--numPendingDependencies[dependent] == 0)
+                        {
+                            ready.push_back(dependent);
+                        }
+                    }
+                }
+                numRunning += static_cast<unsigned int>(ready.size());
+                isLast = numRunning == 0;
+            }
+
+            for (unsigned int dependent : ready)
+            {
+                Submit(dependent);
+            }
+
+            // Nothing of the execution may be used once it is seen as done.
+            if (isLast)
+            {
+                done = true;
+            }
+        });
+    };
+
+    std::vector<unsigned int> ready;
+    for (unsigned int workload = 0; workload < numWorkloads; ++workload)
+    {
+        if (m_NumDependencies[workload] == 0)
+        {
+            ready.push_back(workload);
+        }
+    }
+    numRunning = static_cast<unsigned int>(ready.size());
+    for (unsigned int workload : ready)
+    {
+        Submit(workload);
+    }
+
+    // The calling thread runs tasks of the pool too, so the execution completes however busy the pool is.
+    m_ThreadPool->RunTasksUntil([&done]() { return done.load(); });
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,66 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Instrument.hpp"
+
+#include <backendsCommon/ThreadPool.hpp>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace armnn
+{
+
+/// Runs the workloads of a network on a thread pool, each as soon as the workloads producing its inputs have
+/// completed, so that independent branches of the network execute concurrently.
+class WorkloadScheduler
+{
+public:
+    /// @param dependencies - For each workload, the indices of the workloads whose outputs it reads. These must
+    ///                       all be lower than the index of the workload, as in a topological order.
+    /// @param threadPool - Pool whose threads run the workloads, alongside the thread calling Execute().
+    WorkloadScheduler(const std::vector<std::vector<unsigned int>>& dependencies,
+                      std::shared_ptr<ThreadPool> threadPool);
+
+    /// Calls executeWorkload(i) for each workload i, once the calls for the workloads it depends on have returned,
+    /// and returns once all of them have. Should a call throw, no further workload is started and the exception is
+    /// rethrown once the running ones have completed.
+    /// Records a "ScheduleWorkloads" profiling event with the time spent in workloads summed over all threads, which
+    /// divided by its wall clock time gives the achieved parallelism. Workloads running on threads other than the
+    /// calling one record no profiling events of their own.
+    void Execute(const std::function<void(unsigned int)>& executeWorkload) const;
+
+    unsigned int GetNumWorkloads() const { return static_cast<unsigned int>(m_NumDependencies.size()); }
+
+    /// Name of the measurement of the time spent in workloads.
+    static const std::string WORKLOAD_BUSY_TIME;
+
+private:
+    // Reports the time accumulated by the workloads of an execution.
+    class BusyTimer : public Instrument
+    {
+    public:
+        using Counter = std::atomic<unsigned long long>;
+
+        BusyTimer(std::shared_ptr<Counter> busyTimeNs);
+
+        void Start() override;
+        void Stop() override;
+        std::vector<Measurement> GetMeasurements() const override;
+        const char* GetName() const override;
+
+    private:
+        std::shared_ptr<Counter> m_BusyTimeNs;
+    };
+
+    std::vector<unsigned int> m_NumDependencies;
+    std::vector<std::vector<unsigned int>> m_Dependents;
+    std::shared_ptr<ThreadPool> m_ThreadPool;
+};
+
+} // namespace armnn
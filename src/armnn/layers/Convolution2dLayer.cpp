@@ -36,6 +36,8 @@ std::unique_ptr<IWorkload> Convolution2dLayer::CreateWorkload(const Graph& graph
         BOOST_ASSERT_MSG(m_Bias != nullptr, "Convolution2dLayer: Bias data should not be null.");
         descriptor.m_Bias = m_Bias.get();
     }
+    descriptor.m_FusedActivation = m_FusedActivation;
+
     return factory.CreateConvolution2d(descriptor, PrepInfoAndDesc(descriptor, graph));
 }
 
@@ -50,6 +52,8 @@ Convolution2dLayer* Convolution2dLayer::Clone(Graph& graph) const
         layer->m_Bias = m_Bias ? std::make_unique<ScopedCpuTensorHandle>(*m_Bias) : nullptr;
     }
 
+    layer->m_FusedActivation = m_FusedActivation;
+
     return std::move(layer);
 }
 
@@ -6,6 +6,8 @@
 
 #include "LayerWithParameters.hpp"
 
+#include <armnn/Optional.hpp>
+
 namespace armnn
 {
 
@@ -19,6 +21,8 @@ public:
     std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
     /// A unique pointer to store Bias values.
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
+    /// Activation applied to the output, set when an activation layer has been fused into this one.
+    Optional<ActivationDescriptor> m_FusedActivation;
 
     /// Makes a workload for the Convolution2d type.
     /// @param [in] graph The graph where this layer can be found.
@@ -33,6 +33,8 @@ std::unique_ptr<IWorkload> FullyConnectedLayer::CreateWorkload(const Graph& grap
         BOOST_ASSERT_MSG(m_Bias != nullptr, "FullyConnectedLayer: Bias data should not be null.");
         descriptor.m_Bias = m_Bias.get();
     }
+    descriptor.m_FusedActivation = m_FusedActivation;
+
     return factory.CreateFullyConnected(descriptor, PrepInfoAndDesc(descriptor, graph));
 }
 
@@ -46,6 +48,8 @@ FullyConnectedLayer* FullyConnectedLayer::Clone(Graph& graph) const
         layer->m_Bias = m_Bias ? std::make_unique<ScopedCpuTensorHandle>(*m_Bias) : nullptr;
     }
 
+    layer->m_FusedActivation = m_FusedActivation;
+
     return std::move(layer);
 }
 
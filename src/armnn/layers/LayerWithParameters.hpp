@@ -17,6 +17,9 @@ public:
 
     const Parameters& GetParameters() const { return m_Param; }
 
+    /// Replaces the parameters, for graph transformations that keep the layer (e.g. Graph::SetBatchSize()).
+    void SetParameters(const Parameters& param) { m_Param = param; }
+
     /// Helper to serialize the layer parameters to string
     /// (currently used in DotSerializer and company).
     void SerializeLayerParameters(ParameterStringifyFunction & fn) const
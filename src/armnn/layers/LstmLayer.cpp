@@ -118,7 +118,7 @@ std::vector<TensorShape> LstmLayer::InferOutputShapes(const std::vector<TensorSh
     BOOST_ASSERT(inputShapes.size() == 3);
 
     // Get input values for validation
-    unsigned int batchSize = inputShapes[0][0];
+    unsigned int batchSize = inputShapes[0][m_Param.m_StatefulSequence ? 1 : 0];
     unsigned int outputSize = inputShapes[1][1];
     unsigned int numUnits = inputShapes[2][1];
 
@@ -126,7 +126,15 @@ std::vector<TensorShape> LstmLayer::InferOutputShapes(const std::vector<TensorSh
     outShapes.push_back(TensorShape({batchSize, numUnits * (m_Param.m_CifgEnabled ? 3 : 4)}));
     outShapes.push_back(TensorShape({batchSize, outputSize}));
     outShapes.push_back(TensorShape({batchSize, numUnits}));
-    outShapes.push_back(TensorShape({batchSize, outputSize}));
+    if (m_Param.m_StatefulSequence)
+    {
+        // One output per time step.
+        outShapes.push_back(TensorShape({inputShapes[0][0], batchSize, outputSize}));
+    }
+    else
+    {
+        outShapes.push_back(TensorShape({batchSize, outputSize}));
+    }
 
     return outShapes;
 }
@@ -9,6 +9,7 @@
 #include <backendsCommon/WorkloadData.hpp>
 #include <backendsCommon/WorkloadFactory.hpp>
 
+#include <algorithm>
 #include <queue>
 
 namespace armnn
@@ -59,6 +60,22 @@ void MergerLayer::CreateTensorHandles(Graph& graph, const IWorkloadFactory& fact
             for (unsigned int i = 0; i < numInputSlots; ++i)
             {
                 OutputSlot* slot = currentLayer->GetInputSlot(i).GetConnectedOutputSlot();
+
+                // Inputs quantized differently from the output must be requantized by the merger workload, and
+                // replacing the tensor would leave the views a splitter made of it dangling.
+                const TensorInfo& inputInfo = slot->GetTensorInfo();
+                const TensorInfo& outputInfo = currentLayer->GetOutputSlot(0).GetTensorInfo();
+                const auto& connections = slot->GetConnections();
+                if (inputInfo.GetQuantizationScale() != outputInfo.GetQuantizationScale() ||
+                    inputInfo.GetQuantizationOffset() != outputInfo.GetQuantizationOffset() ||
+                    std::any_of(connections.begin(), connections.end(), [](const InputSlot* connection)
+                    {
+                        return connection->GetOwningLayer().GetType() == LayerType::Splitter;
+                    }))
+                {
+                    continue;
+                }
+
                 OutputHandler& outputHandler = slot->GetOutputHandler();
                 outputHandler.SetData(factory.CreateSubTensorHandle(*parentTensor,
                                                                     outputHandler.GetTensorInfo().GetShape(),
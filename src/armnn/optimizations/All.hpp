@@ -13,3 +13,6 @@
 #include "OptimizeInverseConversions.hpp"
 #include "ConvertFp32NetworkToFp16.hpp"
 #include "AddDebug.hpp"
+#include "FuseBatchNorm.hpp"
+#include "FuseActivation.hpp"
+#include "FoldConstants.hpp"
@@ -0,0 +1,217 @@
+﻿//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+#include <backendsCommon/WorkloadFactory.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+class FoldConstantsImpl
+{
+public:
+    /// @param workloadFactory - Factory of the workloads evaluating the folded layers. Its tensor handles must own
+    ///                          their memory once allocated.
+    FoldConstantsImpl(std::shared_ptr<IWorkloadFactory> workloadFactory)
+        : m_WorkloadFactory(std::move(workloadFactory))
+    {
+    }
+
+    /// Run for every layer. Starting from a ConstantLayer, evaluates the layers whose inputs are all constants and
+    /// replaces each of them with a ConstantLayer holding its output, until no more layers can be folded. The layers
+    /// left unconnected are removed.
+    void Run(Graph& graph, Layer& layer) const
+    {
+        if (layer.GetType() != LayerType::Constant)
+        {
+            return;
+        }
+
+        std::set<Layer*> constants;
+        FoldConsumers(graph, layer, constants);
+
+        // The layer being optimized is removed by the optimizer if left unconnected.
+        constants.erase(&layer);
+        for (Layer* constant : constants)
+        {
+            if (constant->IsOutputUnconnected())
+            {
+                graph.EraseLayer(constant);
+            }
+        }
+    }
+
+protected:
+    ~FoldConstantsImpl() = default;
+
+private:
+    static std::vector<Layer*> GetConsumers(const Layer& layer)
+    {
+        std::vector<Layer*> consumers;
+        for (auto&& connection : layer.GetOutputSlot(0).GetConnections())
+        {
+            Layer* consumer = &connection->GetOwningLayer();
+            if (std::find(consumers.begin(), consumers.end(), consumer) == consumers.end())
+            {
+                consumers.push_back(consumer);
+            }
+        }
+        return consumers;
+    }
+
+    bool CanFold(const Layer& layer) const
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::Input:
+            case LayerType::Output:
+            case LayerType::Constant:
+            case LayerType::MemCopy:
+            case LayerType::Debug:
+                return false;
+            default:
+                break;
+        }
+
+        for (auto&& inputSlot : layer.GetInputSlots())
+        {
+            const OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+            if (!connection || connection->GetOwningLayer().GetType() != LayerType::Constant)
+            {
+                return false;
+            }
+        }
+
+        std::string reasonIfUnsupported;
+        return layer.GetNumInputSlots() > 0 &&
+               IWorkloadFactory::IsLayerSupported(m_WorkloadFactory->GetBackendId(), layer, EmptyOptional(),
+                                                  reasonIfUnsupported);
+    }
+
+    /// Folds the consumers of the given constant, then the consumers of the constants replacing them, and so on.
+    /// Collects the constants that may be left unconnected.
+    void FoldConsumers(Graph& graph, Layer& constant, std::set<Layer*>& constants) const
+    {
+        for (Layer* consumer : GetConsumers(constant))
+        {
+            // Folding a previous consumer may have folded this one too.
+            const std::vector<Layer*> consumers = GetConsumers(constant);
+            if (std::find(consumers.begin(), consumers.end(), consumer) == consumers.end() || !CanFold(*consumer))
+            {
+                continue;
+            }
+
+            std::vector<std::unique_ptr<ScopedCpuTensorHandle>> outputs = Evaluate(graph, *consumer);
+            if (outputs.empty())
+            {
+                continue;
+            }
+
+            for (auto&& inputSlot : consumer->GetInputSlots())
+            {
+                constants.insert(&inputSlot.GetConnectedOutputSlot()->GetOwningLayer());
+            }
+
+            std::vector<Layer*> folded;
+            for (unsigned int i = 0; i < consumer->GetNumOutputSlots(); ++i)
+            {
+                const std::string name = std::string("folded-") + consumer->GetName() +
+                                         (consumer->GetNumOutputSlots() > 1 ? "-" + std::to_string(i) : "");
+                auto newConstant = graph.AddLayer<ConstantLayer>(name.c_str());
+                newConstant->GetOutputSlot().SetTensorInfo(outputs[i]->GetTensorInfo());
+                newConstant->m_LayerOutput = std::move(outputs[i]);
+                consumer->GetOutputSlot(i).MoveAllConnections(newConstant->GetOutputSlot());
+                folded.push_back(newConstant);
+            }
+            graph.EraseLayer(consumer);
+
+            for (Layer* newConstant : folded)
+            {
+                constants.insert(newConstant);
+                FoldConsumers(graph, *newConstant, constants);
+            }
+        }
+    }
+
+    /// Runs the workloads of the given layer and of the constants feeding it, and returns copies of its outputs.
+    /// Returns an empty vector if the layer could not be evaluated.
+    std::vector<std::unique_ptr<ScopedCpuTensorHandle>> Evaluate(Graph& graph, Layer& layer) const
+    {
+        std::vector<Layer*> layers;
+        for (auto&& inputSlot : layer.GetInputSlots())
+        {
+            Layer* constant = &inputSlot.GetConnectedOutputSlot()->GetOwningLayer();
+            if (std::find(layers.begin(), layers.end(), constant) == layers.end())
+            {
+                layers.push_back(constant);
+            }
+        }
+        layers.push_back(&layer);
+
+        std::vector<std::unique_ptr<ScopedCpuTensorHandle>> outputs;
+        try
+        {
+            for (Layer* evaluatedLayer : layers)
+            {
+                evaluatedLayer->CreateTensorHandles(graph, *m_WorkloadFactory);
+                for (unsigned int i = 0; i < evaluatedLayer->GetNumOutputSlots(); ++i)
+                {
+                    evaluatedLayer->GetOutputHandler(i).GetData()->Allocate();
+                }
+            }
+
+            for (Layer* evaluatedLayer : layers)
+            {
+                std::unique_ptr<IWorkload> workload = evaluatedLayer->CreateWorkload(graph, *m_WorkloadFactory);
+                if (!workload)
+                {
+                    throw UnimplementedException("No workload to evaluate " + evaluatedLayer->GetNameStr());
+                }
+                workload->PostAllocationConfigure();
+                workload->Execute();
+            }
+
+            for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+            {
+                ITensorHandle* handle = layer.GetOutputHandler(i).GetData();
+                const TensorInfo& info = layer.GetOutputHandler(i).GetTensorInfo();
+                outputs.push_back(std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, handle->Map())));
+                handle->Unmap();
+            }
+        }
+        catch (const Exception&)
+        {
+            outputs.clear();
+        }
+
+        // The tensor handles used by the backends are created when the network is loaded.
+        for (Layer* evaluatedLayer : layers)
+        {
+            for (unsigned int i = 0; i < evaluatedLayer->GetNumOutputSlots(); ++i)
+            {
+                evaluatedLayer->GetOutputHandler(i).SetData(nullptr);
+            }
+        }
+        return outputs;
+    }
+
+    std::shared_ptr<IWorkloadFactory> m_WorkloadFactory;
+};
+
+using FoldConstants = OptimizeForType<Layer, FoldConstantsImpl>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,76 @@
+﻿//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <boost/core/ignore_unused.hpp>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+template<typename BaseLayer>
+class FuseActivationImpl
+{
+public:
+    /// @param backendId - Backend whose workloads honour the m_FusedActivation of the base layer. Only layers
+    ///                    assigned to it are fused.
+    FuseActivationImpl(const BackendId& backendId)
+        : m_BackendId(backendId)
+    {
+    }
+
+    /// Run for every ActivationLayer. If its input is produced by a BaseLayer, moves the activation into that layer,
+    /// which is left producing the output of the activation. The activation layer is then removed as it's left
+    /// unconnected.
+    void Run(Graph& graph, ActivationLayer& activation) const
+    {
+        boost::ignore_unused(graph);
+
+        Layer& base = activation.GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+        if (base.GetType() != LayerEnumOf<BaseLayer>())
+        {
+            return;
+        }
+
+        auto& layer = *boost::polymorphic_downcast<BaseLayer*>(&base);
+
+        // The fused activation is applied to the output of the base layer, so it must not change its quantization.
+        const TensorInfo& baseInfo = base.GetOutputHandler().GetTensorInfo();
+        const DataType dataType = baseInfo.GetDataType();
+        if (base.GetBackendId() != m_BackendId ||
+            activation.GetBackendId() != m_BackendId ||
+            base.GetOutputSlot().GetNumConnections() != 1 ||
+            layer.m_FusedActivation.has_value() ||
+            (dataType != DataType::Float32 && dataType != DataType::QuantisedAsymm8) ||
+            baseInfo != activation.GetOutputHandler().GetTensorInfo())
+        {
+            return;
+        }
+
+        layer.m_FusedActivation = activation.GetParameters();
+
+        // Moves connections in activation output to the base layer.
+        activation.GetOutputSlot().MoveAllConnections(base.GetOutputSlot());
+    }
+
+protected:
+    ~FuseActivationImpl() = default;
+
+private:
+    BackendId m_BackendId;
+};
+
+using FuseActivationIntoConvolution2d =
+    OptimizeForType<ActivationLayer, FuseActivationImpl<Convolution2dLayer>>;
+using FuseActivationIntoDepthwiseConvolution2d =
+    OptimizeForType<ActivationLayer, FuseActivationImpl<DepthwiseConvolution2dLayer>>;
+using FuseActivationIntoFullyConnected =
+    OptimizeForType<ActivationLayer, FuseActivationImpl<FullyConnectedLayer>>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,138 @@
+﻿//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+template<typename ConvLayer>
+class FuseBatchNormImpl
+{
+public:
+    /// Run for every connection between a base convolution layer and a child BatchNormalizationLayer.
+    /// Folds the batch normalization into the weights and bias of an equivalent convolution that replaces both.
+    /// Only Float32 layers whose output feeds the batch normalization alone are folded.
+    void Run(Graph& graph, InputSlot& connection) const
+    {
+        Layer& base = connection.GetConnectedOutputSlot()->GetOwningLayer();
+        Layer& child = connection.GetOwningLayer();
+
+        BOOST_ASSERT(child.GetType() == LayerType::BatchNormalization);
+
+        auto& conv = *boost::polymorphic_downcast<ConvLayer*>(&base);
+        auto& batchNorm = *boost::polymorphic_downcast<BatchNormalizationLayer*>(&child);
+
+        if (base.GetOutputSlot().GetNumConnections() != 1 ||
+            base.GetDataType() != DataType::Float32 ||
+            conv.m_FusedActivation.has_value() ||
+            !conv.m_Weight || (conv.GetParameters().m_BiasEnabled && !conv.m_Bias) ||
+            !batchNorm.m_Mean || !batchNorm.m_Variance || !batchNorm.m_Beta || !batchNorm.m_Gamma)
+        {
+            return;
+        }
+
+        const TensorInfo& weightInfo = conv.m_Weight->GetTensorInfo();
+        const unsigned int numChannels = batchNorm.m_Mean->GetTensorInfo().GetNumElements();
+        if (GetNumOutputChannels(weightInfo.GetShape()) != numChannels)
+        {
+            return;
+        }
+
+        const float* mean     = batchNorm.m_Mean->template GetConstTensor<float>();
+        const float* variance = batchNorm.m_Variance->template GetConstTensor<float>();
+        const float* beta     = batchNorm.m_Beta->template GetConstTensor<float>();
+        const float* gamma    = batchNorm.m_Gamma->template GetConstTensor<float>();
+        const float  eps      = batchNorm.GetParameters().m_Eps;
+
+        // batchNorm(conv(x)) = scale * (W * x + b - mean) + beta = (scale * W) * x + scale * (b - mean) + beta
+        std::vector<float> scale(numChannels);
+        for (unsigned int c = 0; c < numChannels; ++c)
+        {
+            scale[c] = gamma[c] / std::sqrt(variance[c] + eps);
+        }
+
+        const float* weights = conv.m_Weight->template GetConstTensor<float>();
+        std::vector<float> newWeights(weightInfo.GetNumElements());
+        for (unsigned int i = 0; i < weightInfo.GetNumElements(); ++i)
+        {
+            newWeights[i] = weights[i] * scale[GetOutputChannel(weightInfo.GetShape(), i)];
+        }
+
+        const float* bias =
+            conv.GetParameters().m_BiasEnabled ? conv.m_Bias->template GetConstTensor<float>() : nullptr;
+        std::vector<float> newBias(numChannels);
+        for (unsigned int c = 0; c < numChannels; ++c)
+        {
+            newBias[c] = ((bias ? bias[c] : 0.0f) - mean[c]) * scale[c] + beta[c];
+        }
+
+        OutputSlot* parentOut = base.GetInputSlot(0).GetConnectedOutputSlot();
+
+        // Inserts the folded convolution before the base layer.
+        auto descriptor = conv.GetParameters();
+        descriptor.m_BiasEnabled = true;
+        const std::string name = std::string("fused-") + base.GetName() + std::string("-with-") + child.GetName();
+        auto& newConv = *graph.InsertNewLayer<ConvLayer>(base.GetInputSlot(0), descriptor, name.c_str());
+        newConv.m_Weight = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(weightInfo, newWeights));
+        newConv.m_Bias = std::make_unique<ScopedCpuTensorHandle>(
+            ConstTensor(TensorInfo({ numChannels }, DataType::Float32), newBias));
+        newConv.SetBackendId(base.GetBackendId());
+        newConv.GetOutputHandler().SetTensorInfo(child.GetOutputHandler().GetTensorInfo());
+        // Reconnects base with original parent.
+        newConv.GetOutputSlot().MoveAllConnections(*parentOut);
+
+        // Moves connections in child output to the folded layer.
+        // Child layer will be removed as it's left unconnected.
+        // Base layer will be removed if left unconnected.
+        child.GetOutputSlot().MoveAllConnections(newConv.GetOutputSlot());
+    }
+
+protected:
+    FuseBatchNormImpl() = default;
+    ~FuseBatchNormImpl() = default;
+
+private:
+    static constexpr bool IsDepthwise = std::is_same<ConvLayer, DepthwiseConvolution2dLayer>::value;
+
+    /// Convolution weights are [O, ...] in both data layouts; depthwise ones are [M, I, H, W] with output channel
+    /// i * M + m.
+    static unsigned int GetNumOutputChannels(const TensorShape& weightShape)
+    {
+        return IsDepthwise ? weightShape[0] * weightShape[1] : weightShape[0];
+    }
+
+    static unsigned int GetOutputChannel(const TensorShape& weightShape, unsigned int weightIndex)
+    {
+        const unsigned int kernelSize = weightShape[2] * weightShape[3];
+        if (IsDepthwise)
+        {
+            const unsigned int depthMultiplier = weightShape[0];
+            const unsigned int inputChannels   = weightShape[1];
+            const unsigned int m = weightIndex / (inputChannels * kernelSize);
+            const unsigned int i = weightIndex / kernelSize % inputChannels;
+            return i * depthMultiplier + m;
+        }
+        return weightIndex / (weightShape[1] * kernelSize);
+    }
+};
+
+using FuseBatchNormIntoConvolution2d =
+    OptimizeForConnection<Convolution2dLayer, BatchNormalizationLayer, FuseBatchNormImpl<Convolution2dLayer>>;
+using FuseBatchNormIntoDepthwiseConvolution2d =
+    OptimizeForConnection<DepthwiseConvolution2dLayer, BatchNormalizationLayer,
+                          FuseBatchNormImpl<DepthwiseConvolution2dLayer>>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -56,6 +56,7 @@ void TestLstmLayerVisitor::CheckDescriptor(const LstmDescriptor& descriptor)
     BOOST_CHECK(m_Descriptor.m_CifgEnabled == descriptor.m_CifgEnabled);
     BOOST_CHECK(m_Descriptor.m_PeepholeEnabled == descriptor.m_PeepholeEnabled);
     BOOST_CHECK(m_Descriptor.m_ProjectionEnabled == descriptor.m_ProjectionEnabled);
+    BOOST_CHECK(m_Descriptor.m_StatefulSequence == descriptor.m_StatefulSequence);
 }
 
 void TestLstmLayerVisitor::CheckConstTensorPtrs(const std::string& name,
@@ -568,4 +568,153 @@ BOOST_AUTO_TEST_CASE(DuplicateLayerNames)
     BOOST_TEST(((*std::next(it))->GetType() == armnn::LayerType::Output));
 }
 
+BOOST_AUTO_TEST_CASE(SetBatchSize)
+{
+    auto CreateGraph = [](armnn::Graph& graph, const armnn::TensorShape& reshapeTarget)
+    {
+        armnn::ViewsDescriptor splitterDescriptor(2, 2);
+        for (unsigned int i = 0; i < 2; ++i)
+        {
+            splitterDescriptor.SetViewOriginCoord(i, 1, i * 4);
+            splitterDescriptor.SetViewSize(i, 0, 2);
+            splitterDescriptor.SetViewSize(i, 1, 4);
+        }
+        armnn::ReshapeDescriptor reshapeDescriptor;
+        reshapeDescriptor.m_TargetShape = reshapeTarget;
+
+        // Splits the channels of the input, adds them together, then reshapes the result.
+        armnn::Layer* const input    = graph.AddLayer<armnn::InputLayer>(0, "input");
+        armnn::Layer* const splitter = graph.AddLayer<armnn::SplitterLayer>(splitterDescriptor, "splitter");
+        armnn::Layer* const addition = graph.AddLayer<armnn::AdditionLayer>("addition");
+        armnn::Layer* const reshape  = graph.AddLayer<armnn::ReshapeLayer>(reshapeDescriptor, "reshape");
+        armnn::Layer* const output   = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+        input->GetOutputSlot(0).Connect(splitter->GetInputSlot(0));
+        splitter->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+        splitter->GetOutputSlot(1).Connect(addition->GetInputSlot(1));
+        addition->GetOutputSlot(0).Connect(reshape->GetInputSlot(0));
+        reshape->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+        input->GetOutputSlot(0).SetTensorInfo(armnn::TensorInfo({ 2, 8 }, armnn::DataType::Float32));
+        splitter->GetOutputSlot(0).SetTensorInfo(armnn::TensorInfo({ 2, 4 }, armnn::DataType::Float32));
+        splitter->GetOutputSlot(1).SetTensorInfo(armnn::TensorInfo({ 2, 4 }, armnn::DataType::Float32));
+        addition->GetOutputSlot(0).SetTensorInfo(armnn::TensorInfo({ 2, 4 }, armnn::DataType::Float32));
+        reshape->GetOutputSlot(0).SetTensorInfo(armnn::TensorInfo(reshapeTarget, armnn::DataType::Float32));
+        return reshape;
+    };
+
+    armnn::Graph graph;
+    armnn::Layer* const reshape = CreateGraph(graph, { 2, 2, 2 });
+    graph.SetBatchSize(5);
+    BOOST_TEST(reshape->GetOutputSlot(0).GetTensorInfo().GetShape() == armnn::TensorShape({ 5, 2, 2 }));
+    BOOST_TEST(reshape->GetInputSlot(0).GetConnection()->GetTensorInfo().GetShape() == armnn::TensorShape({ 5, 4 }));
+
+    // The batch cannot change when it is folded into another dimension.
+    armnn::Graph flatGraph;
+    CreateGraph(flatGraph, { 8 });
+    BOOST_CHECK_THROW(flatGraph.SetBatchSize(5), armnn::InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(MemoryAwareTopologicalSort)
+{
+    armnn::Graph graph;
+
+    armnn::ActivationDescriptor activationDefaults;
+
+    // Two branches expanding the input into a large tensor, then reducing it.
+    //        input
+    //       /     \'
+    //  expandA   expandB
+    //     |         |
+    //  reduceA   reduceB
+    //       \     /
+    //       addition
+    armnn::Layer* const input    = graph.AddLayer<armnn::InputLayer>(0, "input");
+    armnn::Layer* const expandA  = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "expandA");
+    armnn::Layer* const expandB  = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "expandB");
+    armnn::Layer* const reduceA  = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "reduceA");
+    armnn::Layer* const reduceB  = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "reduceB");
+    armnn::Layer* const addition = graph.AddLayer<armnn::AdditionLayer>("addition");
+    armnn::Layer* const output   = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+    input->GetOutputSlot(0).Connect(expandA->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(expandB->GetInputSlot(0));
+    expandA->GetOutputSlot(0).Connect(reduceA->GetInputSlot(0));
+    expandB->GetOutputSlot(0).Connect(reduceB->GetInputSlot(0));
+    reduceA->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    reduceB->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    const armnn::TensorInfo smallInfo({ 4 }, armnn::DataType::Float32);
+    const armnn::TensorInfo largeInfo({ 400 }, armnn::DataType::Float32);
+    for (armnn::Layer* layer : { input, reduceA, reduceB, addition })
+    {
+        layer->GetOutputSlot(0).SetTensorInfo(smallInfo);
+    }
+    expandA->GetOutputSlot(0).SetTensorInfo(largeInfo);
+    expandB->GetOutputSlot(0).SetTensorInfo(largeInfo);
+
+    // Sorting by depth runs both expansions first, which keeps both large tensors alive.
+    BOOST_TEST(graph.GetPeakTensorBytes() == 2 * largeInfo.GetNumBytes() + smallInfo.GetNumBytes());
+
+    // Each branch completes before the other starts.
+    const size_t peakBytes = graph.MemoryAwareTopologicalSort();
+    BOOST_TEST(peakBytes == largeInfo.GetNumBytes() + 2 * smallInfo.GetNumBytes());
+    BOOST_TEST(graph.GetPeakTensorBytes() == peakBytes);
+
+    const std::vector<const armnn::Layer*> expectedOrder = { input, expandA, reduceA, expandB, reduceB, addition, output };
+    BOOST_TEST(std::equal(graph.begin(), graph.end(), expectedOrder.begin(), expectedOrder.end()));
+    BOOST_TEST(*graph.GetInputLayers().begin() == input);
+    BOOST_TEST(*graph.GetOutputLayers().begin() == output);
+}
+
+BOOST_AUTO_TEST_CASE(CompletionPositions)
+{
+    armnn::Graph graph;
+
+    armnn::ActivationDescriptor activationDefaults;
+
+    // Two branches of two layers each.
+    //        input
+    //       /     \'
+    //   branchA0  branchB0
+    //      |         |
+    //   branchA1  branchB1
+    //       \     /
+    //       addition
+    armnn::Layer* const input    = graph.AddLayer<armnn::InputLayer>(0, "input");
+    armnn::Layer* const branchA0 = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "branchA0");
+    armnn::Layer* const branchA1 = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "branchA1");
+    armnn::Layer* const branchB0 = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "branchB0");
+    armnn::Layer* const branchB1 = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "branchB1");
+    armnn::Layer* const addition = graph.AddLayer<armnn::AdditionLayer>("addition");
+    armnn::Layer* const output   = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+    input->GetOutputSlot(0).Connect(branchA0->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(branchB0->GetInputSlot(0));
+    branchA0->GetOutputSlot(0).Connect(branchA1->GetInputSlot(0));
+    branchB0->GetOutputSlot(0).Connect(branchB1->GetInputSlot(0));
+    branchA1->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    branchB1->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    const armnn::TensorInfo info({ 4 }, armnn::DataType::Float32);
+    for (armnn::Layer* layer : { input, branchA0, branchA1, branchB0, branchB1, addition })
+    {
+        layer->GetOutputSlot(0).SetTensorInfo(info);
+    }
+
+    graph.TopologicalSort();
+    const std::vector<const armnn::Layer*> expectedOrder =
+        { input, branchA0, branchB0, branchA1, branchB1, addition, output };
+    BOOST_TEST(std::equal(graph.begin(), graph.end(), expectedOrder.begin(), expectedOrder.end()));
+
+    const std::vector<size_t> inOrderPositions = graph.GetCompletionPositions(true);
+    BOOST_TEST(inOrderPositions == std::vector<size_t>({ 1, 2, 3, 4, 5, 6, 7 }), boost::test_tools::per_element());
+
+    // The layers of one branch may run alongside those of the other, until the addition joins them.
+    const std::vector<size_t> concurrentPositions = graph.GetCompletionPositions(false);
+    BOOST_TEST(concurrentPositions == std::vector<size_t>({ 1, 5, 4, 5, 5, 6, 7 }), boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
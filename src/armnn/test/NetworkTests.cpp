@@ -8,6 +8,7 @@
 #include <armnn/ArmNN.hpp>
 #include <armnn/LayerVisitorBase.hpp>
 #include <Network.hpp>
+#include <backendsCommon/CpuTensorHandle.hpp>
 
 #include <boost/test/unit_test.hpp>
 
@@ -469,4 +470,34 @@ BOOST_AUTO_TEST_CASE(Network_AddMerge)
     BOOST_TEST(testMerge.m_Visited == true);
 }
 
+BOOST_AUTO_TEST_CASE(Network_AddConstantMemory)
+{
+    auto data = std::make_shared<std::vector<float>>(8, 1.0f);
+    const float* begin = data->data();
+
+    armnn::Network net;
+    net.AddConstantMemory(std::shared_ptr<const void>(data, begin), 6 * sizeof(float));
+
+    const armnn::TensorInfo info({ 4 }, armnn::DataType::Float32);
+    std::vector<float> otherData(4, 2.0f);
+    auto referenced = net.AddConstantLayer(armnn::ConstTensor(info, begin + 2), "referenced");
+    auto overlapping = net.AddConstantLayer(armnn::ConstTensor(info, begin + 4), "overlapping");
+    auto copied = net.AddConstantLayer(armnn::ConstTensor(info, otherData), "copied");
+
+    auto GetOutput = [](armnn::IConnectableLayer* layer)
+    {
+        return boost::polymorphic_downcast<armnn::ConstantLayer*>(layer)->m_LayerOutput->GetConstTensor<float>();
+    };
+
+    // Only the tensor lying in the registered memory is referenced, and keeps the memory alive.
+    BOOST_TEST(GetOutput(referenced) == begin + 2);
+    BOOST_TEST(GetOutput(overlapping) != begin + 4);
+    BOOST_TEST(GetOutput(copied) != otherData.data());
+
+    std::weak_ptr<std::vector<float>> weakData = data;
+    data.reset();
+    BOOST_TEST(!weakData.expired());
+    BOOST_TEST(GetOutput(referenced)[0] == 1.0f);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -9,6 +9,11 @@
 #include <Optimizer.hpp>
 #include <backendsCommon/CpuTensorHandle.hpp>
 #include <FloatingPointConverter.hpp>
+#include <reference/RefWorkloadFactory.hpp>
+
+#include <boost/core/ignore_unused.hpp>
+
+#include <chrono>
 
 namespace
 {
@@ -1085,4 +1090,461 @@ BOOST_AUTO_TEST_CASE(DetectionPostProcessValidateTensorShapes)
     BOOST_CHECK_NO_THROW(graph.InferTensorInfos());
 }
 
+namespace
+{
+
+BatchNormalizationLayer* AddBatchNormalization(Graph& graph, const std::vector<float>& mean,
+                                               const std::vector<float>& variance, const std::vector<float>& beta,
+                                               const std::vector<float>& gamma)
+{
+    const TensorInfo info({ static_cast<unsigned int>(mean.size()) }, DataType::Float32);
+
+    BatchNormalizationDescriptor descriptor;
+    descriptor.m_Eps = 0.0f;
+
+    auto batchNorm = graph.AddLayer<BatchNormalizationLayer>(descriptor, "batchNorm");
+    batchNorm->m_Mean     = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, mean));
+    batchNorm->m_Variance = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, variance));
+    batchNorm->m_Beta     = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, beta));
+    batchNorm->m_Gamma    = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, gamma));
+    return batchNorm;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(FuseBatchNormIntoConvolution2dTest)
+{
+    Graph graph;
+
+    const TensorInfo inputInfo({ 1, 1, 2, 2 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 2, 2, 2 }, DataType::Float32);
+
+    Convolution2dDescriptor convDescriptor;
+    convDescriptor.m_BiasEnabled = true;
+
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    auto conv = graph.AddLayer<Convolution2dLayer>(convDescriptor, "conv");
+    conv->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ 2, 1, 1, 1 }, DataType::Float32), std::vector<float>{ 2.0f, -3.0f }));
+    conv->m_Bias = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ 2 }, DataType::Float32), std::vector<float>{ 1.0f, 5.0f }));
+    auto batchNorm = AddBatchNormalization(graph, { 3.0f, -1.0f }, { 4.0f, 0.25f }, { 0.5f, 1.0f }, { 1.0f, 2.0f });
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+    conv->GetOutputSlot().SetTensorInfo(outputInfo);
+    batchNorm->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    input->GetOutputSlot().Connect(conv->GetInputSlot(0));
+    conv->GetOutputSlot().Connect(batchNorm->GetInputSlot(0));
+    batchNorm->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseBatchNormIntoConvolution2d()));
+
+    // scale = gamma / sqrt(variance) = { 0.5, 4 }, weights * scale, (bias - mean) * scale + beta.
+    auto checkConv = [](const Layer* const layer) -> bool
+    {
+        const auto convLayer = static_cast<const Convolution2dLayer*>(layer);
+        if (!IsLayerOfType<Convolution2dLayer>(layer) || !convLayer->GetParameters().m_BiasEnabled)
+        {
+            return false;
+        }
+        const float* weights = convLayer->m_Weight->GetConstTensor<float>();
+        const float* bias = convLayer->m_Bias->GetConstTensor<float>();
+        return weights[0] == 1.0f && weights[1] == -12.0f && bias[0] == -0.5f && bias[1] == 25.0f;
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+                             graph.cend(),
+                             &IsLayerOfType<InputLayer>,
+                             checkConv,
+                             &IsLayerOfType<OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FuseBatchNormIntoDepthwiseConvolution2dTest)
+{
+    Graph graph;
+
+    // A depth multiplier of 2 over 2 input channels: weight (m, i) produces output channel i * 2 + m.
+    const TensorInfo inputInfo({ 1, 2, 2, 2 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 4, 2, 2 }, DataType::Float32);
+
+    DepthwiseConvolution2dDescriptor convDescriptor;
+
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    auto conv = graph.AddLayer<DepthwiseConvolution2dLayer>(convDescriptor, "depthwiseConv");
+    conv->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ 2, 2, 1, 1 }, DataType::Float32), std::vector<float>{ 1.0f, 1.0f, 1.0f, 1.0f }));
+    auto batchNorm = AddBatchNormalization(graph, { 0.0f, 1.0f, 2.0f, 3.0f }, { 1.0f, 1.0f, 1.0f, 1.0f },
+                                           { 0.0f, 0.0f, 0.0f, 0.0f }, { 1.0f, 2.0f, 3.0f, 4.0f });
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+    conv->GetOutputSlot().SetTensorInfo(outputInfo);
+    batchNorm->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    input->GetOutputSlot().Connect(conv->GetInputSlot(0));
+    conv->GetOutputSlot().Connect(batchNorm->GetInputSlot(0));
+    batchNorm->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseBatchNormIntoDepthwiseConvolution2d()));
+
+    auto checkConv = [](const Layer* const layer) -> bool
+    {
+        const auto convLayer = static_cast<const DepthwiseConvolution2dLayer*>(layer);
+        if (!IsLayerOfType<DepthwiseConvolution2dLayer>(layer) || !convLayer->GetParameters().m_BiasEnabled)
+        {
+            return false;
+        }
+        const float* weights = convLayer->m_Weight->GetConstTensor<float>();
+        const float* bias = convLayer->m_Bias->GetConstTensor<float>();
+        return weights[0] == 1.0f && weights[1] == 3.0f && weights[2] == 2.0f && weights[3] == 4.0f &&
+               bias[0] == 0.0f && bias[1] == -2.0f && bias[2] == -6.0f && bias[3] == -12.0f;
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+                             graph.cend(),
+                             &IsLayerOfType<InputLayer>,
+                             checkConv,
+                             &IsLayerOfType<OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FuseBatchNormSkipsSharedConvolutionOutputTest)
+{
+    Graph graph;
+
+    const TensorInfo info({ 1, 1, 2, 2 }, DataType::Float32);
+
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    auto conv = graph.AddLayer<Convolution2dLayer>(Convolution2dDescriptor(), "conv");
+    conv->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ 1, 1, 1, 1 }, DataType::Float32), std::vector<float>{ 2.0f }));
+    auto batchNorm = AddBatchNormalization(graph, { 1.0f }, { 4.0f }, { 0.0f }, { 1.0f });
+    auto output0 = graph.AddLayer<OutputLayer>(0, "output0");
+    auto output1 = graph.AddLayer<OutputLayer>(1, "output1");
+
+    input->GetOutputSlot().SetTensorInfo(info);
+    conv->GetOutputSlot().SetTensorInfo(info);
+    batchNorm->GetOutputSlot().SetTensorInfo(info);
+
+    // The output of the convolution is also a network output, so it must be kept as it is.
+    input->GetOutputSlot().Connect(conv->GetInputSlot(0));
+    conv->GetOutputSlot().Connect(batchNorm->GetInputSlot(0));
+    conv->GetOutputSlot().Connect(output1->GetInputSlot(0));
+    batchNorm->GetOutputSlot().Connect(output0->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseBatchNormIntoConvolution2d()));
+
+    BOOST_TEST(graph.GetNumLayers() == 5);
+    BOOST_TEST(conv->GetOutputSlot().GetNumConnections() == 2);
+    BOOST_TEST(!conv->GetParameters().m_BiasEnabled);
+}
+
+BOOST_AUTO_TEST_CASE(FuseActivationIntoFullyConnectedTest)
+{
+    Graph graph;
+
+    const TensorInfo inputInfo({ 1, 2 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 3 }, DataType::Float32);
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 6.0f;
+
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    auto fullyConnected = graph.AddLayer<FullyConnectedLayer>(FullyConnectedDescriptor(), "fullyConnected");
+    fullyConnected->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ 2, 3 }, DataType::Float32), std::vector<float>(6, 1.0f)));
+    auto activation = graph.AddLayer<ActivationLayer>(activationDescriptor, "activation");
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+    fullyConnected->GetOutputSlot().SetTensorInfo(outputInfo);
+    activation->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    input->GetOutputSlot().Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot().Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    for (auto&& layer : graph)
+    {
+        layer->SetBackendId(Compute::CpuRef);
+    }
+
+    // Layers assigned to another backend are left alone.
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseActivationIntoFullyConnected(Compute::CpuAcc)));
+    BOOST_TEST(graph.GetNumLayers() == 4);
+    BOOST_TEST(!fullyConnected->m_FusedActivation.has_value());
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseActivationIntoFullyConnected(Compute::CpuRef)));
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+                             graph.cend(),
+                             &IsLayerOfType<InputLayer>,
+                             &IsLayerOfType<FullyConnectedLayer>,
+                             &IsLayerOfType<OutputLayer>));
+    BOOST_TEST(fullyConnected->m_FusedActivation.has_value());
+    BOOST_TEST((fullyConnected->m_FusedActivation.value().m_Function == ActivationFunction::BoundedReLu));
+    BOOST_TEST(fullyConnected->m_FusedActivation.value().m_A == 6.0f);
+}
+
+BOOST_AUTO_TEST_CASE(FuseActivationSkipsRequantizingActivationTest)
+{
+    Graph graph;
+
+    const TensorInfo convOutputInfo({ 1, 1, 2, 2 }, DataType::QuantisedAsymm8, 0.5f, 128);
+    const TensorInfo activationOutputInfo({ 1, 1, 2, 2 }, DataType::QuantisedAsymm8, 0.25f, 0);
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    auto conv = graph.AddLayer<Convolution2dLayer>(Convolution2dDescriptor(), "conv");
+    conv->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ 1, 1, 1, 1 }, DataType::QuantisedAsymm8, 1.0f, 0), std::vector<uint8_t>{ 1 }));
+    auto activation = graph.AddLayer<ActivationLayer>(activationDescriptor, "activation");
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().SetTensorInfo(convOutputInfo);
+    conv->GetOutputSlot().SetTensorInfo(convOutputInfo);
+    activation->GetOutputSlot().SetTensorInfo(activationOutputInfo);
+
+    input->GetOutputSlot().Connect(conv->GetInputSlot(0));
+    conv->GetOutputSlot().Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    for (auto&& layer : graph)
+    {
+        layer->SetBackendId(Compute::CpuRef);
+    }
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseActivationIntoConvolution2d(Compute::CpuRef)));
+    BOOST_TEST(graph.GetNumLayers() == 4);
+    BOOST_TEST(!conv->m_FusedActivation.has_value());
+
+    // With the same quantization the activation can be applied to the output of the convolution.
+    activation->GetOutputSlot().SetTensorInfo(convOutputInfo);
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseActivationIntoConvolution2d(Compute::CpuRef)));
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+                             graph.cend(),
+                             &IsLayerOfType<InputLayer>,
+                             &IsLayerOfType<Convolution2dLayer>,
+                             &IsLayerOfType<OutputLayer>));
+    BOOST_TEST(conv->m_FusedActivation.has_value());
+}
+
+namespace
+{
+
+ConstantLayer* AddConstant(Graph& graph, const char* name, const TensorInfo& info, const std::vector<float>& values)
+{
+    auto constant = graph.AddLayer<ConstantLayer>(name);
+    constant->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, values));
+    constant->GetOutputSlot().SetTensorInfo(info);
+    return constant;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(FoldConstantsTest)
+{
+    Graph graph;
+
+    const TensorInfo info({ 1, 4 }, DataType::Float32);
+    const TensorInfo reshapedInfo({ 2, 2 }, DataType::Float32);
+
+    // (a * b) reshaped is computed from constants only, unlike its sum with the input.
+    auto a = AddConstant(graph, "a", info, { 1.0f, 2.0f, 3.0f, 4.0f });
+    auto b = AddConstant(graph, "b", info, { 2.0f, 2.0f, 2.0f, 2.0f });
+    auto multiplication = graph.AddLayer<MultiplicationLayer>("multiplication");
+    auto reshape = graph.AddLayer<ReshapeLayer>(ReshapeDescriptor(reshapedInfo.GetShape()), "reshape");
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    auto addition = graph.AddLayer<AdditionLayer>("addition");
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    multiplication->GetOutputSlot().SetTensorInfo(info);
+    reshape->GetOutputSlot().SetTensorInfo(reshapedInfo);
+    input->GetOutputSlot().SetTensorInfo(reshapedInfo);
+    addition->GetOutputSlot().SetTensorInfo(reshapedInfo);
+
+    a->GetOutputSlot().Connect(multiplication->GetInputSlot(0));
+    b->GetOutputSlot().Connect(multiplication->GetInputSlot(1));
+    multiplication->GetOutputSlot().Connect(reshape->GetInputSlot(0));
+    reshape->GetOutputSlot().Connect(addition->GetInputSlot(0));
+    input->GetOutputSlot().Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(
+        FoldConstants(std::make_shared<RefWorkloadFactory>())));
+
+    BOOST_TEST(graph.GetNumLayers() == 4);
+
+    // The multiplication and the reshape are replaced by a constant holding their result.
+    const Layer& folded = addition->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    BOOST_TEST(IsLayerOfType<ConstantLayer>(&folded));
+
+    const auto& values = *static_cast<const ConstantLayer&>(folded).m_LayerOutput;
+    BOOST_TEST((values.GetTensorInfo() == reshapedInfo));
+    const float* data = values.GetConstTensor<float>();
+    BOOST_TEST(std::vector<float>(data, data + 4) == std::vector<float>({ 2.0f, 4.0f, 6.0f, 8.0f }),
+               boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(FoldConstantsKeepsSharedConstantsTest)
+{
+    Graph graph;
+
+    const TensorInfo info({ 4 }, DataType::Float32);
+
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+
+    // The constant also feeds a layer that cannot be folded, so it must be kept.
+    auto constant = AddConstant(graph, "constant", info, { -1.0f, 2.0f, -3.0f, 4.0f });
+    auto relu = graph.AddLayer<ActivationLayer>(reluDescriptor, "relu");
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    auto addition = graph.AddLayer<AdditionLayer>("addition");
+    auto output0 = graph.AddLayer<OutputLayer>(0, "output0");
+    auto output1 = graph.AddLayer<OutputLayer>(1, "output1");
+
+    relu->GetOutputSlot().SetTensorInfo(info);
+    input->GetOutputSlot().SetTensorInfo(info);
+    addition->GetOutputSlot().SetTensorInfo(info);
+
+    constant->GetOutputSlot().Connect(relu->GetInputSlot(0));
+    constant->GetOutputSlot().Connect(addition->GetInputSlot(0));
+    input->GetOutputSlot().Connect(addition->GetInputSlot(1));
+    relu->GetOutputSlot().Connect(output0->GetInputSlot(0));
+    addition->GetOutputSlot().Connect(output1->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(
+        FoldConstants(std::make_shared<RefWorkloadFactory>())));
+
+    BOOST_TEST(graph.GetNumLayers() == 6);
+    BOOST_TEST(addition->GetInputSlot(0).GetConnectedOutputSlot() == &constant->GetOutputSlot());
+
+    const Layer& folded = output0->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    BOOST_TEST(IsLayerOfType<ConstantLayer>(&folded));
+    const float* data = static_cast<const ConstantLayer&>(folded).m_LayerOutput->GetConstTensor<float>();
+    BOOST_TEST(std::vector<float>(data, data + 4) == std::vector<float>({ 0.0f, 2.0f, 0.0f, 4.0f }),
+               boost::test_tools::per_element());
+}
+
+namespace
+{
+
+/// Counts the layers visited by the optimizer.
+class CountVisitsImpl
+{
+public:
+    CountVisitsImpl(size_t& numVisits)
+        : m_NumVisits(&numVisits)
+    {
+    }
+
+    void Run(Graph& graph, Layer& layer) const
+    {
+        boost::ignore_unused(graph, layer);
+        ++*m_NumVisits;
+    }
+
+protected:
+    ~CountVisitsImpl() = default;
+
+private:
+    size_t* m_NumVisits;
+};
+
+using CountVisits = OptimizeForType<Layer, CountVisitsImpl>;
+
+/// Optimizes a chain of numPairs pairs of inverse permutes, which are all removed. Returns the number of layers
+/// visited.
+size_t OptimizeInversePermutesChain(unsigned int numPairs, double& milliseconds)
+{
+    Graph graph;
+
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+    graph.InsertNewLayer<InputLayer>(output->GetInputSlot(0), 0, "input");
+    for (unsigned int i = 0; i < numPairs; ++i)
+    {
+        graph.InsertNewLayer<PermuteLayer>(output->GetInputSlot(0), PermuteDescriptor({0, 2, 3, 1}), "perm0231");
+        graph.InsertNewLayer<PermuteLayer>(output->GetInputSlot(0), PermuteDescriptor({0, 3, 1, 2}), "perm0312");
+    }
+
+    size_t numVisits = 0;
+    const auto start = std::chrono::steady_clock::now();
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(CountVisits(numVisits), OptimizeInversePermutes()));
+    milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<InputLayer>, &IsLayerOfType<OutputLayer>));
+    return numVisits;
+}
+
+/// Optimizes a chain of numAdditions additions of a ReLu of a constant, whose ReLus are all folded. Returns the number
+/// of layers visited.
+size_t FoldConstantsChain(unsigned int numAdditions, double& milliseconds)
+{
+    Graph graph;
+
+    const TensorInfo info({ 4 }, DataType::Float32);
+
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(info);
+
+    Layer* previous = input;
+    for (unsigned int i = 0; i < numAdditions; ++i)
+    {
+        auto constant = AddConstant(graph, "constant", info, { -1.0f, 2.0f, -3.0f, 4.0f });
+        auto relu = graph.AddLayer<ActivationLayer>(reluDescriptor, "relu");
+        auto addition = graph.AddLayer<AdditionLayer>("addition");
+
+        relu->GetOutputSlot().SetTensorInfo(info);
+        addition->GetOutputSlot().SetTensorInfo(info);
+
+        constant->GetOutputSlot().Connect(relu->GetInputSlot(0));
+        previous->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+        relu->GetOutputSlot().Connect(addition->GetInputSlot(1));
+        previous = addition;
+    }
+    previous->GetOutputSlot(0).Connect(graph.AddLayer<OutputLayer>(0, "output")->GetInputSlot(0));
+
+    size_t numVisits = 0;
+    const auto start = std::chrono::steady_clock::now();
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(CountVisits(numVisits),
+                                                           FoldConstants(std::make_shared<RefWorkloadFactory>())));
+    milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    BOOST_TEST(graph.GetNumLayers() == 2 * numAdditions + 2);
+    return numVisits;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(OptimizerScalesLinearlyTest)
+{
+    // Only the layers around those added or removed are visited again and the graph is sorted once, so the work grows
+    // linearly with the number of layers. The longest chains also check that deep graphs don't overflow the stack.
+    for (unsigned int size : { 2500U, 10000U })
+    {
+        double milliseconds = 0.0;
+        const size_t numVisits = OptimizeInversePermutesChain(size, milliseconds);
+        BOOST_TEST_MESSAGE("Removing " << size << " pairs of inverse permutes took " << milliseconds << " ms and "
+                           << numVisits << " visits");
+        BOOST_TEST(numVisits <= 2 * (2 * size + 2));
+    }
+
+    for (unsigned int size : { 1000U, 4000U })
+    {
+        double milliseconds = 0.0;
+        const size_t numVisits = FoldConstantsChain(size, milliseconds);
+        BOOST_TEST_MESSAGE("Folding " << size << " constant ReLus took " << milliseconds << " ms and "
+                           << numVisits << " visits");
+        BOOST_TEST(numVisits <= 2 * (3 * size + 2));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
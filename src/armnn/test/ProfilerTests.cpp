@@ -6,8 +6,11 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/output_test_stream.hpp>
 #include <boost/algorithm/string.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
 
 #include <memory>
+#include <sstream>
 #include <thread>
 
 #include <armnn/TypesUtils.hpp>
@@ -240,4 +243,153 @@ BOOST_AUTO_TEST_CASE(WriteEventResults)
     profiler->EnableProfiling(false);
 }
 
+BOOST_AUTO_TEST_CASE(RingBufferProfiling)
+{
+    armnn::ProfilerManager& profilerManager = armnn::ProfilerManager::GetInstance();
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    profilerManager.RegisterProfiler(profiler.get());
+    profiler->EnableProfiling(true);
+    profiler->EnableRingBufferProfiling(3);
+
+    // The capacity is rounded up to a power of two.
+    BOOST_TEST(profiler->GetRingBuffer()->GetCapacity() == 4);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        { ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuAcc, "test1"); }
+        { ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuAcc, "test2"); }
+    }
+
+    // The events are not added to the full sequence, and only the most recent ones are kept.
+    BOOST_TEST(armnn::GetProfilerEventSequenceSize(profiler.get()) == 0);
+    BOOST_TEST(profiler->GetRingBuffer()->GetNumPushed() == 6);
+    BOOST_TEST(profiler->GetRingBuffer()->GetRecords().size() == 4);
+
+    std::vector<armnn::EventStatistics> statistics = profiler->GetEventStatistics();
+    BOOST_TEST(statistics.size() == 2);
+    BOOST_TEST(statistics[0].m_Name == "test1");
+    BOOST_TEST(statistics[0].m_Count == 2);
+    BOOST_TEST(statistics[1].m_Name == "test2");
+    BOOST_TEST(statistics[1].m_Count == 2);
+
+    // Back to the default mode.
+    profiler->EnableRingBufferProfiling(0);
+    BOOST_TEST(!profiler->GetRingBuffer());
+    { ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuAcc, "test1"); }
+    BOOST_TEST(armnn::GetProfilerEventSequenceSize(profiler.get()) == 1);
+
+    profiler->EnableProfiling(false);
+}
+
+BOOST_AUTO_TEST_CASE(RingBufferProfilingMultipleThreads)
+{
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    profiler->EnableProfiling(true);
+    profiler->EnableRingBufferProfiling(256);
+
+    // Important! Don't use BOOST_TEST macros in the threads.
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&profiler]()
+        {
+            armnn::ProfilerManager::GetInstance().RegisterProfiler(profiler.get());
+            for (int j = 0; j < 1000; ++j)
+            {
+                ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuAcc, "test");
+            }
+            armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    BOOST_TEST(profiler->GetRingBuffer()->GetNumPushed() == 4000);
+
+    std::vector<armnn::EventStatistics> statistics = profiler->GetEventStatistics();
+    BOOST_TEST(statistics.size() == 1);
+    BOOST_TEST(statistics[0].m_Name == "test");
+    BOOST_TEST(statistics[0].m_Count == 256);
+    BOOST_TEST(statistics[0].m_MinMs <= statistics[0].m_P50Ms);
+    BOOST_TEST(statistics[0].m_P50Ms <= statistics[0].m_P99Ms);
+    BOOST_TEST(statistics[0].m_P99Ms <= statistics[0].m_MaxMs);
+
+    profiler->EnableProfiling(false);
+}
+
+BOOST_AUTO_TEST_CASE(RingBufferEventStatistics)
+{
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    profiler->EnableRingBufferProfiling(128);
+
+    // Durations of 1ms to 100ms, recorded in reverse order.
+    armnn::ProfilingRingBuffer* ringBuffer = profiler->GetRingBuffer();
+    const uint32_t labelId = ringBuffer->InternLabel("test");
+    BOOST_TEST(ringBuffer->InternLabel("test") == labelId);
+    for (uint64_t i = 100; i > 0; --i)
+    {
+        ringBuffer->Push(labelId, 1000, 1000 + i * 1000000);
+    }
+
+    std::vector<armnn::EventStatistics> statistics = profiler->GetEventStatistics();
+    BOOST_TEST(statistics.size() == 1);
+    BOOST_TEST(statistics[0].m_Count == 100);
+    BOOST_TEST(statistics[0].m_MeanMs == 50.5, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(statistics[0].m_MinMs == 1.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(statistics[0].m_MaxMs == 100.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(statistics[0].m_P50Ms == 50.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(statistics[0].m_P99Ms == 99.0, boost::test_tools::tolerance(1e-9));
+}
+
+BOOST_AUTO_TEST_CASE(WriteChromeTrace)
+{
+    armnn::ProfilerManager& profilerManager = armnn::ProfilerManager::GetInstance();
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    profilerManager.RegisterProfiler(profiler.get());
+    profiler->EnableProfiling(true);
+
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "EnqueueWorkload");
+        { ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuAcc, "Workload \"1\""); }
+        { ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuAcc, "Workload 2"); }
+    }
+
+    std::stringstream trace;
+    profiler->WriteChromeTrace(trace);
+
+    // The trace must be valid JSON, holding one complete event per profiling event.
+    boost::property_tree::ptree root;
+    BOOST_CHECK_NO_THROW(boost::property_tree::read_json(trace, root));
+
+    std::vector<boost::property_tree::ptree> events;
+    for (const auto& child : root.get_child("traceEvents"))
+    {
+        events.push_back(child.second);
+    }
+    BOOST_TEST(events.size() == 3);
+    BOOST_TEST(events[0].get<std::string>("name") == "EnqueueWorkload");
+    BOOST_TEST(events[0].get<std::string>("cat") == "CpuRef");
+    BOOST_TEST(events[1].get<std::string>("name") == "Workload \"1\"");
+    BOOST_TEST(events[1].get<std::string>("cat") == "CpuAcc");
+    BOOST_TEST(events[2].get<std::string>("name") == "Workload 2");
+    for (const auto& event : events)
+    {
+        BOOST_TEST(event.get<std::string>("ph") == "X");
+        BOOST_TEST(event.get<uint32_t>("tid") == armnn::GetProfilingThreadId());
+    }
+
+    // Nested events lie within their parent (up to the rounding of the times to nanoseconds).
+    const double parentStart = events[0].get<double>("ts") - 0.002;
+    const double parentEnd = events[0].get<double>("ts") + events[0].get<double>("dur") + 0.002;
+    for (unsigned int i = 1; i < events.size(); ++i)
+    {
+        BOOST_TEST(events[i].get<double>("ts") >= parentStart);
+        BOOST_TEST(events[i].get<double>("ts") + events[i].get<double>("dur") <= parentEnd);
+    }
+
+    profiler->EnableProfiling(false);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,202 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <boost/test/unit_test.hpp>
+
+#include <RequestBatcher.hpp>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace armnn;
+
+namespace
+{
+
+// Doubles the input of a network with one input and one output, recording the batch size of each execution.
+class DoublingNetwork
+{
+public:
+    RequestBatcher::ExecuteFunction GetExecuteFunction(bool failBatches = false)
+    {
+        return [this, failBatches](NetworkId networkId, const InputTensors& inputs, const OutputTensors& outputs)
+        {
+            const unsigned int batchSize = inputs[0].second.GetShape()[0];
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Executions.emplace_back(networkId, batchSize);
+            }
+            if (failBatches && batchSize > 1)
+            {
+                return Status::Failure;
+            }
+
+            const float* input = static_cast<const float*>(inputs[0].second.GetMemoryArea());
+            float* output = static_cast<float*>(outputs[0].second.GetMemoryArea());
+            for (unsigned int i = 0; i < inputs[0].second.GetNumElements(); ++i)
+            {
+                output[i] = 2.0f * input[i];
+            }
+            return Status::Success;
+        };
+    }
+
+    std::vector<std::pair<NetworkId, unsigned int>> GetExecutions()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Executions;
+    }
+
+private:
+    std::mutex m_Mutex;
+    std::vector<std::pair<NetworkId, unsigned int>> m_Executions;
+};
+
+// A request of one item of the given size, whose input is filled with the given value.
+struct Request
+{
+    Request(NetworkId networkId, unsigned int itemSize, float value)
+        : m_NetworkId(networkId)
+        , m_Info({ 1, itemSize }, DataType::Float32)
+        , m_Input(itemSize, value)
+        , m_Output(itemSize, 0.0f)
+    {}
+
+    void Push(RequestBatcher& batcher)
+    {
+        batcher.Push(m_NetworkId,
+                     { { 0, ConstTensor(m_Info, m_Input.data()) } },
+                     { { 0, Tensor(m_Info, m_Output.data()) } },
+                     [this](Status status) { m_Status.set_value(status); });
+    }
+
+    NetworkId m_NetworkId;
+    TensorInfo m_Info;
+    std::vector<float> m_Input;
+    std::vector<float> m_Output;
+    std::promise<Status> m_Status;
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RequestBatcherTests)
+
+BOOST_AUTO_TEST_CASE(CompatibleRequestsAreCoalesced)
+{
+    DoublingNetwork network;
+    std::vector<std::unique_ptr<Request>> requests;
+    {
+        RequestBatcher batcher(network.GetExecuteFunction(), 4, std::chrono::milliseconds(200));
+        for (unsigned int i = 0; i < 6; ++i)
+        {
+            requests.push_back(std::make_unique<Request>(0, 3, static_cast<float>(i)));
+            requests.back()->Push(batcher);
+        }
+
+        for (auto& request : requests)
+        {
+            BOOST_TEST((request->m_Status.get_future().get() == Status::Success));
+        }
+    }
+
+    // A full batch runs straight away, the rest once the oldest request has waited for long enough.
+    const std::vector<std::pair<NetworkId, unsigned int>> expectedExecutions = { { 0, 4 }, { 0, 2 } };
+    BOOST_TEST((network.GetExecutions() == expectedExecutions));
+
+    for (unsigned int i = 0; i < requests.size(); ++i)
+    {
+        const std::vector<float> expectedOutput(3, 2.0f * static_cast<float>(i));
+        BOOST_TEST(requests[i]->m_Output == expectedOutput, boost::test_tools::per_element());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(IncompatibleRequestsAreNotCoalesced)
+{
+    DoublingNetwork network;
+    Request first(0, 3, 1.0f);
+    Request otherNetwork(1, 3, 2.0f);
+    Request otherShape(0, 5, 3.0f);
+    Request last(0, 3, 4.0f);
+    {
+        RequestBatcher batcher(network.GetExecuteFunction(), 4, std::chrono::milliseconds(50));
+        for (Request* request : { &first, &otherNetwork, &otherShape, &last })
+        {
+            request->Push(batcher);
+        }
+    }
+
+    // Only consecutive requests are coalesced, so the last request does not overtake the two before it.
+    const std::vector<std::pair<NetworkId, unsigned int>> expectedExecutions =
+        { { 0, 1 }, { 1, 1 }, { 0, 1 }, { 0, 1 } };
+    BOOST_TEST((network.GetExecutions() == expectedExecutions));
+    BOOST_TEST(otherShape.m_Output == std::vector<float>(5, 6.0f), boost::test_tools::per_element());
+    BOOST_TEST(last.m_Output == std::vector<float>(3, 8.0f), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(FailedBatchesAreExecutedRequestByRequest)
+{
+    DoublingNetwork network;
+    Request first(0, 2, 1.0f);
+    Request second(0, 2, 2.0f);
+    {
+        RequestBatcher batcher(network.GetExecuteFunction(true), 2, std::chrono::milliseconds(200));
+        first.Push(batcher);
+        second.Push(batcher);
+    }
+
+    const std::vector<std::pair<NetworkId, unsigned int>> expectedExecutions = { { 0, 2 }, { 0, 1 }, { 0, 1 } };
+    BOOST_TEST((network.GetExecutions() == expectedExecutions));
+    BOOST_TEST((first.m_Status.get_future().get() == Status::Success));
+    BOOST_TEST((second.m_Status.get_future().get() == Status::Success));
+    BOOST_TEST(second.m_Output == std::vector<float>(2, 4.0f), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(ThrowingCallbacksDoNotStopTheBatcher)
+{
+    DoublingNetwork network;
+    Request last(0, 2, 1.0f);
+    {
+        RequestBatcher batcher(network.GetExecuteFunction(), 1, std::chrono::milliseconds(0));
+        TensorInfo info({ 1, 2 }, DataType::Float32);
+        std::vector<float> input(2, 0.0f);
+        std::vector<float> output(2, 0.0f);
+        batcher.Push(0,
+                     { { 0, ConstTensor(info, input.data()) } },
+                     { { 0, Tensor(info, output.data()) } },
+                     [](Status) { throw std::runtime_error("callback failure"); });
+        last.Push(batcher);
+
+        BOOST_TEST((last.m_Status.get_future().get() == Status::Success));
+    }
+    BOOST_TEST(last.m_Output == std::vector<float>(2, 2.0f), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(SeveralThreadsExecuteRequests)
+{
+    DoublingNetwork network;
+    std::vector<std::unique_ptr<Request>> requests;
+    {
+        RequestBatcher batcher(network.GetExecuteFunction(), 1, std::chrono::milliseconds(0), 3);
+        for (unsigned int i = 0; i < 12; ++i)
+        {
+            requests.push_back(std::make_unique<Request>(i % 3, 4, static_cast<float>(i)));
+            requests.back()->Push(batcher);
+        }
+    }
+
+    BOOST_TEST(network.GetExecutions().size() == requests.size());
+    for (unsigned int i = 0; i < requests.size(); ++i)
+    {
+        BOOST_TEST((requests[i]->m_Status.get_future().get() == Status::Success));
+        const std::vector<float> expectedOutput(4, 2.0f * static_cast<float>(i));
+        BOOST_TEST(requests[i]->m_Output == expectedOutput, boost::test_tools::per_element());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,7 @@
 #include <armnn/Descriptors.hpp>
 #include <armnn/IRuntime.hpp>
 #include <armnn/INetwork.hpp>
+#include <Network.hpp>
 #include <Runtime.hpp>
 #include <armnn/TypesUtils.hpp>
 
@@ -16,6 +17,7 @@
 #include <valgrind/memcheck.h>
 #endif
 
+#include <boost/polymorphic_cast.hpp>
 #include <boost/test/unit_test.hpp>
 
 namespace armnn
@@ -228,6 +230,89 @@ BOOST_AUTO_TEST_CASE(RuntimeFallbackToCpuRef)
     BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
 }
 
+BOOST_AUTO_TEST_CASE(RuntimeCpuRefComputesInPlace)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // input0 -> floor -> relu -> addition (with input1) -> reshape -> output
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input0 = net->AddInputLayer(0);
+    IConnectableLayer* input1 = net->AddInputLayer(1);
+    IConnectableLayer* floor = net->AddFloorLayer("floor");
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+    IConnectableLayer* relu = net->AddActivationLayer(activationDescriptor, "relu");
+
+    IConnectableLayer* addition = net->AddAdditionLayer("addition");
+
+    ReshapeDescriptor reshapeDescriptor;
+    reshapeDescriptor.m_TargetShape = TensorShape({ 2, 2 });
+    IConnectableLayer* reshape = net->AddReshapeLayer(reshapeDescriptor, "reshape");
+
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input0->GetOutputSlot(0).Connect(floor->GetInputSlot(0));
+    floor->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(reshape->GetInputSlot(0));
+    reshape->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    const TensorInfo tensorInfo({ 1, 4 }, DataType::Float32);
+    for (IConnectableLayer* layer : { input0, input1, floor, relu, addition })
+    {
+        layer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    }
+    reshape->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2, 2 }, DataType::Float32));
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+    Graph& graph = boost::polymorphic_downcast<OptimizedNetwork*>(optNet.get())->GetGraph();
+
+    armnn::NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // The floor may not overwrite the network input, the layers after it overwrite the floor output.
+    auto getOutputHandle = [&graph](const std::string& name) -> const ITensorHandle*
+    {
+        for (auto&& layer : graph)
+        {
+            if (layer->GetNameStr() == name)
+            {
+                return layer->GetOutputSlot(0).GetOutputHandler().GetData();
+            }
+        }
+        return nullptr;
+    };
+    BOOST_TEST(getOutputHandle("floor")->GetParent() == nullptr);
+    BOOST_TEST(getOutputHandle("relu")->GetParent() == getOutputHandle("floor"));
+    BOOST_TEST(getOutputHandle("addition")->GetParent() == getOutputHandle("relu"));
+    BOOST_TEST(getOutputHandle("reshape")->GetParent() == getOutputHandle("addition"));
+
+    std::vector<float> input0Data = { -1.5f, 0.5f, 2.5f, 3.0f };
+    std::vector<float> input1Data = { 1.0f, 2.0f, 3.0f, 4.0f };
+    std::vector<float> outputData(4);
+    InputTensors inputTensors
+    {
+        { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), input0Data.data()) },
+        { 1, ConstTensor(runtime->GetInputTensorInfo(netId, 1), input1Data.data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+    };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+
+    const std::vector<float> expectedOutput = { 1.0f, 2.0f, 5.0f, 7.0f };
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+    BOOST_TEST(input0Data == std::vector<float>({ -1.5f, 0.5f, 2.5f, 3.0f }), boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_CASE(IVGCVSW_1929_QuantizedSoftmaxIssue)
 {
     // Test for issue reported by Chris Nix in https://jira.arm.com/browse/IVGCVSW-1929
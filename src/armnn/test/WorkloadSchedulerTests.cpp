@@ -0,0 +1,148 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <boost/algorithm/string.hpp>
+
+#include <Profiling.hpp>
+#include <WorkloadScheduler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace armnn;
+
+BOOST_AUTO_TEST_SUITE(WorkloadScheduler)
+
+BOOST_AUTO_TEST_CASE(WorkloadsRunAfterTheirDependencies)
+{
+    // 0 -> { 1, 2, 3, 4 } -> 5, the shape of an inception block, followed by a chain 5 -> 6 -> 7.
+    const std::vector<std::vector<unsigned int>> dependencies =
+        { {}, { 0 }, { 0 }, { 0 }, { 0 }, { 1, 2, 3, 4 }, { 5 }, { 6 } };
+    armnn::WorkloadScheduler scheduler(dependencies, std::make_shared<ThreadPool>(4));
+    BOOST_TEST(scheduler.GetNumWorkloads() == dependencies.size());
+
+    for (int run = 0; run < 20; ++run)
+    {
+        std::vector<std::atomic<unsigned int>> numExecutions(dependencies.size());
+        for (auto& count : numExecutions)
+        {
+            count = 0;
+        }
+
+        // Boost.Test checks are not thread safe, so the workloads only record what they see.
+        std::atomic<bool> ranTooEarly(false);
+        scheduler.Execute([&](unsigned int workload)
+        {
+            for (unsigned int dependency : dependencies[workload])
+            {
+                ranTooEarly = ranTooEarly || numExecutions[dependency] != 1;
+            }
+            ++numExecutions[workload];
+        });
+
+        BOOST_TEST(!ranTooEarly);
+        for (auto& count : numExecutions)
+        {
+            BOOST_TEST(count == 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(IndependentWorkloadsRunConcurrently)
+{
+    armnn::WorkloadScheduler scheduler({ {}, {} }, std::make_shared<ThreadPool>(2));
+
+    // Each workload waits for the other one to start, which only happens if they run at the same time.
+    std::atomic<unsigned int> numStarted(0);
+    std::atomic<bool> sawOther[2] = { { false }, { false } };
+    scheduler.Execute([&](unsigned int workload)
+    {
+        ++numStarted;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (numStarted < 2 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+        sawOther[workload] = numStarted == 2;
+    });
+
+    BOOST_TEST(sawOther[0]);
+    BOOST_TEST(sawOther[1]);
+}
+
+BOOST_AUTO_TEST_CASE(IdleThreadsHelpWithTheLoopsOfWorkloads)
+{
+    auto threadPool = std::make_shared<ThreadPool>(2);
+    armnn::WorkloadScheduler scheduler({ {}, { 0 } }, threadPool);
+
+    // Each range of the loop waits for the other one to start, which only happens if the thread left without a
+    // workload takes part in it.
+    std::atomic<bool> sawOther[2] = { { false }, { false } };
+    scheduler.Execute([&](unsigned int workload)
+    {
+        std::atomic<unsigned int> numStarted(0);
+        threadPool->ParallelFor(2, ThreadPool::MinWorkPerRange, [&](unsigned int begin, unsigned int)
+        {
+            ++numStarted;
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (numStarted < 2 && std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::yield();
+            }
+            if (begin == 0)
+            {
+                sawOther[workload] = numStarted == 2;
+            }
+        });
+    });
+
+    BOOST_TEST(sawOther[0]);
+    BOOST_TEST(sawOther[1]);
+}
+
+BOOST_AUTO_TEST_CASE(FailureStopsTheExecution)
+{
+    armnn::WorkloadScheduler scheduler({ {}, { 0 }, { 1 } }, std::make_shared<ThreadPool>(3));
+
+    std::atomic<bool> dependentRan(false);
+    BOOST_CHECK_THROW(scheduler.Execute([&](unsigned int workload)
+    {
+        if (workload == 1)
+        {
+            throw std::runtime_error("workload failed");
+        }
+        dependentRan = dependentRan || workload == 2;
+    }), std::runtime_error);
+    BOOST_TEST(!dependentRan);
+
+    // The scheduler can be used again afterwards.
+    std::atomic<unsigned int> numExecuted(0);
+    scheduler.Execute([&](unsigned int) { ++numExecuted; });
+    BOOST_TEST(numExecuted == 3);
+}
+
+BOOST_AUTO_TEST_CASE(ExecutionIsProfiled)
+{
+    auto profiler = std::make_unique<armnn::Profiler>();
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(profiler.get());
+    profiler->EnableProfiling(true);
+
+    armnn::WorkloadScheduler scheduler({ {}, {} }, std::make_shared<ThreadPool>(2));
+    scheduler.Execute([](unsigned int) {});
+
+    boost::test_tools::output_test_stream output;
+    profiler->AnalyzeEventsAndWriteResults(output);
+    BOOST_CHECK(boost::contains(output.str(), "ScheduleWorkloads"));
+
+    profiler.reset();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
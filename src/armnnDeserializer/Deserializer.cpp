@@ -25,6 +25,11 @@
 // The generated code based on the Serialize schema:
 #include <ArmnnSchema_generated.h>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <fstream>
 #include <algorithm>
 #include <limits>
@@ -591,6 +596,51 @@ armnn::INetworkPtr Deserializer::CreateNetworkFromBinary(std::istream& binaryCon
     return CreateNetworkFromGraph(graph);
 }
 
+armnn::INetworkPtr Deserializer::CreateNetworkFromFile(const char* graphFile)
+{
+    ResetParser();
+    if (graphFile == nullptr)
+    {
+        throw InvalidArgumentException(boost::str(boost::format("Invalid (null) filename %1%") %
+                                                  CHECK_LOCATION().AsString()));
+    }
+
+    const int fileDescriptor = open(graphFile, O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        throw FileNotFoundException(boost::str(boost::format("Cannot open file %1% %2%") %
+                                               graphFile %
+                                               CHECK_LOCATION().AsString()));
+    }
+
+    struct stat fileStat;
+    if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close(fileDescriptor);
+        throw ParseException(boost::str(boost::format("Cannot read file %1% %2%") %
+                                        graphFile %
+                                        CHECK_LOCATION().AsString()));
+    }
+    const size_t fileSize = static_cast<size_t>(fileStat.st_size);
+
+    // The mapping outlives the file descriptor, and the network if its constant tensors are still used.
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (mapping == MAP_FAILED)
+    {
+        throw ParseException(boost::str(boost::format("Cannot map file %1% %2%") %
+                                        graphFile %
+                                        CHECK_LOCATION().AsString()));
+    }
+    std::shared_ptr<const void> content(mapping, [fileSize](const void* memory)
+    {
+        munmap(const_cast<void*>(memory), fileSize);
+    });
+
+    GraphPtr graph = LoadGraphFromBinary(static_cast<const uint8_t*>(content.get()), fileSize);
+    return CreateNetworkFromGraph(graph, content, fileSize);
+}
+
 Deserializer::GraphPtr Deserializer::LoadGraphFromBinary(const uint8_t* binaryContent, size_t len)
 {
     if (binaryContent == nullptr)
@@ -610,9 +660,15 @@ Deserializer::GraphPtr Deserializer::LoadGraphFromBinary(const uint8_t* binaryCo
     return GetSerializedGraph(binaryContent);
 }
 
-INetworkPtr Deserializer::CreateNetworkFromGraph(GraphPtr graph)
+INetworkPtr Deserializer::CreateNetworkFromGraph(GraphPtr graph,
+                                                 std::shared_ptr<const void> constantMemory,
+                                                 size_t constantMemorySize)
 {
     m_Network = INetwork::Create();
+    if (constantMemory)
+    {
+        m_Network->AddConstantMemory(std::move(constantMemory), constantMemorySize);
+    }
     BOOST_ASSERT(graph != nullptr);
     unsigned int layerIndex = 0;
     m_GraphConnections.emplace_back(graph->layers()->size());
@@ -739,6 +795,7 @@ void Deserializer::RegisterOutputSlots(GraphPtr graph,
     CHECK_LAYERS(graph, 0, layerIndex);
     BOOST_ASSERT(layer != nullptr);
     auto parsedLayer = GetBaseLayer(graph, layerIndex);
+    SetBackendId(parsedLayer, layer);
     if (parsedLayer->outputSlots()->size() != layer->GetNumOutputSlots())
     {
         throw ParseException(
@@ -764,6 +821,7 @@ void Deserializer::RegisterInputSlots(GraphPtr graph,
     CHECK_LAYERS(graph, 0, layerIndex);
     BOOST_ASSERT(layer != nullptr);
     auto parsedLayer = GetBaseLayer(graph, layerIndex);
+    SetBackendId(parsedLayer, layer);
     if (parsedLayer->inputSlots()->size() != layer->GetNumInputSlots())
     {
         throw ParseException(
@@ -784,6 +842,15 @@ void Deserializer::RegisterInputSlots(GraphPtr graph,
     }
 }
 
+void Deserializer::SetBackendId(LayerBaseRawPtr parsedLayer, armnn::IConnectableLayer* layer)
+{
+    // Only the networks exported from optimized networks have their layers assigned to backends.
+    if (parsedLayer->backendId() != nullptr)
+    {
+        layer->SetBackendId(parsedLayer->backendId()->str());
+    }
+}
+
 void Deserializer::RegisterInputSlotOfConnection(uint32_t sourceLayerIndex,
                                                  uint32_t outputSlotIndex,
                                                  armnn::IInputSlot* slot)
@@ -1973,6 +2040,7 @@ armnn::LstmDescriptor Deserializer::GetLstmDescriptor(Deserializer::LstmDescript
     desc.m_CifgEnabled = lstmDescriptor->cifgEnabled();
     desc.m_PeepholeEnabled = lstmDescriptor->peepholeEnabled();
     desc.m_ProjectionEnabled = lstmDescriptor->projectionEnabled();
+    desc.m_StatefulSequence = lstmDescriptor->statefulSequence();
 
     return desc;
 }
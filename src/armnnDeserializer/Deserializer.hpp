@@ -37,6 +37,9 @@ public:
     /// Create an input network from a binary input stream
     armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent) override;
 
+    /// Create an input network from a binary file mapped into memory
+    armnn::INetworkPtr CreateNetworkFromFile(const char* graphFile) override;
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by the given layer name
     BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId, const std::string& name) const override;
 
@@ -71,8 +74,11 @@ private:
     Deserializer(const Deserializer&) = delete;
     Deserializer& operator=(const Deserializer&) = delete;
 
-    /// Create the network from an already loaded flatbuffers graph
-    armnn::INetworkPtr CreateNetworkFromGraph(GraphPtr graph);
+    /// Create the network from an already loaded flatbuffers graph. The constant tensors lying in constantMemory
+    /// are referenced rather than copied.
+    armnn::INetworkPtr CreateNetworkFromGraph(GraphPtr graph,
+                                              std::shared_ptr<const void> constantMemory = nullptr,
+                                              size_t constantMemorySize = 0);
 
     // signature for the parser functions
     using LayerParsingFunction = void(Deserializer::*)(GraphPtr graph, unsigned int layerIndex);
@@ -122,6 +128,7 @@ private:
                             armnn::IConnectableLayer* layer);
     void RegisterOutputSlots(GraphPtr graph, uint32_t layerIndex,
                              armnn::IConnectableLayer* layer);
+    static void SetBackendId(LayerBaseRawPtr parsedLayer, armnn::IConnectableLayer* layer);
     void ResetParser();
 
     void SetupInputLayers(GraphPtr graphPtr);
@@ -0,0 +1,133 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnn/ArmNN.hpp>
+#include <armnnDeserializer/IDeserializer.hpp>
+#include <armnnSerializer/ISerializer.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using armnnDeserializer::IDeserializer;
+
+namespace
+{
+
+// Input + constant -> addition -> output, serialized.
+std::string SerializeConstantAddNetwork(const std::vector<float>& constantData)
+{
+    const armnn::TensorInfo info({ 2, 2 }, armnn::DataType::Float32);
+
+    armnn::INetworkPtr network = armnn::INetwork::Create();
+    armnn::IConnectableLayer* const inputLayer    = network->AddInputLayer(0, "input");
+    armnn::IConnectableLayer* const constantLayer =
+        network->AddConstantLayer(armnn::ConstTensor(info, constantData), "constant");
+    armnn::IConnectableLayer* const additionLayer = network->AddAdditionLayer("addition");
+    armnn::IConnectableLayer* const outputLayer   = network->AddOutputLayer(0, "output");
+
+    inputLayer->GetOutputSlot(0).Connect(additionLayer->GetInputSlot(0));
+    constantLayer->GetOutputSlot(0).Connect(additionLayer->GetInputSlot(1));
+    additionLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+
+    inputLayer->GetOutputSlot(0).SetTensorInfo(info);
+    constantLayer->GetOutputSlot(0).SetTensorInfo(info);
+    additionLayer->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnnSerializer::ISerializerPtr serializer = armnnSerializer::ISerializer::Create();
+    serializer->Serialize(*network);
+
+    std::stringstream stream;
+    serializer->SaveSerializedToStream(stream);
+    return stream.str();
+}
+
+std::string SaveToTemporaryFile(const std::string& content)
+{
+    using namespace boost::filesystem;
+    const std::string fileName = unique_path(temp_directory_path() / "%%%%-%%%%-%%%%.armnn").string();
+
+    std::ofstream file(fileName, std::ios::binary);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    BOOST_CHECK_MESSAGE(file.good(), "Cannot save test file");
+    return fileName;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(DeserializeParser)
+
+BOOST_AUTO_TEST_CASE(DeserializeFromFileAndRunAfterTheParserIsGone)
+{
+    const std::vector<float> constantData = { 1.0f, 2.0f, 3.0f, 4.0f };
+    const std::string fileName = SaveToTemporaryFile(SerializeConstantAddNetwork(constantData));
+
+    armnn::IRuntimePtr runtime = armnn::IRuntime::Create(armnn::IRuntime::CreationOptions());
+    armnn::NetworkId networkId;
+    {
+        armnn::INetworkPtr network = IDeserializer::Create()->CreateNetworkFromFile(fileName.c_str());
+        BOOST_REQUIRE(network);
+
+        armnn::IOptimizedNetworkPtr optimized =
+            armnn::Optimize(*network, { armnn::Compute::CpuRef }, runtime->GetDeviceSpec());
+        BOOST_REQUIRE(runtime->LoadNetwork(networkId, std::move(optimized)) == armnn::Status::Success);
+    }
+
+    // The constants live in the mapped file, which stays readable once the parser, the network and the file are gone.
+    boost::filesystem::remove(fileName);
+
+    std::vector<float> inputData = { 10.0f, 20.0f, 30.0f, 40.0f };
+    std::vector<float> outputData(4);
+    armnn::InputTensors inputTensors
+    {
+        { 0, armnn::ConstTensor(runtime->GetInputTensorInfo(networkId, 0), inputData.data()) }
+    };
+    armnn::OutputTensors outputTensors
+    {
+        { 0, armnn::Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) }
+    };
+    BOOST_CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == armnn::Status::Success);
+
+    const std::vector<float> expectedOutputData = { 11.0f, 22.0f, 33.0f, 44.0f };
+    BOOST_CHECK_EQUAL_COLLECTIONS(outputData.begin(), outputData.end(),
+                                  expectedOutputData.begin(), expectedOutputData.end());
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeTruncatedFile)
+{
+    const std::string content = SerializeConstantAddNetwork({ 1.0f, 2.0f, 3.0f, 4.0f });
+    const std::string fileName = SaveToTemporaryFile(content.substr(0, content.size() / 2));
+
+    BOOST_CHECK_THROW(IDeserializer::Create()->CreateNetworkFromFile(fileName.c_str()), armnn::ParseException);
+    boost::filesystem::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeCorruptFile)
+{
+    const std::string fileName = SaveToTemporaryFile("invalid data");
+
+    BOOST_CHECK_THROW(IDeserializer::Create()->CreateNetworkFromFile(fileName.c_str()), armnn::ParseException);
+    boost::filesystem::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeEmptyFile)
+{
+    const std::string fileName = SaveToTemporaryFile("");
+
+    BOOST_CHECK_THROW(IDeserializer::Create()->CreateNetworkFromFile(fileName.c_str()), armnn::ParseException);
+    boost::filesystem::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeFileNotFound)
+{
+    BOOST_CHECK_THROW(IDeserializer::Create()->CreateNetworkFromFile("invalidfile.armnn"),
+                      armnn::FileNotFoundException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
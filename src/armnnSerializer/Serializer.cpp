@@ -24,6 +24,10 @@ namespace serializer = armnnSerializer;
 namespace armnnSerializer
 {
 
+// Alignment, from the start of the serialized buffer, of the data of the constant tensors. It lets them be
+// referenced in place from a memory mapped file.
+constexpr size_t ConstTensorDataAlignment = 16;
+
 serializer::ActivationFunction GetFlatBufferActivationFunction(armnn::ActivationFunction function)
 {
     switch (function)
@@ -398,7 +402,8 @@ void SerializerVisitor::VisitLstmLayer(const armnn::IConnectableLayer* layer, co
         descriptor.m_ClippingThresProj,
         descriptor.m_CifgEnabled,
         descriptor.m_PeepholeEnabled,
-        descriptor.m_ProjectionEnabled);
+        descriptor.m_ProjectionEnabled,
+        descriptor.m_StatefulSequence);
 
     // Get mandatory input parameters
     auto inputToForgetWeights = CreateConstTensorInfo(*params.m_InputToForgetWeights);
@@ -911,12 +916,20 @@ fb::Offset<serializer::LayerBase> SerializerVisitor::CreateLayerBase(const IConn
     std::vector<fb::Offset<serializer::InputSlot>> inputSlots = CreateInputSlots(layer);
     std::vector<fb::Offset<serializer::OutputSlot>> outputSlots = CreateOutputSlots(layer);
 
+    // The backends are only assigned in the networks exported from optimized networks.
+    fb::Offset<fb::String> fbBackendId;
+    if (layer->GetBackendId() != armnn::BackendId())
+    {
+        fbBackendId = m_flatBufferBuilder.CreateString(layer->GetBackendId().Get());
+    }
+
     return serializer::CreateLayerBase(m_flatBufferBuilder,
                                        fbIndex,
                                        m_flatBufferBuilder.CreateString(layer->GetName()),
                                        layerType,
                                        m_flatBufferBuilder.CreateVector(inputSlots),
-                                       m_flatBufferBuilder.CreateVector(outputSlots));
+                                       m_flatBufferBuilder.CreateVector(outputSlots),
+                                       fbBackendId);
 }
 
 void SerializerVisitor::CreateAnyLayer(const flatbuffers::Offset<void>& layer, const serializer::Layer serializerLayer)
@@ -930,6 +943,7 @@ flatbuffers::Offset<flatbuffers::Vector<T>> SerializerVisitor::CreateDataVector(
 {
     const T* buffer = reinterpret_cast<const T*>(memory);
     std::vector<T> vector(buffer, buffer + (size / sizeof(T)));
+    m_flatBufferBuilder.ForceVectorAlignment(vector.size(), sizeof(T), ConstTensorDataAlignment);
     auto fbVector = m_flatBufferBuilder.CreateVector(vector);
     return fbVector;
 }
@@ -2246,6 +2246,7 @@ protected:
         BOOST_TEST(m_Descriptor.m_CifgEnabled == descriptor.m_CifgEnabled);
         BOOST_TEST(m_Descriptor.m_PeepholeEnabled = descriptor.m_PeepholeEnabled);
         BOOST_TEST(m_Descriptor.m_ProjectionEnabled == descriptor.m_ProjectionEnabled);
+        BOOST_TEST(m_Descriptor.m_StatefulSequence == descriptor.m_StatefulSequence);
     }
     void VerifyInputParameters(const armnn::LstmInputParams& params)
     {
@@ -2592,4 +2593,61 @@ BOOST_AUTO_TEST_CASE(SerializeDeserializeLstmNoCifgWithPeepholeAndProjection)
     deserializedNetwork->Accept(checker);
 }
 
+BOOST_AUTO_TEST_CASE(SerializeDeserializeExportedOptimizedNetwork)
+{
+    const armnn::TensorInfo inputInfo({ 1, 4 }, armnn::DataType::Float32);
+    const armnn::TensorInfo outputInfo({ 1, 2 }, armnn::DataType::Float32);
+    const armnn::TensorInfo weightsInfo({ 4, 2 }, armnn::DataType::Float32);
+    const std::vector<float> weights = { 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f };
+
+    armnn::ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = armnn::ActivationFunction::ReLu;
+
+    armnn::INetworkPtr network = armnn::INetwork::Create();
+    armnn::IConnectableLayer* const inputLayer = network->AddInputLayer(0);
+    armnn::IConnectableLayer* const fullyConnectedLayer =
+        network->AddFullyConnectedLayer(armnn::FullyConnectedDescriptor(),
+                                        armnn::ConstTensor(weightsInfo, weights),
+                                        armnn::EmptyOptional());
+    armnn::IConnectableLayer* const reluLayer = network->AddActivationLayer(reluDescriptor);
+    armnn::IConnectableLayer* const outputLayer = network->AddOutputLayer(0);
+
+    inputLayer->GetOutputSlot(0).Connect(fullyConnectedLayer->GetInputSlot(0));
+    fullyConnectedLayer->GetOutputSlot(0).Connect(reluLayer->GetInputSlot(0));
+    reluLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+
+    inputLayer->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    fullyConnectedLayer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    reluLayer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime = armnn::IRuntime::Create(options);
+    armnn::IOptimizedNetworkPtr optimizedNetwork =
+        armnn::Optimize(*network, { armnn::Compute::CpuRef }, runtime->GetDeviceSpec());
+
+    armnn::INetworkPtr deserializedNetwork =
+        DeserializeNetwork(SerializeNetwork(*optimizedNetwork->ExportNetwork()));
+    BOOST_CHECK(deserializedNetwork);
+
+    // The backends are restored, so the network loads without being optimized.
+    std::string errorMessage;
+    armnn::NetworkId networkId;
+    BOOST_TEST(runtime->LoadNetwork(networkId, *deserializedNetwork, errorMessage) == armnn::Status::Success);
+
+    std::vector<float> inputData = { 1.0f, 2.0f, 3.0f, 4.0f };
+    std::vector<float> outputData(outputInfo.GetNumElements());
+    armnn::InputTensors inputTensors{
+        { 0, armnn::ConstTensor(runtime->GetInputTensorInfo(networkId, 0), inputData.data()) } };
+    armnn::OutputTensors outputTensors{
+        { 0, armnn::Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+    BOOST_TEST(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == armnn::Status::Success);
+
+    const std::vector<float> expectedOutput = { 10.0f, 0.0f };
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+
+    // A network serialized before being optimized has no backends.
+    armnn::INetworkPtr unoptimizedNetwork = DeserializeNetwork(SerializeNetwork(*network));
+    BOOST_TEST(runtime->LoadNetwork(networkId, *unoptimizedNetwork, errorMessage) == armnn::Status::Failure);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -24,6 +24,11 @@
 #include <boost/format.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <fstream>
 #include <algorithm>
 #include <limits>
@@ -177,7 +182,9 @@ void CheckBuffer(const TfLiteParser::ModelPtr & model,
                               bufferIndex %
                               location.FileLine()));
     }
-    else if (bufferIndex >= model->buffers.size())
+    else if (model->m_Flatbuffer == nullptr ||
+             model->m_Flatbuffer->buffers() == nullptr ||
+             bufferIndex >= model->m_Flatbuffer->buffers()->size())
     {
         throw ParseException(
             boost::str(
@@ -187,7 +194,7 @@ void CheckBuffer(const TfLiteParser::ModelPtr & model,
                               bufferIndex %
                               location.FileLine()));
     }
-    else if (model->buffers[bufferIndex].get() == nullptr)
+    else if (model->m_Flatbuffer->buffers()->Get(static_cast<flatbuffers::uoffset_t>(bufferIndex)) == nullptr)
     {
         throw ParseException(
             boost::str(
@@ -200,6 +207,17 @@ void CheckBuffer(const TfLiteParser::ModelPtr & model,
 #define CHECK_BUFFER(MODEL, BUFFER_INDEX) \
     CheckBuffer(MODEL, BUFFER_INDEX, CHECK_LOCATION())
 
+// The data of the buffers is read in place from the flatbuffer. Empty buffers may have no data at all.
+const uint8_t* GetBufferData(TfLiteParser::BufferRawPtr bufferPtr)
+{
+    return bufferPtr->data() != nullptr ? bufferPtr->data()->data() : nullptr;
+}
+
+size_t GetBufferSize(TfLiteParser::BufferRawPtr bufferPtr)
+{
+    return bufferPtr->data() != nullptr ? bufferPtr->data()->size() : 0;
+}
+
 void CheckBufferSize(TfLiteParser::BufferRawPtr bufferPtr,
                      const armnn::TensorInfo & tensorInfo,
                      uint32_t bufferId,
@@ -213,11 +231,11 @@ void CheckBufferSize(TfLiteParser::BufferRawPtr bufferPtr,
                               bufferId %
                               location.AsString()));
     }
-    else if(tensorInfo.GetNumElements() > bufferPtr->data.size() ||
-            tensorInfo.GetNumBytes() > bufferPtr->data.size())
+    else if(tensorInfo.GetNumElements() > GetBufferSize(bufferPtr) ||
+            tensorInfo.GetNumBytes() > GetBufferSize(bufferPtr))
     {
         std::stringstream ss;
-        ss << "Buffer #" << bufferId << " has " << bufferPtr->data.size() << " bytes. "
+        ss << "Buffer #" << bufferId << " has " << GetBufferSize(bufferPtr) << " bytes. "
            << "For tensor: " << tensorInfo.GetShape()
            << " expecting: " << tensorInfo.GetNumBytes() << " bytes and "
            << tensorInfo.GetNumElements() << " elements. " << location.AsString();
@@ -392,20 +410,17 @@ CreateConstTensorImpl(TfLiteParser::BufferRawPtr bufferPtr,
         boost::str(
             boost::format("Buffer for buffer:%1% is null") % tensorPtr->buffer).c_str());
 
-    std::unique_ptr<T[]> data(new T[tensorInfo.GetNumElements()]);
-
+    // The tensor references the flatbuffer, unless its data has to be permuted into a new buffer.
     if (permutationVector.has_value() && permutationVector.value().GetSize() > 0)
     {
+        std::unique_ptr<T[]> data(new T[tensorInfo.GetNumElements()]);
         tensorInfo = armnnUtils::Permuted(tensorInfo, permutationVector.value());
         armnnUtils::Permute(tensorInfo.GetShape(), permutationVector.value(),
-                            reinterpret_cast<const T*>(bufferPtr->data.data()), data.get(), sizeof(T));
-    }
-    else
-    {
-        ::memcpy(data.get(), bufferPtr->data.data(), tensorInfo.GetNumBytes());
+                            reinterpret_cast<const T*>(GetBufferData(bufferPtr)), data.get(), sizeof(T));
+        return std::make_pair(ConstTensor(tensorInfo, data.get()), std::move(data));
     }
 
-    return std::make_pair(ConstTensor(tensorInfo, data.get()), std::move(data));
+    return std::make_pair(ConstTensor(tensorInfo, GetBufferData(bufferPtr)), std::unique_ptr<T[]>());
 }
 
 armnn::LayerBindingId GenerateLayerBindingId(size_t subgraphIndex, size_t tensorIndex)
@@ -553,6 +568,12 @@ INetworkPtr TfLiteParser::CreateNetworkFromModel()
     m_Network = INetwork::Create();
     BOOST_ASSERT(m_Model.get() != nullptr);
 
+    // The constant tensors are referenced rather than copied if the network can keep the model content alive.
+    if (m_Model->m_Content)
+    {
+        m_Network->AddConstantMemory(m_Model->m_Content, m_Model->m_FlatbufferSize);
+    }
+
     bool failedToCreate = false;
     std::stringstream errors;
 
@@ -890,10 +911,10 @@ void TfLiteParser::ParseBatchToSpaceND(size_t subgraphIndex, size_t operatorInde
     BufferRawPtr cropsBufferPtr = GetBuffer(m_Model, inputs[2]->buffer);
 
     std::vector<unsigned int> blockShape(blockShapeTensorInfo.GetNumElements());
-    ::memcpy(blockShape.data(), blockShapeBufferPtr->data.data(), blockShapeTensorInfo.GetNumBytes());
+    ::memcpy(blockShape.data(), GetBufferData(blockShapeBufferPtr), blockShapeTensorInfo.GetNumBytes());
 
     std::vector<unsigned int> cropsVector(cropsTensorInfo.GetNumElements());
-    ::memcpy(cropsVector.data(), cropsBufferPtr->data.data(), cropsTensorInfo.GetNumBytes());
+    ::memcpy(cropsVector.data(), GetBufferData(cropsBufferPtr), cropsTensorInfo.GetNumBytes());
 
     size_t step = 2;
     std::vector<std::pair<unsigned int, unsigned int>> crops;
@@ -1109,10 +1130,10 @@ void TfLiteParser::ParseSpaceToBatchND(size_t subgraphIndex, size_t operatorInde
     BufferRawPtr padListBufferPtr = GetBuffer(m_Model, inputs[2]->buffer);
 
     std::vector<unsigned int> blockShape(blockShapeTensorInfo.GetNumElements());
-    ::memcpy(blockShape.data(), blockShapeBufferPtr->data.data(), blockShapeTensorInfo.GetNumBytes());
+    ::memcpy(blockShape.data(), GetBufferData(blockShapeBufferPtr), blockShapeTensorInfo.GetNumBytes());
 
     std::vector<unsigned int> padListVector(padListTensorInfo.GetNumElements());
-    ::memcpy(padListVector.data(), padListBufferPtr->data.data(), padListTensorInfo.GetNumBytes());
+    ::memcpy(padListVector.data(), GetBufferData(padListBufferPtr), padListTensorInfo.GetNumBytes());
 
     size_t step = 2;
     std::vector<std::pair<unsigned int, unsigned int>> padList;
@@ -1249,19 +1270,19 @@ void TfLiteParser::ParseStridedSlice(size_t subgraphIndex, size_t operatorIndex)
     BufferRawPtr beginBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
 
     std::vector<int> begin(beginTensorInfo.GetNumElements());
-    ::memcpy(begin.data(), beginBufferPtr->data.data(), beginTensorInfo.GetNumBytes());
+    ::memcpy(begin.data(), GetBufferData(beginBufferPtr), beginTensorInfo.GetNumBytes());
 
     armnn::TensorInfo endTensorInfo = ToTensorInfo(inputs[2]);
     BufferRawPtr endBufferPtr = GetBuffer(m_Model, inputs[2]->buffer);
 
     std::vector<int> end(endTensorInfo.GetNumElements());
-    ::memcpy(end.data(), endBufferPtr->data.data(), endTensorInfo.GetNumBytes());
+    ::memcpy(end.data(), GetBufferData(endBufferPtr), endTensorInfo.GetNumBytes());
 
     armnn::TensorInfo strideTensorInfo = ToTensorInfo(inputs[3]);
     BufferRawPtr strideBufferPtr = GetBuffer(m_Model, inputs[3]->buffer);
 
     std::vector<int> stride(strideTensorInfo.GetNumElements());
-    ::memcpy(stride.data(), strideBufferPtr->data.data(), strideTensorInfo.GetNumBytes());
+    ::memcpy(stride.data(), GetBufferData(strideBufferPtr), strideTensorInfo.GetNumBytes());
 
     desc.m_Begin = begin;
     desc.m_End = end;
@@ -1408,7 +1429,7 @@ void TfLiteParser::ParseMean(size_t subgraphIndex, size_t operatorIndex)
 
     armnn::MeanDescriptor desc;
     std::vector<unsigned int> axis(dimTensorInfo.GetNumElements());
-    ::memcpy(axis.data(), bufferPtr->data.data(), dimTensorInfo.GetNumBytes());
+    ::memcpy(axis.data(), GetBufferData(bufferPtr), dimTensorInfo.GetNumBytes());
     desc.m_Axis = axis;
 
     armnn::TensorInfo inputTensorInfo  = ToTensorInfo(inputs[0]);
@@ -1443,7 +1464,7 @@ void TfLiteParser::ParsePad(size_t subgraphIndex, size_t operatorIndex)
     BufferRawPtr bufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
 
     std::vector<unsigned int> padBuffer(padTensorInfo.GetNumElements());
-    ::memcpy(padBuffer.data(), bufferPtr->data.data(), padTensorInfo.GetNumBytes());
+    ::memcpy(padBuffer.data(), GetBufferData(bufferPtr), padTensorInfo.GetNumBytes());
 
     size_t step = 2;
     armnn::PadDescriptor desc;
@@ -1643,7 +1664,7 @@ void TfLiteParser::ParseResizeBilinear(size_t subgraphIndex, size_t operatorInde
     std::vector<int32_t> sizeTensorData(sizeTensorInfo.GetNumElements());
 
     BufferRawPtr sizeBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
-    ::memcpy(sizeTensorData.data(), sizeBufferPtr->data.data(), sizeTensorInfo.GetNumBytes());
+    ::memcpy(sizeTensorData.data(), GetBufferData(sizeBufferPtr), sizeTensorInfo.GetNumBytes());
 
     ResizeBilinearDescriptor desc;
     desc.m_TargetHeight = static_cast<uint32_t> (sizeTensorData[0]);
@@ -2033,10 +2054,42 @@ TfLiteParser::ModelPtr TfLiteParser::LoadModelFromFile(const char * fileName)
                                     errorCode %
                                     CHECK_LOCATION().AsString()));
     }
-    std::ifstream file(fileName, std::ios::binary);
-    std::string fileContent((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-    return LoadModelFromBinary(reinterpret_cast<const uint8_t *>(fileContent.c_str()),
-                               fileContent.size());
+
+    const int fileDescriptor = open(fileName, O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        throw FileNotFoundException(boost::str(boost::format("Cannot open the file (%1%) %2%") %
+                                    fileName %
+                                    CHECK_LOCATION().AsString()));
+    }
+
+    struct stat fileStat;
+    if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close(fileDescriptor);
+        throw ParseException(boost::str(boost::format("Cannot read the file (%1%) %2%") %
+                             fileName %
+                             CHECK_LOCATION().AsString()));
+    }
+    const size_t fileSize = static_cast<size_t>(fileStat.st_size);
+
+    // The file is mapped rather than read, so that its pages are only loaded when used, and shared with the network.
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (mapping == MAP_FAILED)
+    {
+        throw ParseException(boost::str(boost::format("Cannot map the file (%1%) %2%") %
+                             fileName %
+                             CHECK_LOCATION().AsString()));
+    }
+    std::shared_ptr<const void> content(mapping, [fileSize](const void* memory)
+    {
+        munmap(const_cast<void*>(memory), fileSize);
+    });
+
+    ModelPtr model = LoadModelFromBinary(static_cast<const uint8_t*>(content.get()), fileSize);
+    model->m_Content = std::move(content);
+    return model;
 }
 
 TfLiteParser::ModelPtr TfLiteParser::LoadModelFromBinary(const uint8_t * binaryContent, size_t len)
@@ -2055,7 +2108,32 @@ TfLiteParser::ModelPtr TfLiteParser::LoadModelFromBinary(const uint8_t * binaryC
                        len %
                        CHECK_LOCATION().AsString()));
     }
-    return tflite::UnPackModel(binaryContent);
+
+    // Only the graph structure is unpacked: the buffers, which hold the weights, are left in the flatbuffer.
+    const tflite::Model* flatbuffer = tflite::GetModel(binaryContent);
+    ModelPtr model = std::make_unique<UnpackedModel>();
+    model->version = flatbuffer->version();
+    if (flatbuffer->operator_codes() != nullptr)
+    {
+        for (const tflite::OperatorCode* operatorCode : *flatbuffer->operator_codes())
+        {
+            model->operator_codes.emplace_back(operatorCode->UnPack());
+        }
+    }
+    if (flatbuffer->subgraphs() != nullptr)
+    {
+        for (const tflite::SubGraph* subgraph : *flatbuffer->subgraphs())
+        {
+            model->subgraphs.emplace_back(subgraph->UnPack());
+        }
+    }
+    if (flatbuffer->description() != nullptr)
+    {
+        model->description = flatbuffer->description()->str();
+    }
+    model->m_Flatbuffer = flatbuffer;
+    model->m_FlatbufferSize = len;
+    return model;
 }
 
 TfLiteParser::TensorRawPtrVector TfLiteParser::GetInputs(const ModelPtr & model,
@@ -2280,7 +2358,7 @@ void TfLiteParser::SetupConstantLayers(size_t subgraphIndex)
 TfLiteParser::BufferRawPtr TfLiteParser::GetBuffer(const ModelPtr& model, size_t bufferIndex)
 {
     CHECK_BUFFER(model, bufferIndex);
-    return model->buffers[bufferIndex].get();
+    return model->m_Flatbuffer->buffers()->Get(static_cast<flatbuffers::uoffset_t>(bufferIndex));
 }
 
 template<typename T>
@@ -10,6 +10,7 @@
 
 #include <schema_generated.h>
 #include <functional>
+#include <memory>
 #include <vector>
 
 namespace armnnTfLiteParser
@@ -18,8 +19,17 @@ namespace armnnTfLiteParser
 class TfLiteParser : public ITfLiteParser
 {
 public:
+    /// The graph structure of a model, unpacked from its flatbuffer. The data of the buffers is not unpacked: it is
+    /// read in place from the flatbuffer, which must outlive the model unless the model owns it.
+    struct UnpackedModel : public tflite::ModelT
+    {
+        const tflite::Model*        m_Flatbuffer = nullptr;
+        size_t                      m_FlatbufferSize = 0;
+        std::shared_ptr<const void> m_Content;
+    };
+
     // Shorthands for TfLite types
-    using ModelPtr = std::unique_ptr<tflite::ModelT>;
+    using ModelPtr = std::unique_ptr<UnpackedModel>;
     using SubGraphPtr = std::unique_ptr<tflite::SubGraphT>;
     using OperatorPtr = std::unique_ptr<tflite::OperatorT>;
     using OperatorCodePtr = std::unique_ptr<tflite::OperatorCodeT>;
@@ -28,8 +38,7 @@ public:
     using TensorRawPtrVector = std::vector<TensorRawPtr>;
     using TensorIdRawPtr = std::pair<size_t, TensorRawPtr>;
     using TensorIdRawPtrVector = std::vector<TensorIdRawPtr>;
-    using BufferPtr = std::unique_ptr<tflite::BufferT>;
-    using BufferRawPtr = const tflite::BufferT *;
+    using BufferRawPtr = const tflite::Buffer *;
 
 public:
     /// Create the network from a flatbuffers binary file on disk
@@ -63,7 +72,9 @@ public:
 
 public:
     // testable helpers
+    /// Maps the file into memory. The model owns the mapping.
     static ModelPtr LoadModelFromFile(const char * fileName);
+    /// The binary content must outlive the model.
     static ModelPtr LoadModelFromBinary(const uint8_t * binaryContent, size_t len);
     static TensorRawPtrVector GetInputs(const ModelPtr & model, size_t subgraphIndex, size_t operatorIndex);
     static TensorRawPtrVector GetOutputs(const ModelPtr & model, size_t subgraphIndex, size_t operatorIndex);
@@ -93,9 +93,14 @@ struct GetBufferFixture : public ParserFlatbuffersFixture
     {
         for(long unsigned int i=0; i<bufferValues.size(); i++)
         {
-            BOOST_CHECK_EQUAL(TfLiteParser::GetBuffer(model, bufferIndex)->data[i], bufferValues[i]);
+            BOOST_CHECK_EQUAL(TfLiteParser::GetBuffer(model, bufferIndex)->data()->Get(i), bufferValues[i]);
         }
     }
+
+    static bool IsEmpty(TfLiteParser::BufferRawPtr bufferPtr)
+    {
+        return bufferPtr->data() == nullptr || bufferPtr->data()->size() == 0;
+    }
 };
 
 BOOST_FIXTURE_TEST_CASE(GetBufferCheckContents, GetBufferFixture)
@@ -110,17 +115,17 @@ BOOST_FIXTURE_TEST_CASE(GetBufferCheckEmpty, GetBufferFixture)
 {
     //Check if test fixture buffers are empty or not
     TfLiteParser::ModelPtr model = TfLiteParser::LoadModelFromBinary(m_GraphBinary.data(), m_GraphBinary.size());
-    BOOST_CHECK(TfLiteParser::GetBuffer(model, 0)->data.empty());
-    BOOST_CHECK(TfLiteParser::GetBuffer(model, 1)->data.empty());
-    BOOST_CHECK(!TfLiteParser::GetBuffer(model, 2)->data.empty());
-    BOOST_CHECK(TfLiteParser::GetBuffer(model, 3)->data.empty());
+    BOOST_CHECK(IsEmpty(TfLiteParser::GetBuffer(model, 0)));
+    BOOST_CHECK(IsEmpty(TfLiteParser::GetBuffer(model, 1)));
+    BOOST_CHECK(!IsEmpty(TfLiteParser::GetBuffer(model, 2)));
+    BOOST_CHECK(IsEmpty(TfLiteParser::GetBuffer(model, 3)));
 }
 
 BOOST_FIXTURE_TEST_CASE(GetBufferCheckParseException, GetBufferFixture)
 {
     //Check if armnn::ParseException thrown when invalid buffer index used
     TfLiteParser::ModelPtr model = TfLiteParser::LoadModelFromBinary(m_GraphBinary.data(), m_GraphBinary.size());
-    BOOST_CHECK_THROW(TfLiteParser::GetBuffer(model, 4)->data.empty(), armnn::Exception);
+    BOOST_CHECK_THROW(TfLiteParser::GetBuffer(model, 4), armnn::Exception);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -143,7 +143,7 @@ struct LoadModelFixture : public ParserFlatbuffersFixture
         CheckBuiltinOperators(opcodes, model->operator_codes);
         BOOST_CHECK_EQUAL(subgraphs, model->subgraphs.size());
         BOOST_CHECK_EQUAL(desc, model->description);
-        BOOST_CHECK_EQUAL(buffers, model->buffers.size());
+        BOOST_CHECK_EQUAL(buffers, model->m_Flatbuffer->buffers()->size());
     }
 
     void CheckBuiltinOperators(const std::vector<tflite::BuiltinOperator>& expectedOperators,
@@ -215,6 +215,10 @@ BOOST_FIXTURE_TEST_CASE(LoadModelFromFile, LoadModelFixture)
     CheckOperator(model->subgraphs[1]->operators[0], 1, { 0, 2 }, { 1 }, tflite::BuiltinOptions_Conv2DOptions,
                   tflite::CustomOptionsFormat_FLEXBUFFERS);
     remove(fname);
+
+    // The model owns the mapped file, which stays readable once the file is removed.
+    BOOST_CHECK(model->m_Content);
+    BOOST_CHECK_EQUAL(2, model->m_Flatbuffer->buffers()->size());
 }
 
 BOOST_AUTO_TEST_CASE(LoadNullBinary)
@@ -6,6 +6,7 @@
 
 #include <backendsCommon/CpuTensorHandle.hpp>
 
+#include <cstdint>
 #include <cstring>
 
 namespace armnn
@@ -20,7 +21,7 @@ ConstCpuTensorHandle::ConstCpuTensorHandle(const TensorInfo& tensorInfo)
 template <>
 const void* ConstCpuTensorHandle::GetConstTensor<void>() const
 {
-    return m_Memory;
+    return GetConstMemory();
 }
 
 CpuTensorHandle::CpuTensorHandle(const TensorInfo& tensorInfo)
@@ -32,11 +33,13 @@ CpuTensorHandle::CpuTensorHandle(const TensorInfo& tensorInfo)
 template <>
 void* CpuTensorHandle::GetTensor<void>() const
 {
-    return m_MutableMemory;
+    return GetMemory();
 }
 
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const TensorInfo& tensorInfo)
 : CpuTensorHandle(tensorInfo)
+, m_OwnsMemory(false)
+, m_DerivedData(std::make_shared<DerivedData>())
 {
 }
 
@@ -49,33 +52,50 @@ ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstTensor& tensor)
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorHandle)
 : ScopedCpuTensorHandle(tensorHandle.GetTensorInfo())
 {
-    CopyFrom(tensorHandle.GetConstTensor<void>(), tensorHandle.GetTensorInfo().GetNumBytes());
+    auto scopedTensorHandle = dynamic_cast<const ScopedCpuTensorHandle*>(&tensorHandle);
+    if (scopedTensorHandle)
+    {
+        ShareFrom(*scopedTensorHandle);
+    }
+    else
+    {
+        CopyFrom(tensorHandle.GetConstTensor<void>(), tensorHandle.GetTensorInfo().GetNumBytes());
+    }
+}
+
+ScopedCpuTensorHandle::ScopedCpuTensorHandle(const TensorInfo& tensorInfo, std::shared_ptr<void> memory)
+: CpuTensorHandle(tensorInfo)
+, m_Memory(std::move(memory))
+, m_OwnsMemory(false)
+, m_DerivedData(std::make_shared<DerivedData>())
+{
+    SetMemory(m_Memory.get());
 }
 
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other)
 : CpuTensorHandle(other.GetTensorInfo())
 {
-    CopyFrom(other);
+    ShareFrom(other);
 }
 
 ScopedCpuTensorHandle& ScopedCpuTensorHandle::operator=(const ScopedCpuTensorHandle& other)
 {
-    ::operator delete(GetTensor<void>());
-    SetMemory(nullptr);
-    CopyFrom(other);
+    ShareFrom(other);
     return *this;
 }
 
 ScopedCpuTensorHandle::~ScopedCpuTensorHandle()
 {
-    ::operator delete(GetTensor<void>());
 }
 
 void ScopedCpuTensorHandle::Allocate()
 {
     if (GetTensor<void>() == nullptr)
     {
-        SetMemory(::operator new(GetTensorInfo().GetNumBytes()));
+        m_Memory = std::shared_ptr<void>(::operator new(GetTensorInfo().GetNumBytes()),
+                                         [](void* memory) { ::operator delete(memory); });
+        m_OwnsMemory = true;
+        SetMemory(m_Memory.get());
     }
     else
     {
@@ -91,12 +111,26 @@ void ScopedCpuTensorHandle::CopyOutTo(void* memory) const
 
 void ScopedCpuTensorHandle::CopyInFrom(const void* memory)
 {
+    // The copies of the handle and the owner of external memory, which may be read-only, keep their contents.
+    if (IsShared() || !m_OwnsMemory)
+    {
+        m_Memory.reset();
+        SetMemory(nullptr);
+        Allocate();
+    }
+    m_DerivedData = std::make_shared<DerivedData>();
+
     memcpy(GetTensor<void>(), memory, GetTensorInfo().GetNumBytes());
 }
 
-void ScopedCpuTensorHandle::CopyFrom(const ScopedCpuTensorHandle& other)
+void ScopedCpuTensorHandle::ShareFrom(const ScopedCpuTensorHandle& other)
 {
-    CopyFrom(other.GetTensor<void>(), other.GetTensorInfo().GetNumBytes());
+    BOOST_ASSERT(GetTensorInfo().GetNumBytes() == other.GetTensorInfo().GetNumBytes());
+
+    m_Memory = other.m_Memory;
+    m_OwnsMemory = other.m_OwnsMemory;
+    m_DerivedData = other.m_DerivedData;
+    SetMemory(m_Memory.get());
 }
 
 void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numBytes)
@@ -111,6 +145,81 @@ void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numByte
     }
 }
 
+CpuSubTensorHandle::CpuSubTensorHandle(CpuTensorHandle& parent,
+                                       const TensorShape& subTensorShape,
+                                       const unsigned int* subTensorOrigin)
+: CpuTensorHandle(TensorInfo(subTensorShape,
+                             parent.GetTensorInfo().GetDataType(),
+                             parent.GetTensorInfo().GetQuantizationScale(),
+                             parent.GetTensorInfo().GetQuantizationOffset()))
+, m_Parent(&parent)
+, m_Offset(0)
+{
+    const TensorShape& parentShape = parent.GetTensorInfo().GetShape();
+    if (!IsContiguous(parentShape, subTensorShape, subTensorOrigin))
+    {
+        throw InvalidArgumentException("CpuSubTensorHandle: the region of the parent tensor is not contiguous");
+    }
+
+    unsigned int stride = GetDataTypeSize(parent.GetTensorInfo().GetDataType());
+    for (unsigned int i = parentShape.GetNumDimensions(); i-- > 0;)
+    {
+        m_Offset += subTensorOrigin[i] * stride;
+        stride *= parentShape[i];
+    }
+}
+
+CpuSubTensorHandle::CpuSubTensorHandle(CpuTensorHandle& parent, const TensorInfo& tensorInfo)
+: CpuTensorHandle(tensorInfo)
+, m_Parent(&parent)
+, m_Offset(0)
+{
+    if (tensorInfo.GetNumBytes() != parent.GetTensorInfo().GetNumBytes())
+    {
+        throw InvalidArgumentException("CpuSubTensorHandle: an alias must have the size of its parent tensor");
+    }
+}
+
+bool CpuSubTensorHandle::IsContiguous(const TensorShape& parentShape,
+                                      const TensorShape& subTensorShape,
+                                      const unsigned int* subTensorOrigin)
+{
+    const unsigned int numDimensions = parentShape.GetNumDimensions();
+    if (subTensorShape.GetNumDimensions() != numDimensions)
+    {
+        return false;
+    }
+
+    // Once the region spans more than one element along a dimension, it must span the whole of the inner ones.
+    bool isOutermost = true;
+    for (unsigned int i = 0; i < numDimensions; ++i)
+    {
+        if (subTensorOrigin[i] + subTensorShape[i] > parentShape[i] ||
+            (!isOutermost && subTensorShape[i] != parentShape[i]))
+        {
+            return false;
+        }
+        isOutermost = isOutermost && subTensorShape[i] == 1;
+    }
+    return true;
+}
+
+void* CpuSubTensorHandle::GetMemory() const
+{
+    uint8_t* parentMemory = static_cast<uint8_t*>(m_Parent->GetTensor<void>());
+    return parentMemory ? parentMemory + m_Offset : nullptr;
+}
+
+void CpuSubTensorHandle::CopyOutTo(void* memory) const
+{
+    memcpy(memory, GetTensor<void>(), GetTensorInfo().GetNumBytes());
+}
+
+void CpuSubTensorHandle::CopyInFrom(const void* memory)
+{
+    memcpy(GetTensor<void>(), memory, GetTensorInfo().GetNumBytes());
+}
+
 void PassthroughCpuTensorHandle::Allocate()
 {
     throw InvalidArgumentException("PassthroughCpuTensorHandle::Allocate() should never be called");
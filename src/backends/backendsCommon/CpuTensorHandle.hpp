@@ -12,6 +12,12 @@
 #include <backendsCommon/OutputHandler.hpp>
 
 #include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
 
 namespace armnn
 {
@@ -24,7 +30,7 @@ public:
     const T* GetConstTensor() const
     {
         BOOST_ASSERT(CompatibleTypes<T>(GetTensorInfo().GetDataType()));
-        return reinterpret_cast<const T*>(m_Memory);
+        return reinterpret_cast<const T*>(GetConstMemory());
     }
 
     const TensorInfo& GetTensorInfo() const
@@ -36,7 +42,7 @@ public:
 
     virtual ITensorHandle* GetParent() const override { return nullptr; }
 
-    virtual const void* Map(bool /* blocking = true */) const override { return m_Memory; }
+    virtual const void* Map(bool /* blocking = true */) const override { return GetConstMemory(); }
     virtual void Unmap() const override {}
 
     TensorShape GetStrides() const override
@@ -61,6 +67,9 @@ protected:
 
     void SetConstMemory(const void* mem) { m_Memory = mem; }
 
+    // Views into the memory of other tensors look it up each time it is accessed.
+    virtual const void* GetConstMemory() const { return m_Memory; }
+
 private:
     // Only used for testing
     void CopyOutTo(void *) const override {}
@@ -84,7 +93,7 @@ public:
     T* GetTensor() const
     {
         BOOST_ASSERT(CompatibleTypes<T>(GetTensorInfo().GetDataType()));
-        return reinterpret_cast<T*>(m_MutableMemory);
+        return reinterpret_cast<T*>(GetMemory());
     }
 
 protected:
@@ -96,6 +105,8 @@ protected:
         SetConstMemory(m_MutableMemory);
     }
 
+    virtual void* GetMemory() const { return m_MutableMemory; }
+
 private:
 
     CpuTensorHandle(const CpuTensorHandle& other) = delete;
@@ -107,6 +118,11 @@ template <>
 void* CpuTensorHandle::GetTensor<void>() const;
 
 // A CpuTensorHandle that owns the wrapped memory region.
+//
+// Copies of a ScopedCpuTensorHandle share its memory region, which is reference counted and freed with the last of
+// them. This lets the constant tensors of a layer (weights, biases...) go from the network to the optimized graph and
+// to the workloads without being duplicated. Once copied, the memory must be treated as read-only: CopyInFrom() first
+// moves the handle to memory of its own, as it does for memory owned elsewhere.
 class ScopedCpuTensorHandle : public CpuTensorHandle
 {
 public:
@@ -115,24 +131,71 @@ public:
     // Copies contents from Tensor.
     explicit ScopedCpuTensorHandle(const ConstTensor& tensor);
 
-    // Copies contents from ConstCpuTensorHandle
+    // Shares the memory of a ScopedCpuTensorHandle, or copies contents from any other ConstCpuTensorHandle.
     explicit ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorHandle);
 
+    // References memory owned elsewhere, which is kept alive by the given pointer and must not be modified.
+    ScopedCpuTensorHandle(const TensorInfo& tensorInfo, std::shared_ptr<void> memory);
+
+    // Shares the memory of the other ScopedCpuTensorHandle.
     ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other);
     ScopedCpuTensorHandle& operator=(const ScopedCpuTensorHandle& other);
     ~ScopedCpuTensorHandle();
 
     virtual void Allocate() override;
 
+    // Returns whether the memory is shared with other ScopedCpuTensorHandles.
+    bool IsShared() const { return m_Memory.use_count() > 1; }
+
+    // Returns data derived from the contents of the tensor, such as weights rearranged for a kernel, calling derive()
+    // to compute it the first time it is asked for with the given key. The handles sharing the memory share the
+    // derived data too, so that the workloads created from copies of a layer compute it once.
+    template <typename T>
+    std::shared_ptr<const T> GetDerivedData(const std::string& key, const std::function<T()>& derive) const
+    {
+        std::lock_guard<std::mutex> lock(m_DerivedData->m_Mutex);
+        std::shared_ptr<const void>& data = m_DerivedData->m_Data[std::make_pair(std::type_index(typeid(T)), key)];
+        if (!data)
+        {
+            data = std::make_shared<const T>(derive());
+        }
+        return std::static_pointer_cast<const T>(data);
+    }
+
 private:
     // Only used for testing
     void CopyOutTo(void* memory) const override;
     void CopyInFrom(const void* memory) override;
 
-    void CopyFrom(const ScopedCpuTensorHandle& other);
+    void ShareFrom(const ScopedCpuTensorHandle& other);
     void CopyFrom(const void* srcMemory, unsigned int numBytes);
+
+    struct DerivedData
+    {
+        std::mutex m_Mutex;
+        std::map<std::pair<std::type_index, std::string>, std::shared_ptr<const void>> m_Data;
+    };
+
+    std::shared_ptr<void> m_Memory;
+    bool m_OwnsMemory;
+    std::shared_ptr<DerivedData> m_DerivedData;
 };
 
+// Returns data derived from the contents of a constant tensor, computed once for all the copies of a
+// ScopedCpuTensorHandle (see ScopedCpuTensorHandle::GetDerivedData()), and each time for other tensor handles.
+template <typename T>
+std::shared_ptr<const T> GetDerivedData(const ConstCpuTensorHandle& tensorHandle,
+                                        const std::string& key,
+                                        const std::function<T()>& derive)
+{
+    auto scopedTensorHandle = dynamic_cast<const ScopedCpuTensorHandle*>(&tensorHandle);
+    if (scopedTensorHandle)
+    {
+        return scopedTensorHandle->GetDerivedData<T>(key, derive);
+    }
+    return std::make_shared<const T>(derive());
+}
+
 // A CpuTensorHandle that wraps an already allocated memory region.
 //
 // Clients must make sure the passed in memory region stays alive for the lifetime of
@@ -151,6 +214,43 @@ public:
     virtual void Allocate() override;
 };
 
+// A CpuTensorHandle viewing a contiguous region of the memory of another CpuTensorHandle, its parent, or the whole of
+// it under another shape.
+//
+// Writing to the view writes to the parent, which owns the memory and must outlive the view. The memory is looked up
+// through the parent each time it is accessed, so the view follows the parent when it is allocated or imports memory.
+class CpuSubTensorHandle : public CpuTensorHandle
+{
+public:
+    // The region must be contiguous, see IsContiguous().
+    CpuSubTensorHandle(CpuTensorHandle& parent, const TensorShape& subTensorShape, const unsigned int* subTensorOrigin);
+
+    // Aliases the parent, which must have the same size in bytes.
+    CpuSubTensorHandle(CpuTensorHandle& parent, const TensorInfo& tensorInfo);
+
+    // Returns whether the elements of the region of the given shape and origin follow each other in memory.
+    static bool IsContiguous(const TensorShape& parentShape,
+                             const TensorShape& subTensorShape,
+                             const unsigned int* subTensorOrigin);
+
+    virtual ITensorHandle* GetParent() const override { return m_Parent; }
+
+    // The memory belongs to the parent.
+    virtual void Allocate() override {}
+
+protected:
+    const void* GetConstMemory() const override { return GetMemory(); }
+    void* GetMemory() const override;
+
+private:
+    // Only used for testing
+    void CopyOutTo(void* memory) const override;
+    void CopyInFrom(const void* memory) override;
+
+    CpuTensorHandle* m_Parent;
+    unsigned int m_Offset; // In bytes.
+};
+
 // A ConstCpuTensorHandle that wraps an already allocated memory region.
 //
 // This allows users to pass in const memory to a network.
@@ -10,6 +10,7 @@ namespace armnn
 class ConstCpuTensorHandle;
 class CpuTensorHandle;
 class ScopedCpuTensorHandle;
+class CpuSubTensorHandle;
 class PassthroughCpuTensorHandle;
 class ConstPassthroughCpuTensorHandle;
 
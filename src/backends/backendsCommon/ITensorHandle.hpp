@@ -58,6 +58,20 @@ public:
     /// \return a TensorShape filled with the number of elements for each dimension.
     virtual TensorShape GetShape() const = 0;
 
+    /// Check whether the tensor can use the given caller-owned memory in place of its own (see Import()).
+    virtual bool CanBeImported(void* memory) const
+    {
+        return memory == nullptr;
+    }
+
+    /// Make the tensor read and write the given caller-owned memory in place of its own, until Import() is
+    /// called again. Passing nullptr makes the tensor use its own memory again.
+    /// \return false if the memory cannot be used, in which case the tensor is left unchanged.
+    virtual bool Import(void* memory)
+    {
+        return memory == nullptr;
+    }
+
     // Testing support to be able to verify and set tensor data content
     virtual void CopyOutTo(void* memory) const = 0;
     virtual void CopyInFrom(const void* memory) = 0;
@@ -0,0 +1,265 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "ThreadPool.hpp"
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace armnn
+{
+
+namespace
+{
+
+std::mutex& GetDefaultMutex()
+{
+    static std::mutex defaultMutex;
+    return defaultMutex;
+}
+
+std::shared_ptr<ThreadPool>& GetDefaultThreadPool()
+{
+    static std::shared_ptr<ThreadPool> defaultThreadPool;
+    return defaultThreadPool;
+}
+
+void SetAffinity(std::thread& thread, unsigned int cpu)
+{
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+    if (pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet) != 0)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "ThreadPool: could not pin a worker thread to processor " << cpu;
+    }
+#else
+    boost::ignore_unused(thread, cpu);
+#endif
+}
+
+} // anonymous namespace
+
+ThreadPool::ThreadPool(unsigned int numThreads, const std::vector<unsigned int>& cpuAffinity)
+    : m_NumWaiting(0)
+    , m_Stopping(false)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    // The thread running a loop always takes part in it, so one fewer worker is needed.
+    m_Workers.reserve(numThreads - 1);
+    for (unsigned int i = 0; i + 1 < numThreads; ++i)
+    {
+        m_Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+        if (!cpuAffinity.empty())
+        {
+            SetAffinity(m_Workers.back(), cpuAffinity[i % cpuAffinity.size()]);
+        }
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_TaskAvailable.notify_all();
+
+    for (auto& worker : m_Workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::WorkerLoop()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_TaskAvailable.wait(lock, [this]() { return m_Stopping || !m_Tasks.empty(); });
+            if (m_Tasks.empty())
+            {
+                return;
+            }
+            task = std::move(m_Tasks.front());
+            m_Tasks.pop_front();
+        }
+        RunTask(task);
+    }
+}
+
+void ThreadPool::RunTask(std::function<void()>& task)
+{
+    task();
+    task = nullptr;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_NumWaiting != 0)
+    {
+        m_TaskAvailable.notify_all();
+    }
+}
+
+void ThreadPool::Submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Tasks.push_back(std::move(task));
+    }
+    m_TaskAvailable.notify_all();
+}
+
+void ThreadPool::RunTasksUntil(const std::function<bool()>& done)
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (!done())
+    {
+        if (m_Tasks.empty())
+        {
+            ++m_NumWaiting;
+            m_TaskAvailable.wait(lock);
+            --m_NumWaiting;
+            continue;
+        }
+
+        std::function<void()> task = std::move(m_Tasks.front());
+        m_Tasks.pop_front();
+        lock.unlock();
+        RunTask(task);
+        lock.lock();
+    }
+}
+
+void ThreadPool::ParallelFor(unsigned int numIterations, unsigned int workPerIteration, const RangeFunction& func)
+{
+    const unsigned long long totalWork =
+        static_cast<unsigned long long>(numIterations) * std::max(workPerIteration, 1u);
+    const unsigned int numRanges = static_cast<unsigned int>(std::min<unsigned long long>(
+        { GetNumThreads(), numIterations, std::max<unsigned long long>(totalWork / MinWorkPerRange, 1) }));
+
+    if (numRanges <= 1)
+    {
+        if (numIterations > 0)
+        {
+            func(0, numIterations);
+        }
+        return;
+    }
+
+    // State of the loop, shared with the tasks helping with it, which may only start once it is complete.
+    struct Loop
+    {
+        std::atomic<unsigned int> m_NextRange;
+        unsigned int m_NumCompleted;
+        std::exception_ptr m_Error;
+        std::mutex m_Mutex;
+        std::condition_variable m_Completed;
+    };
+    auto loop = std::make_shared<Loop>();
+    loop->m_NextRange = 0;
+    loop->m_NumCompleted = 0;
+
+    // Claims ranges until none is left. func is only used while a range is claimed, that is before ParallelFor()
+    // returns.
+    auto RunRanges = [loop, numRanges, numIterations, &func]()
+    {
+        for (unsigned int range = loop->m_NextRange++; range < numRanges; range = loop->m_NextRange++)
+        {
+            const unsigned int begin = static_cast<unsigned int>(
+                static_cast<unsigned long long>(numIterations) * range / numRanges);
+            const unsigned int end = static_cast<unsigned int>(
+                static_cast<unsigned long long>(numIterations) * (range + 1) / numRanges);
+
+            std::exception_ptr error;
+            try
+            {
+                func(begin, end);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(loop->m_Mutex);
+            if (error && !loop->m_Error)
+            {
+                loop->m_Error = error;
+            }
+            if (++loop->m_NumCompleted == numRanges)
+            {
+                loop->m_Completed.notify_all();
+            }
+        }
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (unsigned int i = 1; i < numRanges; ++i)
+        {
+            m_Tasks.push_back(RunRanges);
+        }
+    }
+    m_TaskAvailable.notify_all();
+
+    RunRanges();
+
+    std::unique_lock<std::mutex> lock(loop->m_Mutex);
+    loop->m_Completed.wait(lock, [&]() { return loop->m_NumCompleted == numRanges; });
+    if (loop->m_Error)
+    {
+        std::rethrow_exception(loop->m_Error);
+    }
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::GetDefault()
+{
+    std::lock_guard<std::mutex> lock(GetDefaultMutex());
+    return GetDefaultThreadPool();
+}
+
+void ThreadPool::SetDefault(std::shared_ptr<ThreadPool> threadPool)
+{
+    std::lock_guard<std::mutex> lock(GetDefaultMutex());
+    GetDefaultThreadPool() = std::move(threadPool);
+}
+
+void ThreadPool::ClearDefault(const ThreadPool* threadPool)
+{
+    std::lock_guard<std::mutex> lock(GetDefaultMutex());
+    if (GetDefaultThreadPool().get() == threadPool)
+    {
+        GetDefaultThreadPool().reset();
+    }
+}
+
+void ParallelFor(unsigned int numIterations, unsigned int workPerIteration, const ThreadPool::RangeFunction& func)
+{
+    std::shared_ptr<ThreadPool> threadPool = ThreadPool::GetDefault();
+    if (threadPool)
+    {
+        threadPool->ParallelFor(numIterations, workPerIteration, func);
+    }
+    else if (numIterations > 0)
+    {
+        func(0, numIterations);
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,82 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+/// A fixed set of worker threads that share out the iterations of a loop with the thread running the loop.
+///
+/// The iterations are always split into the same contiguous ranges for a given loop size, cost and number of
+/// threads, so a kernel that writes each output from a single iteration produces the same results whichever
+/// thread runs it. Several threads may run loops on the same pool at once; each of them works on its own loop
+/// while it waits, so nested or concurrent loops cannot deadlock.
+class ThreadPool
+{
+public:
+    using RangeFunction = std::function<void(unsigned int begin, unsigned int end)>;
+
+    /// Minimum amount of work, in the units of the workPerIteration argument of ParallelFor(), given to a thread.
+    static constexpr unsigned long long MinWorkPerRange = 32768;
+
+    /// @param numThreads - Number of threads working on a loop, including the one running it. 0 uses one per
+    ///                     hardware thread.
+    /// @param cpuAffinity - Processors the worker threads are pinned to, in turn. Empty leaves them unpinned.
+    ///                      Ignored on platforms without thread affinity.
+    ThreadPool(unsigned int numThreads, const std::vector<unsigned int>& cpuAffinity = {});
+    ~ThreadPool();
+
+    unsigned int GetNumThreads() const { return static_cast<unsigned int>(m_Workers.size()) + 1; }
+
+    /// Calls func(begin, end) on contiguous ranges covering [0, numIterations) and returns once all of them have
+    /// completed. workPerIteration is a rough cost of one iteration: loops too small to be worth sharing run on the
+    /// calling thread only. The first exception thrown by func is rethrown.
+    void ParallelFor(unsigned int numIterations, unsigned int workPerIteration, const RangeFunction& func);
+
+    /// Queues a task for the worker threads, or for a thread in RunTasksUntil(). The task must not throw.
+    void Submit(std::function<void()> task);
+
+    /// Runs queued tasks on the calling thread until done() returns true, waiting for more when there is none.
+    /// done() is called with the queue locked, so it must not use the pool, and it may only become true when a task
+    /// of the pool completes.
+    void RunTasksUntil(const std::function<bool()>& done);
+
+    /// The pool used by the free ParallelFor() function, or nullptr if loops run on the calling thread only.
+    static std::shared_ptr<ThreadPool> GetDefault();
+    static void SetDefault(std::shared_ptr<ThreadPool> threadPool);
+
+    /// Unsets the default pool if it is the given one.
+    static void ClearDefault(const ThreadPool* threadPool);
+
+private:
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void WorkerLoop();
+
+    // Runs a task taken from the queue, then wakes the threads in RunTasksUntil() so that they check whether they
+    // are done.
+    void RunTask(std::function<void()>& task);
+
+    std::vector<std::thread> m_Workers;
+    std::deque<std::function<void()>> m_Tasks;
+    std::mutex m_Mutex;
+    std::condition_variable m_TaskAvailable;
+    unsigned int m_NumWaiting;
+    bool m_Stopping;
+};
+
+/// Runs a loop on the default thread pool (see ThreadPool::ParallelFor()), or on the calling thread if none is set.
+void ParallelFor(unsigned int numIterations, unsigned int workPerIteration, const ThreadPool::RangeFunction& func);
+
+} // namespace armnn
@@ -0,0 +1,48 @@
+﻿//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "ITensorHandle.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace armnn
+{
+
+/// State a workload carries from one execution to the next within one execution context (see
+/// IWorkload::CreateState), such as the recurrent state of a stateful LSTM sequence.
+class IWorkloadState
+{
+public:
+    virtual ~IWorkloadState() {}
+
+    /// Discards the state, so that the next execution starts again from the inputs of the workload.
+    virtual void Reset() = 0;
+};
+
+/// The tensor handles a workload reads and writes when it is run with the working memory
+/// of one execution context (see IWorkload::ExecuteAsync) instead of the handles it was created with.
+/// They are in the same order as the m_Inputs and m_Outputs of the workload's queue descriptor.
+struct WorkingMemDescriptor
+{
+    std::vector<ITensorHandle*> m_Inputs;
+    std::vector<ITensorHandle*> m_Outputs;
+
+    /// The state of the workload in this context. Null for workloads without state.
+    std::unique_ptr<IWorkloadState> m_State;
+};
+
+/// Returns a copy of a queue descriptor that refers to the tensors of the given working memory.
+template <typename QueueDescriptor>
+QueueDescriptor WithWorkingMemory(const QueueDescriptor& descriptor, const WorkingMemDescriptor& workingMemDescriptor)
+{
+    QueueDescriptor result = descriptor;
+    result.m_Inputs  = workingMemDescriptor.m_Inputs;
+    result.m_Outputs = workingMemDescriptor.m_Outputs;
+    return result;
+}
+
+} //namespace armnn
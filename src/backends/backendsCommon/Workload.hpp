@@ -4,12 +4,14 @@
 //
 #pragma once
 
+#include "WorkingMemDescriptor.hpp"
 #include "WorkloadData.hpp"
 #include "WorkloadInfo.hpp"
 
 #include <Profiling.hpp>
 
 #include <algorithm>
+#include <mutex>
 
 namespace armnn
 {
@@ -23,7 +25,19 @@ public:
     virtual void PostAllocationConfigure() = 0;
     virtual void Execute() const = 0;
 
+    /// Runs the workload on the tensors of the given working memory rather than on the tensor handles it was
+    /// created with. Several threads may call this at the same time with different working memories.
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) = 0;
+
     virtual void RegisterDebugCallback(const DebugCallbackFunction& func) {}
+
+    /// Creates the state the workload carries from one execution to the next when it is run with a working memory
+    /// of its own (see WorkingMemDescriptor::m_State). Returns null for workloads without state.
+    virtual std::unique_ptr<IWorkloadState> CreateState() const { return nullptr; }
+
+    /// Discards the state the workload carries from one execution to the next when it is run with the tensor
+    /// handles it was created with, such as the recurrent state of a stateful LSTM sequence.
+    virtual void ResetState() {}
 };
 
 // NullWorkload used to denote an unsupported workload when used by the MakeWorkload<> template
@@ -47,10 +61,39 @@ public:
 
     void PostAllocationConfigure() override {}
 
+    /// Default implementation for workloads that can only run on their own tensor handles: the handles are
+    /// swapped for those of the working memory for the duration of one Execute(), one caller at a time.
+    /// Must not run concurrently with Execute() called directly.
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override
+    {
+        std::lock_guard<std::mutex> lockGuard(m_AsyncMutex);
+
+        auto SwapTensors = [&]()
+        {
+            std::swap(m_Data.m_Inputs, workingMemDescriptor.m_Inputs);
+            std::swap(m_Data.m_Outputs, workingMemDescriptor.m_Outputs);
+        };
+
+        SwapTensors();
+        try
+        {
+            Execute();
+        }
+        catch (...)
+        {
+            SwapTensors();
+            throw;
+        }
+        SwapTensors();
+    }
+
     const QueueDescriptor& GetData() const { return m_Data; }
 
 protected:
-    const QueueDescriptor m_Data;
+    QueueDescriptor m_Data;
+
+private:
+    std::mutex m_AsyncMutex;
 };
 
 // TypedWorkload used
@@ -843,7 +843,10 @@ void FloorQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
 
 void LstmQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
 {
-    ValidateTensorNumDimensions(workloadInfo.m_InputTensorInfos[0], "LstmQueueDescriptor", 2, "input");
+    // A stateful sequence has a time dimension in front of the batch.
+    const unsigned int numSequenceDimensions = m_Parameters.m_StatefulSequence ? 3 : 2;
+    ValidateTensorNumDimensions(workloadInfo.m_InputTensorInfos[0], "LstmQueueDescriptor",
+                                numSequenceDimensions, "input");
     ValidateTensorNumDimensions(workloadInfo.m_OutputTensorInfos[0], "LstmQueueDescriptor", 2, "output");
 }
 
@@ -11,6 +11,7 @@
 
 #include <armnn/Descriptors.hpp>
 #include <armnn/Exceptions.hpp>
+#include <armnn/Optional.hpp>
 #include <armnn/Types.hpp>
 #include <armnn/Tensor.hpp>
 
@@ -124,6 +125,9 @@ struct FullyConnectedQueueDescriptor : QueueDescriptorWithParameters<FullyConnec
     const ConstCpuTensorHandle* m_Weight;
     const ConstCpuTensorHandle* m_Bias;
 
+    /// Activation applied to the output, if one has been fused into the layer.
+    Optional<ActivationDescriptor> m_FusedActivation;
+
     void Validate(const WorkloadInfo& workloadInfo) const;
 };
 
@@ -151,6 +155,9 @@ struct Convolution2dQueueDescriptor : QueueDescriptorWithParameters<Convolution2
     const ConstCpuTensorHandle* m_Weight;
     const ConstCpuTensorHandle* m_Bias;
 
+    /// Activation applied to the output, if one has been fused into the layer.
+    Optional<ActivationDescriptor> m_FusedActivation;
+
     void Validate(const WorkloadInfo& workloadInfo) const;
 };
 
@@ -166,6 +173,9 @@ struct DepthwiseConvolution2dQueueDescriptor : QueueDescriptorWithParameters<Dep
     const ConstCpuTensorHandle* m_Weight;
     const ConstCpuTensorHandle* m_Bias;
 
+    /// Activation applied to the output, if one has been fused into the layer.
+    Optional<ActivationDescriptor> m_FusedActivation;
+
     void Validate(const WorkloadInfo& workloadInfo) const;
 };
 
@@ -796,6 +796,12 @@ bool IWorkloadFactory::IsLayerSupported(const IConnectableLayer& connectableLaye
 }
 
 // Default Implementations
+std::unique_ptr<ITensorHandle> IWorkloadFactory::CreateAliasTensorHandle(ITensorHandle& parent,
+                                                                         const TensorInfo& tensorInfo) const
+{
+    return std::unique_ptr<ITensorHandle>();
+}
+
 std::unique_ptr<IWorkload> IWorkloadFactory::CreateActivation(const ActivationQueueDescriptor& descriptor,
                                                               const WorkloadInfo& info) const
 {
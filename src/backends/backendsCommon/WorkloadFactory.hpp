@@ -41,6 +41,11 @@ public:
                                                                  unsigned int const* subTensorOrigin
                                                                 ) const = 0;
 
+    // Creates a tensor sharing the memory of the parent, seen as a tensor of the given info of the same size in
+    // bytes. Returns nullptr if the backend cannot do so.
+    virtual std::unique_ptr<ITensorHandle> CreateAliasTensorHandle(ITensorHandle& parent,
+                                                                   const TensorInfo& tensorInfo) const;
+
     virtual std::unique_ptr<IWorkload> CreateInput(const InputQueueDescriptor& descriptor,
                                                    const WorkloadInfo& info) const = 0;
 
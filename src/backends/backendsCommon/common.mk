@@ -13,6 +13,7 @@ COMMON_SOURCES := \
     LayerSupportBase.cpp \
     MemCopyWorkload.cpp \
     OutputHandler.cpp \
+    ThreadPool.cpp \
     WorkloadData.cpp \
     WorkloadFactory.cpp \
     WorkloadUtils.cpp
@@ -25,4 +26,5 @@ COMMON_TEST_SOURCES := \
     test/JsonPrinterTestImpl.cpp \
     test/LayerTests.cpp \
     test/TensorCopyUtils.cpp \
+    test/ThreadPoolTests.cpp \
     test/WorkloadDataValidation.cpp
@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: MIT
 //
 
+#include "TensorCopyUtils.hpp"
+
 #include <Graph.hpp>
 
 #include <backendsCommon/CpuTensorHandle.hpp>
@@ -11,6 +13,7 @@
 #include <boost/cast.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <numeric>
 #include <utility>
 
 using namespace armnn;
@@ -203,5 +206,100 @@ BOOST_AUTO_TEST_CASE(ReleaseFullyConnectedLayerConstantDataTest)
     BOOST_CHECK(layer->m_Bias == nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(ReleasedConstantDataIsKeptByCopiesTest)
+{
+    Graph graph;
+
+    FullyConnectedDescriptor layerDesc;
+    layerDesc.m_BiasEnabled = false;
+
+    FullyConnectedLayer* const layer = graph.AddLayer<FullyConnectedLayer>(layerDesc, "layer");
+
+    std::vector<float> weights = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ 2, 3 }, DataType::Float32), weights));
+    const float* weightData = layer->m_Weight->GetConstTensor<float>();
+
+    // Copying the graph and making workload data from the layer share the weights rather than duplicating them.
+    Graph graphCopy(graph);
+    const FullyConnectedLayer& layerCopy =
+        *boost::polymorphic_downcast<const FullyConnectedLayer*>(*graphCopy.begin());
+    ScopedCpuTensorHandle workloadWeights(*static_cast<const ConstCpuTensorHandle*>(layerCopy.m_Weight.get()));
+
+    BOOST_CHECK(layerCopy.m_Weight->GetConstTensor<float>() == weightData);
+    BOOST_CHECK(workloadWeights.GetConstTensor<float>() == weightData);
+    BOOST_CHECK(workloadWeights.IsShared());
+
+    // Releasing the layers leaves the weights to the last copy.
+    layer->ReleaseConstantData();
+    (*graphCopy.begin())->ReleaseConstantData();
+
+    BOOST_CHECK(!workloadWeights.IsShared());
+    BOOST_CHECK(workloadWeights.GetConstTensor<float>() == weightData);
+    BOOST_CHECK(std::equal(weights.begin(), weights.end(), workloadWeights.GetConstTensor<float>()));
+}
+
+BOOST_AUTO_TEST_CASE(DerivedConstantDataIsSharedByCopiesTest)
+{
+    std::vector<float> weights = { 1.0f, 2.0f, 3.0f, 4.0f };
+    ScopedCpuTensorHandle original(ConstTensor(TensorInfo({ 2, 2 }, DataType::Float32), weights));
+    ScopedCpuTensorHandle copy(original);
+
+    unsigned int numDerivations = 0;
+    const std::function<std::vector<float>()> Reverse = [&]()
+    {
+        ++numDerivations;
+        return std::vector<float>(weights.rbegin(), weights.rend());
+    };
+
+    // The data derived under the same key is computed once for all the copies.
+    std::shared_ptr<const std::vector<float>> reversed = GetDerivedData(original, "Reversed", Reverse);
+    BOOST_CHECK(GetDerivedData(copy, "Reversed", Reverse) == reversed);
+    BOOST_CHECK(*reversed == std::vector<float>({ 4.0f, 3.0f, 2.0f, 1.0f }));
+    BOOST_CHECK(numDerivations == 1);
+
+    GetDerivedData(copy, "Other", Reverse);
+    BOOST_CHECK(numDerivations == 2);
+
+    // Tensors that merely hold the same values do not share it.
+    ScopedCpuTensorHandle other(ConstTensor(TensorInfo({ 2, 2 }, DataType::Float32), weights));
+    BOOST_CHECK(GetDerivedData(other, "Reversed", Reverse) != reversed);
+    BOOST_CHECK(numDerivations == 3);
+}
+
+BOOST_AUTO_TEST_CASE(WritingToACopyOfConstantDataLeavesTheOthersTest)
+{
+    std::vector<float> weights = { 1.0f, 2.0f, 3.0f, 4.0f };
+    const TensorInfo info({ 2, 2 }, DataType::Float32);
+    ScopedCpuTensorHandle original(ConstTensor(info, weights));
+    ScopedCpuTensorHandle copy(original);
+
+    const std::function<std::vector<float>()> Sum = [&]()
+    {
+        const float* data = copy.GetConstTensor<float>();
+        return std::vector<float>(1, std::accumulate(data, data + info.GetNumElements(), 0.0f));
+    };
+    std::shared_ptr<const std::vector<float>> sum = GetDerivedData(copy, "Sum", Sum);
+
+    // The copy moves to memory of its own before being written, with no derived data.
+    const std::vector<float> newWeights = { 5.0f, 6.0f, 7.0f, 8.0f };
+    CopyDataToITensorHandle(&copy, newWeights.data());
+
+    BOOST_CHECK(!original.IsShared());
+    BOOST_CHECK(std::equal(weights.begin(), weights.end(), original.GetConstTensor<float>()));
+    BOOST_CHECK(std::equal(newWeights.begin(), newWeights.end(), copy.GetConstTensor<float>()));
+    BOOST_CHECK(GetDerivedData(original, "Sum", Sum) == sum);
+    BOOST_CHECK(*GetDerivedData(copy, "Sum", Sum) == std::vector<float>(1, 26.0f));
+
+    // Memory owned elsewhere is not written to either.
+    std::shared_ptr<void> external(weights.data(), [](void*) {});
+    ScopedCpuTensorHandle view(info, external);
+    CopyDataToITensorHandle(&view, newWeights.data());
+
+    BOOST_CHECK(view.GetConstTensor<float>() != weights.data());
+    BOOST_CHECK(std::equal(newWeights.begin(), newWeights.end(), view.GetConstTensor<float>()));
+    BOOST_CHECK(weights == std::vector<float>({ 1.0f, 2.0f, 3.0f, 4.0f }));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,162 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <backendsCommon/ThreadPool.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace armnn;
+
+BOOST_AUTO_TEST_SUITE(ThreadPoolTests)
+
+BOOST_AUTO_TEST_CASE(RangesCoverAllIterationsOnce)
+{
+    ThreadPool threadPool(4);
+    BOOST_TEST(threadPool.GetNumThreads() == 4);
+
+    for (unsigned int numIterations : { 0u, 1u, 3u, 4u, 7u, 1000u })
+    {
+        std::vector<std::atomic<unsigned int>> counts(numIterations);
+        for (auto& count : counts)
+        {
+            count = 0;
+        }
+
+        // Boost.Test checks are not thread safe, so the workers only record what they see.
+        std::atomic<bool> emptyRange(false);
+        threadPool.ParallelFor(numIterations, ThreadPool::MinWorkPerRange, [&](unsigned int begin, unsigned int end)
+        {
+            emptyRange = emptyRange || begin >= end;
+            for (unsigned int i = begin; i < end; ++i)
+            {
+                ++counts[i];
+            }
+        });
+
+        BOOST_TEST(!emptyRange);
+        for (auto& count : counts)
+        {
+            BOOST_TEST(count == 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SmallLoopsRunOnCallingThread)
+{
+    ThreadPool threadPool(4);
+    const std::thread::id caller = std::this_thread::get_id();
+
+    unsigned int numRanges = 0;
+    threadPool.ParallelFor(100, 1, [&](unsigned int begin, unsigned int end)
+    {
+        BOOST_TEST(std::this_thread::get_id() == caller);
+        BOOST_TEST(begin == 0);
+        BOOST_TEST(end == 100);
+        ++numRanges;
+    });
+    BOOST_TEST(numRanges == 1);
+}
+
+BOOST_AUTO_TEST_CASE(ExceptionIsRethrownOnCallingThread)
+{
+    ThreadPool threadPool(4);
+    BOOST_CHECK_THROW(threadPool.ParallelFor(8, ThreadPool::MinWorkPerRange, [](unsigned int begin, unsigned int)
+    {
+        if (begin > 0)
+        {
+            throw std::runtime_error("range failed");
+        }
+    }), std::runtime_error);
+
+    // The pool is still usable afterwards.
+    std::atomic<unsigned int> total(0);
+    threadPool.ParallelFor(8, ThreadPool::MinWorkPerRange, [&](unsigned int begin, unsigned int end)
+    {
+        total += end - begin;
+    });
+    BOOST_TEST(total == 8);
+}
+
+BOOST_AUTO_TEST_CASE(NestedAndConcurrentLoopsComplete)
+{
+    ThreadPool threadPool(3);
+    std::atomic<unsigned int> total(0);
+
+    auto RunNestedLoops = [&]()
+    {
+        threadPool.ParallelFor(6, ThreadPool::MinWorkPerRange, [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int i = begin; i < end; ++i)
+            {
+                threadPool.ParallelFor(5, ThreadPool::MinWorkPerRange, [&](unsigned int innerBegin,
+                                                                          unsigned int innerEnd)
+                {
+                    total += innerEnd - innerBegin;
+                });
+            }
+        });
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back(RunNestedLoops);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    BOOST_TEST(total == 4 * 6 * 5);
+}
+
+BOOST_AUTO_TEST_CASE(SubmittedTasksRunWhileWaiting)
+{
+    ThreadPool threadPool(3);
+
+    // Each task submits the next one, so that the waiting thread has to wait for tasks to become available.
+    std::atomic<unsigned int> numCompleted(0);
+    std::function<void()> task = [&]()
+    {
+        if (++numCompleted < 20)
+        {
+            threadPool.Submit(task);
+        }
+    };
+    threadPool.Submit(task);
+    threadPool.RunTasksUntil([&]() { return numCompleted == 20; });
+
+    BOOST_TEST(numCompleted == 20);
+}
+
+BOOST_AUTO_TEST_CASE(DefaultPoolIsOnlyClearedByItsOwner)
+{
+    auto threadPool = std::make_shared<ThreadPool>(2);
+    ThreadPool other(2);
+
+    ThreadPool::SetDefault(threadPool);
+    ThreadPool::ClearDefault(&other);
+    BOOST_TEST(ThreadPool::GetDefault() == threadPool);
+
+    ThreadPool::ClearDefault(threadPool.get());
+    BOOST_TEST(!ThreadPool::GetDefault());
+
+    // Without a default pool, loops run on the calling thread.
+    unsigned int numRanges = 0;
+    ParallelFor(8, ThreadPool::MinWorkPerRange, [&](unsigned int begin, unsigned int end)
+    {
+        BOOST_TEST(begin == 0);
+        BOOST_TEST(end == 8);
+        ++numRanges;
+    });
+    BOOST_TEST(numRanges == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -241,6 +241,11 @@ arm_compute::Status ClLstmFloatWorkloadValidate(const TensorInfo& input, const T
                                                 const TensorInfo* cellToForgetWeights,
                                                 const TensorInfo* cellToOutputWeights)
 {
+    if (descriptor.m_StatefulSequence)
+    {
+        return arm_compute::Status(arm_compute::ErrorCode::RUNTIME_ERROR, "Stateful sequences are not supported");
+    }
+
     arm_compute::LSTMParams<arm_compute::ITensorInfo> lstm_params_info;
 
     // The inputs and the outputs
@@ -7,14 +7,17 @@
 #include "RefBackendId.hpp"
 #include "RefWorkloadFactory.hpp"
 #include "RefLayerSupport.hpp"
+#include "RefMemoryManager.hpp"
 
 #include <backendsCommon/IBackendContext.hpp>
 #include <backendsCommon/IMemoryManager.hpp>
 #include <backendsCommon/BackendRegistry.hpp>
 
 #include <Optimizer.hpp>
+#include <optimizations/FuseActivation.hpp>
 
 #include <boost/cast.hpp>
+#include <boost/polymorphic_pointer_cast.hpp>
 
 namespace armnn
 {
@@ -43,7 +46,8 @@ const BackendId& RefBackend::GetIdStatic()
 IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
     const IBackendInternal::IMemoryManagerSharedPtr& memoryManager) const
 {
-    return std::make_unique<RefWorkloadFactory>();
+    return std::make_unique<RefWorkloadFactory>(
+        boost::polymorphic_pointer_downcast<RefMemoryManager>(memoryManager));
 }
 
 IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(const IRuntime::CreationOptions&) const
@@ -53,7 +57,7 @@ IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(const IRun
 
 IBackendInternal::IMemoryManagerUniquePtr RefBackend::CreateMemoryManager() const
 {
-    return IMemoryManagerUniquePtr{};
+    return std::make_unique<RefMemoryManager>();
 }
 
 IBackendInternal::ISubGraphConverterPtr RefBackend::CreateSubGraphConverter(
@@ -64,7 +68,14 @@ IBackendInternal::ISubGraphConverterPtr RefBackend::CreateSubGraphConverter(
 
 IBackendInternal::Optimizations RefBackend::GetOptimizations() const
 {
-    return Optimizations{};
+    // The reference convolution and fully connected workloads apply a fused activation to their output.
+    using namespace optimizations;
+
+    Optimizations fusions;
+    fusions.push_back(std::make_unique<FuseActivationIntoConvolution2d>(GetIdStatic()));
+    fusions.push_back(std::make_unique<FuseActivationIntoDepthwiseConvolution2d>(GetIdStatic()));
+    fusions.push_back(std::make_unique<FuseActivationIntoFullyConnected>(GetIdStatic()));
+    return fusions;
 }
 
 IBackendInternal::ILayerSupportSharedPtr RefBackend::GetLayerSupport() const
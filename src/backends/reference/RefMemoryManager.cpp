@@ -0,0 +1,180 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefMemoryManager.hpp"
+#include "RefTensorHandle.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace armnn
+{
+
+namespace
+{
+
+size_t AlignUp(size_t numBytes)
+{
+    return (numBytes + RefMemoryManager::Alignment - 1) / RefMemoryManager::Alignment * RefMemoryManager::Alignment;
+}
+
+} // anonymous namespace
+
+RefMemoryManager::RefMemoryManager()
+: m_Clock(0)
+, m_IsPlanned(false)
+, m_ArenaSize(0)
+{
+}
+
+RefMemoryManager::~RefMemoryManager()
+{
+}
+
+unsigned int RefMemoryManager::Manage(RefTensorHandle* handle, size_t numBytes)
+{
+    // Every block gets at least one aligned slot so that each managed tensor has a distinct address.
+    Block block;
+    block.m_Handle   = handle;
+    block.m_NumBytes = AlignUp(std::max<size_t>(numBytes, 1));
+    block.m_Begin    = m_Clock++;
+    block.m_End      = std::numeric_limits<unsigned int>::max();
+    block.m_Offset   = 0;
+    m_Blocks.push_back(block);
+    m_IsPlanned = false;
+
+    return static_cast<unsigned int>(m_Blocks.size() - 1);
+}
+
+void RefMemoryManager::Allocate(unsigned int block)
+{
+    BOOST_ASSERT(block < m_Blocks.size());
+    m_Blocks[block].m_End = m_Clock++;
+    m_IsPlanned = false;
+}
+
+void RefMemoryManager::Unmanage(unsigned int block)
+{
+    BOOST_ASSERT(block < m_Blocks.size());
+    m_Blocks[block].m_Handle = nullptr;
+    m_IsPlanned = false;
+}
+
+void RefMemoryManager::Plan()
+{
+    // Greedy by size: place the largest blocks first, each at the lowest offset of the smallest gap that fits among
+    // the already placed blocks whose lifetimes overlap with it. Blocks whose handles have been destroyed take no space.
+    std::vector<unsigned int> order;
+    order.reserve(m_Blocks.size());
+    for (unsigned int index = 0; index < m_Blocks.size(); ++index)
+    {
+        if (m_Blocks[index].m_Handle)
+        {
+            order.push_back(index);
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [this](unsigned int a, unsigned int b)
+    {
+        return m_Blocks[a].m_NumBytes > m_Blocks[b].m_NumBytes;
+    });
+
+    std::vector<const Block*> placed;
+    std::vector<const Block*> live;
+    placed.reserve(m_Blocks.size());
+    m_ArenaSize = 0;
+
+    for (unsigned int index : order)
+    {
+        Block& block = m_Blocks[index];
+
+        live.clear();
+        for (const Block* other : placed)
+        {
+            if (other->m_Begin <= block.m_End && block.m_Begin <= other->m_End)
+            {
+                live.push_back(other);
+            }
+        }
+        std::sort(live.begin(), live.end(), [](const Block* a, const Block* b) { return a->m_Offset < b->m_Offset; });
+
+        size_t bestOffset = std::numeric_limits<size_t>::max();
+        size_t bestGap    = std::numeric_limits<size_t>::max();
+        size_t current    = 0;
+        for (const Block* other : live)
+        {
+            if (other->m_Offset >= current)
+            {
+                const size_t gap = other->m_Offset - current;
+                if (gap >= block.m_NumBytes && gap < bestGap)
+                {
+                    bestGap    = gap;
+                    bestOffset = current;
+                }
+            }
+            current = std::max(current, other->m_Offset + other->m_NumBytes);
+        }
+
+        block.m_Offset = bestOffset != std::numeric_limits<size_t>::max() ? bestOffset : current;
+        m_ArenaSize = std::max(m_ArenaSize, block.m_Offset + block.m_NumBytes);
+        placed.push_back(&block);
+    }
+
+    m_IsPlanned = true;
+}
+
+size_t RefMemoryManager::GetArenaSize()
+{
+    if (!m_IsPlanned)
+    {
+        Plan();
+    }
+    return m_ArenaSize;
+}
+
+void RefMemoryManager::Acquire()
+{
+    if (m_Arena)
+    {
+        return;
+    }
+
+    if (!m_IsPlanned)
+    {
+        Plan();
+    }
+
+    if (m_ArenaSize == 0)
+    {
+        return;
+    }
+
+    m_Arena.reset(new unsigned char[m_ArenaSize + Alignment - 1]);
+    const uintptr_t address = reinterpret_cast<uintptr_t>(m_Arena.get());
+    unsigned char* base = m_Arena.get() + (AlignUp(address) - address);
+
+    for (const Block& block : m_Blocks)
+    {
+        if (block.m_Handle)
+        {
+            block.m_Handle->SetArenaMemory(base + block.m_Offset);
+        }
+    }
+}
+
+void RefMemoryManager::Release()
+{
+    for (const Block& block : m_Blocks)
+    {
+        if (block.m_Handle)
+        {
+            block.m_Handle->SetArenaMemory(nullptr);
+        }
+    }
+    m_Arena.reset();
+}
+
+} // namespace armnn
@@ -0,0 +1,67 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <backendsCommon/IMemoryManager.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace armnn
+{
+
+class RefTensorHandle;
+
+// Memory manager for the reference backend.
+//
+// Tensor handles report the start (Manage) and the end (Allocate) of their lifetimes while the graph is walked in
+// execution order. On the first Acquire() the manager assigns every managed tensor an offset such that tensors whose
+// lifetimes overlap never share memory, then backs all of them with a single aligned arena. Release() frees the arena
+// and a later Acquire() allocates it again using the same plan.
+class RefMemoryManager : public IMemoryManager
+{
+public:
+    /// Alignment, in bytes, of the arena and of every tensor placed in it.
+    static constexpr size_t Alignment = 64;
+
+    RefMemoryManager();
+    virtual ~RefMemoryManager();
+
+    /// Starts the lifetime of a tensor. Returns the index of the block that will hold its data.
+    unsigned int Manage(RefTensorHandle* handle, size_t numBytes);
+
+    /// Ends the lifetime of a block returned by Manage().
+    void Allocate(unsigned int block);
+
+    /// Detaches a tensor handle that is being destroyed from its block. The block is left out of the next plan.
+    void Unmanage(unsigned int block);
+
+    void Acquire() override;
+    void Release() override;
+
+    /// Size in bytes of the arena required by the current plan (computing the plan if needed).
+    size_t GetArenaSize();
+
+private:
+    struct Block
+    {
+        RefTensorHandle* m_Handle;
+        size_t           m_NumBytes;
+        unsigned int     m_Begin;
+        unsigned int     m_End;
+        size_t           m_Offset;
+    };
+
+    void Plan();
+
+    std::vector<Block> m_Blocks;
+    unsigned int m_Clock;
+    bool m_IsPlanned;
+    size_t m_ArenaSize;
+
+    std::unique_ptr<unsigned char[]> m_Arena;
+};
+
+} // namespace armnn
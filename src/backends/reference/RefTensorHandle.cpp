@@ -0,0 +1,121 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefTensorHandle.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/TypesUtils.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+namespace armnn
+{
+
+RefTensorHandle::RefTensorHandle(const TensorInfo& tensorInfo, std::shared_ptr<RefMemoryManager> memoryManager)
+: CpuTensorHandle(tensorInfo)
+, m_MemoryManager(std::move(memoryManager))
+, m_Block(0)
+, m_IsManaged(false)
+, m_IsAllocated(false)
+, m_UnmanagedMemory(nullptr)
+, m_ArenaMemory(nullptr)
+, m_ImportedMemory(nullptr)
+{
+    BOOST_ASSERT(m_MemoryManager);
+}
+
+RefTensorHandle::~RefTensorHandle()
+{
+    if (m_IsManaged)
+    {
+        m_MemoryManager->Unmanage(m_Block);
+    }
+    ::operator delete(m_UnmanagedMemory);
+}
+
+void RefTensorHandle::Manage()
+{
+    if (m_IsManaged || m_IsAllocated)
+    {
+        throw InvalidArgumentException("RefTensorHandle::Manage() Trying to manage a RefTensorHandle "
+                                       "whose memory is already set up.");
+    }
+
+    m_Block = m_MemoryManager->Manage(this, GetTensorInfo().GetNumBytes());
+    m_IsManaged = true;
+}
+
+void RefTensorHandle::Allocate()
+{
+    if (m_IsAllocated)
+    {
+        throw InvalidArgumentException("RefTensorHandle::Allocate() Trying to allocate a RefTensorHandle "
+                                       "that already has allocated memory.");
+    }
+
+    if (m_IsManaged)
+    {
+        // The memory itself comes from the arena when the memory manager is acquired.
+        m_MemoryManager->Allocate(m_Block);
+    }
+    else
+    {
+        m_UnmanagedMemory = ::operator new(GetTensorInfo().GetNumBytes());
+        if (!m_ImportedMemory)
+        {
+            SetMemory(m_UnmanagedMemory);
+        }
+    }
+    m_IsAllocated = true;
+}
+
+bool RefTensorHandle::CanBeImported(void* memory) const
+{
+    // The kernels only need the memory to be aligned for the type of the tensor elements.
+    return memory == nullptr ||
+           reinterpret_cast<uintptr_t>(memory) % GetDataTypeSize(GetTensorInfo().GetDataType()) == 0;
+}
+
+bool RefTensorHandle::Import(void* memory)
+{
+    if (!CanBeImported(memory))
+    {
+        return false;
+    }
+
+    m_ImportedMemory = memory;
+    if (m_ImportedMemory)
+    {
+        SetMemory(m_ImportedMemory);
+    }
+    else
+    {
+        SetMemory(m_IsManaged ? m_ArenaMemory : m_UnmanagedMemory);
+    }
+    return true;
+}
+
+void RefTensorHandle::SetArenaMemory(void* memory)
+{
+    m_ArenaMemory = memory;
+    if (!m_ImportedMemory)
+    {
+        SetMemory(m_ArenaMemory);
+    }
+}
+
+void RefTensorHandle::CopyOutTo(void* memory) const
+{
+    memcpy(memory, GetTensor<void>(), GetTensorInfo().GetNumBytes());
+}
+
+void RefTensorHandle::CopyInFrom(const void* memory)
+{
+    memcpy(GetTensor<void>(), memory, GetTensorInfo().GetNumBytes());
+}
+
+} // namespace armnn
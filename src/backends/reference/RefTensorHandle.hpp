@@ -0,0 +1,52 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefMemoryManager.hpp"
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <memory>
+
+namespace armnn
+{
+
+// A CpuTensorHandle whose memory is either placed in the arena of a RefMemoryManager (when its lifetime is
+// managed) or allocated for the handle alone (when Allocate() is called without a preceding Manage()).
+class RefTensorHandle : public CpuTensorHandle
+{
+public:
+    RefTensorHandle(const TensorInfo& tensorInfo, std::shared_ptr<RefMemoryManager> memoryManager);
+    ~RefTensorHandle();
+
+    void Manage() override;
+    void Allocate() override;
+
+    bool CanBeImported(void* memory) const override;
+    bool Import(void* memory) override;
+
+private:
+    friend class RefMemoryManager;
+
+    // Called by the memory manager when the arena is acquired or released.
+    void SetArenaMemory(void* memory);
+
+    // Only used for testing
+    void CopyOutTo(void* memory) const override;
+    void CopyInFrom(const void* memory) override;
+
+    RefTensorHandle(const RefTensorHandle& other) = delete;
+    RefTensorHandle& operator=(const RefTensorHandle& other) = delete;
+
+    std::shared_ptr<RefMemoryManager> m_MemoryManager;
+    unsigned int m_Block;
+    bool m_IsManaged;
+    bool m_IsAllocated;
+    void* m_UnmanagedMemory;
+    void* m_ArenaMemory;
+    void* m_ImportedMemory;
+};
+
+} // namespace armnn
@@ -7,10 +7,12 @@
 #include <backendsCommon/MakeWorkloadHelper.hpp>
 #include "RefWorkloadFactory.hpp"
 #include "RefBackendId.hpp"
+#include "RefTensorHandle.hpp"
 #include "workloads/RefWorkloads.hpp"
 #include "Layer.hpp"
 
 #include <boost/log/trivial.hpp>
+#include <boost/polymorphic_cast.hpp>
 
 namespace armnn
 {
@@ -47,6 +49,11 @@ RefWorkloadFactory::RefWorkloadFactory()
 {
 }
 
+RefWorkloadFactory::RefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager)
+    : m_MemoryManager(memoryManager)
+{
+}
+
 const BackendId& RefWorkloadFactory::GetBackendId() const
 {
     return s_Id;
@@ -61,13 +68,44 @@ bool RefWorkloadFactory::IsLayerSupported(const Layer& layer,
 
 std::unique_ptr<ITensorHandle> RefWorkloadFactory::CreateTensorHandle(const TensorInfo& tensorInfo) const
 {
+    if (m_MemoryManager)
+    {
+        return std::make_unique<RefTensorHandle>(tensorInfo, m_MemoryManager);
+    }
     return std::make_unique<ScopedCpuTensorHandle>(tensorInfo);
 }
 
 std::unique_ptr<ITensorHandle> RefWorkloadFactory::CreateTensorHandle(const TensorInfo& tensorInfo,
                                                                       DataLayout dataLayout) const
 {
-    return std::make_unique<ScopedCpuTensorHandle>(tensorInfo);
+    return CreateTensorHandle(tensorInfo);
+}
+
+std::unique_ptr<ITensorHandle> RefWorkloadFactory::CreateSubTensorHandle(ITensorHandle& parent,
+                                                                         TensorShape const& subTensorShape,
+                                                                         unsigned int const* subTensorOrigin) const
+{
+    CpuTensorHandle* cpuParent = boost::polymorphic_downcast<CpuTensorHandle*>(&parent);
+    const TensorInfo& parentInfo = cpuParent->GetTensorInfo();
+    if (!CpuSubTensorHandle::IsContiguous(parentInfo.GetShape(), subTensorShape, subTensorOrigin))
+    {
+        return CreateTensorHandle(TensorInfo(subTensorShape,
+                                             parentInfo.GetDataType(),
+                                             parentInfo.GetQuantizationScale(),
+                                             parentInfo.GetQuantizationOffset()));
+    }
+    return std::make_unique<CpuSubTensorHandle>(*cpuParent, subTensorShape, subTensorOrigin);
+}
+
+std::unique_ptr<ITensorHandle> RefWorkloadFactory::CreateAliasTensorHandle(ITensorHandle& parent,
+                                                                           const TensorInfo& tensorInfo) const
+{
+    CpuTensorHandle* cpuParent = dynamic_cast<CpuTensorHandle*>(&parent);
+    if (!cpuParent || cpuParent->GetTensorInfo().GetNumBytes() != tensorInfo.GetNumBytes())
+    {
+        return nullptr;
+    }
+    return std::make_unique<CpuSubTensorHandle>(*cpuParent, tensorInfo);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateInput(const InputQueueDescriptor& descriptor,
@@ -4,6 +4,8 @@
 //
 #pragma once
 
+#include "RefMemoryManager.hpp"
+
 #include <armnn/Optional.hpp>
 #include <backendsCommon/WorkloadFactory.hpp>
 #include <backendsCommon/OutputHandler.hpp>
@@ -31,6 +33,7 @@ class RefWorkloadFactory : public IWorkloadFactory
 {
 public:
     explicit RefWorkloadFactory();
+    explicit RefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager);
     ~RefWorkloadFactory() {}
 
     const BackendId& GetBackendId() const override;
@@ -39,15 +42,16 @@ public:
                                  Optional<DataType> dataType,
                                  std::string& outReasonIfUnsupported);
 
-    bool SupportsSubTensors() const override { return false; }
+    bool SupportsSubTensors() const override { return true; }
 
+    // Only contiguous regions of the parent are viewed, as the kernels expect densely laid out tensors. Other regions
+    // get a tensor of their own instead, which the Merger and Splitter workloads copy to or from the parent.
     std::unique_ptr<ITensorHandle> CreateSubTensorHandle(ITensorHandle& parent,
                                                          TensorShape const& subTensorShape,
-                                                         unsigned int const* subTensorOrigin) const override
-    {
-        boost::ignore_unused(parent, subTensorShape, subTensorOrigin);
-        return nullptr;
-    }
+                                                         unsigned int const* subTensorOrigin) const override;
+
+    std::unique_ptr<ITensorHandle> CreateAliasTensorHandle(ITensorHandle& parent,
+                                                           const TensorInfo& tensorInfo) const override;
 
     std::unique_ptr<ITensorHandle> CreateTensorHandle(const TensorInfo& tensorInfo) const override;
 
@@ -188,6 +192,7 @@ private:
     template <typename F32Workload, typename U8Workload, typename QueueDescriptorType>
     std::unique_ptr<IWorkload> MakeWorkload(const QueueDescriptorType& descriptor, const WorkloadInfo& info) const;
 
+    std::shared_ptr<RefMemoryManager> m_MemoryManager;
 };
 
 } // namespace armnn
@@ -10,6 +10,8 @@
 BACKEND_SOURCES := \
         RefBackend.cpp \
         RefLayerSupport.cpp \
+        RefMemoryManager.cpp \
+        RefTensorHandle.cpp \
         RefWorkloadFactory.cpp \
         workloads/Activation.cpp \
         workloads/BatchToSpaceNd.cpp \
@@ -82,10 +84,13 @@ BACKEND_SOURCES := \
 # up by the Android.mk file in the root of ArmNN
 
 BACKEND_TEST_SOURCES := \
+        test/RefConvImplTests.cpp \
         test/RefCreateWorkloadTests.cpp \
         test/RefEndToEndTests.cpp \
         test/RefJsonPrinterTests.cpp \
         test/RefLayerSupportTests.cpp \
         test/RefLayerTests.cpp \
+        test/RefMemoryManagerTests.cpp \
         test/RefOptimizedNetworkTests.cpp \
+        test/RefQuantizedKernelTests.cpp \
         test/RefRuntimeTests.cpp
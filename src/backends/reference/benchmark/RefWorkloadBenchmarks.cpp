@@ -0,0 +1,574 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/RefLayerSupport.hpp>
+#include <reference/RefWorkloadFactory.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+#include <backendsCommon/test/WorkloadTestUtils.hpp>
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+#include <armnn/TypesUtils.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Microbenchmarks of the reference workloads, created through RefWorkloadFactory over a matrix of shapes, data types
+// and data layouts. Each benchmark reports the bytes of all the tensors read or written per second and, for the
+// operators where it is well defined, the nominal FLOP/s of the operator (2 per multiply-accumulate), which is not
+// necessarily the number of operations the reference kernels execute.
+// Combinations the reference backend does not support (according to RefLayerSupport) are not registered.
+
+namespace
+{
+
+using namespace armnn;
+
+const std::vector<DataType> g_DataTypes =
+{
+    DataType::Float32, DataType::QuantisedAsymm8, DataType::QuantisedSymm16, DataType::Float16
+};
+
+const std::vector<DataLayout> g_DataLayouts = { DataLayout::NCHW, DataLayout::NHWC };
+
+// Tensors and workload of one benchmark, together with the work done by one execution of the workload.
+class WorkloadFixture
+{
+public:
+    WorkloadFixture()
+        : m_Bytes(0.0)
+        , m_Flops(0.0)
+    {}
+
+    // Creates a zero-filled tensor, counted in the bytes accessed by each execution.
+    ScopedCpuTensorHandle* AddTensor(const TensorInfo& tensorInfo)
+    {
+        m_Tensors.push_back(std::make_unique<ScopedCpuTensorHandle>(tensorInfo));
+        ScopedCpuTensorHandle* tensor = m_Tensors.back().get();
+        tensor->Allocate();
+        std::memset(tensor->GetTensor<void>(), 0, tensorInfo.GetNumBytes());
+        m_Bytes += static_cast<double>(tensorInfo.GetNumBytes());
+        return tensor;
+    }
+
+    template <typename QueueDescriptor>
+    void AddInput(QueueDescriptor& descriptor, WorkloadInfo& info, const TensorInfo& tensorInfo)
+    {
+        AddInputToWorkload(descriptor, info, tensorInfo, AddTensor(tensorInfo));
+    }
+
+    template <typename QueueDescriptor>
+    void AddOutput(QueueDescriptor& descriptor, WorkloadInfo& info, const TensorInfo& tensorInfo)
+    {
+        AddOutputToWorkload(descriptor, info, tensorInfo, AddTensor(tensorInfo));
+    }
+
+    void SetWorkload(std::unique_ptr<IWorkload> workload, double flops)
+    {
+        // The tensors are already allocated, as they would be by the loaded network.
+        m_Workload = std::move(workload);
+        m_Workload->PostAllocationConfigure();
+        m_Flops = flops;
+    }
+
+    void Run(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            m_Workload->Execute();
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(m_Bytes) * static_cast<int64_t>(state.iterations()));
+        if (m_Flops > 0.0)
+        {
+            state.counters["FLOP/s"] = benchmark::Counter(m_Flops, benchmark::Counter::kIsIterationInvariantRate);
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<ScopedCpuTensorHandle>> m_Tensors;
+    std::unique_ptr<IWorkload> m_Workload;
+    double m_Bytes;
+    double m_Flops;
+};
+
+using FixturePtr = std::shared_ptr<WorkloadFixture>;
+
+RefWorkloadFactory& GetWorkloadFactory()
+{
+    static RefWorkloadFactory s_WorkloadFactory;
+    return s_WorkloadFactory;
+}
+
+const RefLayerSupport& GetLayerSupport()
+{
+    static RefLayerSupport s_LayerSupport;
+    return s_LayerSupport;
+}
+
+// The layer support queries write the reason a combination is unsupported, which is not reported here.
+Optional<std::string&> Reason()
+{
+    static std::string s_Reason;
+    s_Reason.clear();
+    return s_Reason;
+}
+
+bool IsQuantized(DataType dataType)
+{
+    return dataType == DataType::QuantisedAsymm8 || dataType == DataType::QuantisedSymm16;
+}
+
+TensorInfo MakeTensorInfo(const TensorShape& shape, DataType dataType)
+{
+    TensorInfo tensorInfo(shape, dataType);
+    if (IsQuantized(dataType))
+    {
+        tensorInfo.SetQuantizationScale(0.1f);
+        tensorInfo.SetQuantizationOffset(dataType == DataType::QuantisedAsymm8 ? 128 : 0);
+    }
+    return tensorInfo;
+}
+
+// Biases of quantized tensors are 32-bit integers, quantized with the product of the input and weights scales.
+TensorInfo MakeBiasInfo(const TensorShape& shape, const TensorInfo& input, const TensorInfo& weights)
+{
+    if (!IsQuantized(input.GetDataType()))
+    {
+        return TensorInfo(shape, input.GetDataType());
+    }
+    return TensorInfo(shape, DataType::Signed32, input.GetQuantizationScale() * weights.GetQuantizationScale(), 0);
+}
+
+TensorShape MakeShape(DataLayout dataLayout, unsigned int batches, unsigned int channels,
+                      unsigned int height, unsigned int width)
+{
+    return dataLayout == DataLayout::NHWC ? TensorShape({ batches, height, width, channels })
+                                          : TensorShape({ batches, channels, height, width });
+}
+
+struct ImageShape
+{
+    unsigned int m_Channels;
+    unsigned int m_Height;
+    unsigned int m_Width;
+};
+
+std::string ToString(const ImageShape& shape)
+{
+    return std::to_string(shape.m_Channels) + "x" + std::to_string(shape.m_Height) + "x" +
+           std::to_string(shape.m_Width);
+}
+
+FixturePtr CreateActivationFixture(const TensorShape& shape, DataType dataType)
+{
+    const TensorInfo tensorInfo = MakeTensorInfo(shape, dataType);
+    ActivationQueueDescriptor descriptor;
+    descriptor.m_Parameters.m_Function = ActivationFunction::ReLu;
+    if (!GetLayerSupport().IsActivationSupported(tensorInfo, tensorInfo, descriptor.m_Parameters, Reason()))
+    {
+        return nullptr;
+    }
+
+    auto fixture = std::make_shared<WorkloadFixture>();
+    WorkloadInfo info;
+    fixture->AddInput(descriptor, info, tensorInfo);
+    fixture->AddOutput(descriptor, info, tensorInfo);
+    fixture->SetWorkload(GetWorkloadFactory().CreateActivation(descriptor, info), tensorInfo.GetNumElements());
+    return fixture;
+}
+
+bool IsElementwiseSupported(const AdditionQueueDescriptor&, const TensorInfo& tensorInfo)
+{
+    return GetLayerSupport().IsAdditionSupported(tensorInfo, tensorInfo, tensorInfo, Reason());
+}
+
+bool IsElementwiseSupported(const MultiplicationQueueDescriptor&, const TensorInfo& tensorInfo)
+{
+    return GetLayerSupport().IsMultiplicationSupported(tensorInfo, tensorInfo, tensorInfo, Reason());
+}
+
+std::unique_ptr<IWorkload> CreateElementwise(const AdditionQueueDescriptor& descriptor, const WorkloadInfo& info)
+{
+    return GetWorkloadFactory().CreateAddition(descriptor, info);
+}
+
+std::unique_ptr<IWorkload> CreateElementwise(const MultiplicationQueueDescriptor& descriptor,
+                                             const WorkloadInfo& info)
+{
+    return GetWorkloadFactory().CreateMultiplication(descriptor, info);
+}
+
+template <typename QueueDescriptor>
+FixturePtr CreateElementwiseFixture(const TensorShape& shape, DataType dataType)
+{
+    const TensorInfo tensorInfo = MakeTensorInfo(shape, dataType);
+    QueueDescriptor descriptor;
+    if (!IsElementwiseSupported(descriptor, tensorInfo))
+    {
+        return nullptr;
+    }
+
+    auto fixture = std::make_shared<WorkloadFixture>();
+    WorkloadInfo info;
+    fixture->AddInput(descriptor, info, tensorInfo);
+    fixture->AddInput(descriptor, info, tensorInfo);
+    fixture->AddOutput(descriptor, info, tensorInfo);
+    fixture->SetWorkload(CreateElementwise(descriptor, info), tensorInfo.GetNumElements());
+    return fixture;
+}
+
+FixturePtr CreateSoftmaxFixture(unsigned int batches, unsigned int classes, DataType dataType)
+{
+    const TensorInfo tensorInfo = MakeTensorInfo(TensorShape({ batches, classes }), dataType);
+    SoftmaxQueueDescriptor descriptor;
+    descriptor.m_Parameters.m_Beta = 1.0f;
+    if (!GetLayerSupport().IsSoftmaxSupported(tensorInfo, tensorInfo, descriptor.m_Parameters, Reason()))
+    {
+        return nullptr;
+    }
+
+    auto fixture = std::make_shared<WorkloadFixture>();
+    WorkloadInfo info;
+    fixture->AddInput(descriptor, info, tensorInfo);
+    fixture->AddOutput(descriptor, info, tensorInfo);
+    fixture->SetWorkload(GetWorkloadFactory().CreateSoftmax(descriptor, info), 0.0);
+    return fixture;
+}
+
+FixturePtr CreateFullyConnectedFixture(unsigned int batches, unsigned int inputSize, unsigned int outputSize,
+                                       DataType dataType)
+{
+    const TensorInfo input   = MakeTensorInfo(TensorShape({ batches, inputSize }), dataType);
+    const TensorInfo output  = MakeTensorInfo(TensorShape({ batches, outputSize }), dataType);
+    const TensorInfo weights = MakeTensorInfo(TensorShape({ inputSize, outputSize }), dataType);
+    const TensorInfo biases  = MakeBiasInfo(TensorShape({ outputSize }), input, weights);
+
+    FullyConnectedQueueDescriptor descriptor;
+    descriptor.m_Parameters.m_BiasEnabled = true;
+    if (!GetLayerSupport().IsFullyConnectedSupported(input, output, weights, biases, descriptor.m_Parameters,
+                                                     Reason()))
+    {
+        return nullptr;
+    }
+
+    auto fixture = std::make_shared<WorkloadFixture>();
+    WorkloadInfo info;
+    fixture->AddInput(descriptor, info, input);
+    fixture->AddOutput(descriptor, info, output);
+    descriptor.m_Weight = fixture->AddTensor(weights);
+    descriptor.m_Bias = fixture->AddTensor(biases);
+    fixture->SetWorkload(GetWorkloadFactory().CreateFullyConnected(descriptor, info),
+                         2.0 * batches * inputSize * outputSize);
+    return fixture;
+}
+
+struct ConvolutionParams
+{
+    ImageShape   m_Input;
+    unsigned int m_OutputChannels;
+    unsigned int m_Kernel;
+    unsigned int m_Stride;
+};
+
+FixturePtr CreateConvolution2dFixture(const ConvolutionParams& params, DataType dataType, DataLayout dataLayout)
+{
+    const unsigned int pad = params.m_Kernel / 2;
+    const unsigned int outputHeight = (params.m_Input.m_Height + 2 * pad - params.m_Kernel) / params.m_Stride + 1;
+    const unsigned int outputWidth = (params.m_Input.m_Width + 2 * pad - params.m_Kernel) / params.m_Stride + 1;
+
+    const TensorInfo input   = MakeTensorInfo(MakeShape(dataLayout, 1, params.m_Input.m_Channels,
+                                                        params.m_Input.m_Height, params.m_Input.m_Width), dataType);
+    const TensorInfo output  = MakeTensorInfo(MakeShape(dataLayout, 1, params.m_OutputChannels,
+                                                        outputHeight, outputWidth), dataType);
+    const TensorInfo weights = MakeTensorInfo(MakeShape(dataLayout, params.m_OutputChannels,
+                                                        params.m_Input.m_Channels, params.m_Kernel, params.m_Kernel),
+                                              dataType);
+    const TensorInfo biases  = MakeBiasInfo(TensorShape({ params.m_OutputChannels }), input, weights);
+
+    Convolution2dQueueDescriptor descriptor;
+    descriptor.m_Parameters.m_PadLeft     = pad;
+    descriptor.m_Parameters.m_PadRight    = pad;
+    descriptor.m_Parameters.m_PadTop      = pad;
+    descriptor.m_Parameters.m_PadBottom   = pad;
+    descriptor.m_Parameters.m_StrideX     = params.m_Stride;
+    descriptor.m_Parameters.m_StrideY     = params.m_Stride;
+    descriptor.m_Parameters.m_BiasEnabled = true;
+    descriptor.m_Parameters.m_DataLayout  = dataLayout;
+    if (!GetLayerSupport().IsConvolution2dSupported(input, output, descriptor.m_Parameters, weights,
+                                                    Optional<TensorInfo>(biases), Reason()))
+    {
+        return nullptr;
+    }
+
+    auto fixture = std::make_shared<WorkloadFixture>();
+    WorkloadInfo info;
+    fixture->AddInput(descriptor, info, input);
+    fixture->AddOutput(descriptor, info, output);
+    descriptor.m_Weight = fixture->AddTensor(weights);
+    descriptor.m_Bias = fixture->AddTensor(biases);
+    fixture->SetWorkload(GetWorkloadFactory().CreateConvolution2d(descriptor, info),
+                         2.0 * output.GetNumElements() * params.m_Input.m_Channels * params.m_Kernel * params.m_Kernel);
+    return fixture;
+}
+
+FixturePtr CreateDepthwiseConvolution2dFixture(const ConvolutionParams& params, DataType dataType,
+                                               DataLayout dataLayout)
+{
+    const unsigned int pad = params.m_Kernel / 2;
+    const unsigned int outputHeight = (params.m_Input.m_Height + 2 * pad - params.m_Kernel) / params.m_Stride + 1;
+    const unsigned int outputWidth = (params.m_Input.m_Width + 2 * pad - params.m_Kernel) / params.m_Stride + 1;
+    const unsigned int channels = params.m_Input.m_Channels;
+
+    // The weights are [ M, C, H, W ] whatever the data layout.
+    const TensorInfo input   = MakeTensorInfo(MakeShape(dataLayout, 1, channels, params.m_Input.m_Height,
+                                                        params.m_Input.m_Width), dataType);
+    const TensorInfo output  = MakeTensorInfo(MakeShape(dataLayout, 1, channels, outputHeight, outputWidth),
+                                              dataType);
+    const TensorInfo weights = MakeTensorInfo(TensorShape({ 1, channels, params.m_Kernel, params.m_Kernel }),
+                                              dataType);
+    const TensorInfo biases  = MakeBiasInfo(TensorShape({ channels }), input, weights);
+
+    DepthwiseConvolution2dQueueDescriptor descriptor;
+    descriptor.m_Parameters.m_PadLeft     = pad;
+    descriptor.m_Parameters.m_PadRight    = pad;
+    descriptor.m_Parameters.m_PadTop      = pad;
+    descriptor.m_Parameters.m_PadBottom   = pad;
+    descriptor.m_Parameters.m_StrideX     = params.m_Stride;
+    descriptor.m_Parameters.m_StrideY     = params.m_Stride;
+    descriptor.m_Parameters.m_BiasEnabled = true;
+    descriptor.m_Parameters.m_DataLayout  = dataLayout;
+    if (!GetLayerSupport().IsDepthwiseConvolutionSupported(input, output, descriptor.m_Parameters, weights,
+                                                           Optional<TensorInfo>(biases), Reason()))
+    {
+        return nullptr;
+    }
+
+    auto fixture = std::make_shared<WorkloadFixture>();
+    WorkloadInfo info;
+    fixture->AddInput(descriptor, info, input);
+    fixture->AddOutput(descriptor, info, output);
+    descriptor.m_Weight = fixture->AddTensor(weights);
+    descriptor.m_Bias = fixture->AddTensor(biases);
+    fixture->SetWorkload(GetWorkloadFactory().CreateDepthwiseConvolution2d(descriptor, info),
+                         2.0 * output.GetNumElements() * params.m_Kernel * params.m_Kernel);
+    return fixture;
+}
+
+FixturePtr CreatePooling2dFixture(const ImageShape& shape, PoolingAlgorithm poolType, DataType dataType,
+                                  DataLayout dataLayout)
+{
+    // 3x3 pooling with a stride of 2, as found in most classification networks.
+    const unsigned int outputHeight = (shape.m_Height - 3) / 2 + 1;
+    const unsigned int outputWidth = (shape.m_Width - 3) / 2 + 1;
+
+    const TensorInfo input  = MakeTensorInfo(MakeShape(dataLayout, 1, shape.m_Channels, shape.m_Height,
+                                                       shape.m_Width), dataType);
+    const TensorInfo output = MakeTensorInfo(MakeShape(dataLayout, 1, shape.m_Channels, outputHeight, outputWidth),
+                                             dataType);
+
+    Pooling2dQueueDescriptor descriptor;
+    descriptor.m_Parameters.m_PoolType   = poolType;
+    descriptor.m_Parameters.m_PoolWidth  = 3;
+    descriptor.m_Parameters.m_PoolHeight = 3;
+    descriptor.m_Parameters.m_StrideX    = 2;
+    descriptor.m_Parameters.m_StrideY    = 2;
+    descriptor.m_Parameters.m_DataLayout = dataLayout;
+    if (!GetLayerSupport().IsPooling2dSupported(input, output, descriptor.m_Parameters, Reason()))
+    {
+        return nullptr;
+    }
+
+    auto fixture = std::make_shared<WorkloadFixture>();
+    WorkloadInfo info;
+    fixture->AddInput(descriptor, info, input);
+    fixture->AddOutput(descriptor, info, output);
+    fixture->SetWorkload(GetWorkloadFactory().CreatePooling2d(descriptor, info), 9.0 * output.GetNumElements());
+    return fixture;
+}
+
+FixturePtr CreateBatchNormalizationFixture(const ImageShape& shape, DataType dataType, DataLayout dataLayout)
+{
+    const TensorInfo tensorInfo = MakeTensorInfo(MakeShape(dataLayout, 1, shape.m_Channels, shape.m_Height,
+                                                           shape.m_Width), dataType);
+    const TensorInfo parameters = MakeTensorInfo(TensorShape({ shape.m_Channels }), dataType);
+
+    BatchNormalizationQueueDescriptor descriptor;
+    descriptor.m_Parameters.m_DataLayout = dataLayout;
+    if (!GetLayerSupport().IsBatchNormalizationSupported(tensorInfo, tensorInfo, parameters, parameters,
+                                                         parameters, parameters, descriptor.m_Parameters, Reason()))
+    {
+        return nullptr;
+    }
+
+    auto fixture = std::make_shared<WorkloadFixture>();
+    WorkloadInfo info;
+    fixture->AddInput(descriptor, info, tensorInfo);
+    fixture->AddOutput(descriptor, info, tensorInfo);
+    descriptor.m_Mean     = fixture->AddTensor(parameters);
+    descriptor.m_Variance = fixture->AddTensor(parameters);
+    descriptor.m_Beta     = fixture->AddTensor(parameters);
+    descriptor.m_Gamma    = fixture->AddTensor(parameters);
+
+    // Once folded, batch normalization is a multiply-add per element.
+    fixture->SetWorkload(GetWorkloadFactory().CreateBatchNormalization(descriptor, info),
+                         2.0 * tensorInfo.GetNumElements());
+    return fixture;
+}
+
+FixturePtr CreateResizeBilinearFixture(const ImageShape& shape, DataType dataType, DataLayout dataLayout)
+{
+    // Upscales by 2 in each dimension.
+    const TensorInfo input  = MakeTensorInfo(MakeShape(dataLayout, 1, shape.m_Channels, shape.m_Height,
+                                                       shape.m_Width), dataType);
+    const TensorInfo output = MakeTensorInfo(MakeShape(dataLayout, 1, shape.m_Channels, shape.m_Height * 2,
+                                                       shape.m_Width * 2), dataType);
+
+    ResizeBilinearQueueDescriptor descriptor;
+    descriptor.m_Parameters.m_TargetHeight = shape.m_Height * 2;
+    descriptor.m_Parameters.m_TargetWidth  = shape.m_Width * 2;
+    descriptor.m_Parameters.m_DataLayout   = dataLayout;
+    if (!GetLayerSupport().IsResizeBilinearSupported(input, output, Reason()))
+    {
+        return nullptr;
+    }
+
+    auto fixture = std::make_shared<WorkloadFixture>();
+    WorkloadInfo info;
+    fixture->AddInput(descriptor, info, input);
+    fixture->AddOutput(descriptor, info, output);
+    fixture->SetWorkload(GetWorkloadFactory().CreateResizeBilinear(descriptor, info), 0.0);
+    return fixture;
+}
+
+FixturePtr CreatePermuteFixture(const ImageShape& shape, DataType dataType)
+{
+    // NCHW to NHWC.
+    const TensorInfo input  = MakeTensorInfo(TensorShape({ 1, shape.m_Channels, shape.m_Height, shape.m_Width }),
+                                             dataType);
+    const TensorInfo output = MakeTensorInfo(TensorShape({ 1, shape.m_Height, shape.m_Width, shape.m_Channels }),
+                                             dataType);
+
+    PermuteQueueDescriptor descriptor;
+    descriptor.m_Parameters.m_DimMappings = PermutationVector({ 0, 3, 1, 2 });
+    if (!GetLayerSupport().IsPermuteSupported(input, output, descriptor.m_Parameters, Reason()))
+    {
+        return nullptr;
+    }
+
+    auto fixture = std::make_shared<WorkloadFixture>();
+    WorkloadInfo info;
+    fixture->AddInput(descriptor, info, input);
+    fixture->AddOutput(descriptor, info, output);
+    fixture->SetWorkload(GetWorkloadFactory().CreatePermute(descriptor, info), 0.0);
+    return fixture;
+}
+
+void Register(const std::string& name, DataType dataType, const FixturePtr& fixture)
+{
+    if (!fixture)
+    {
+        return;
+    }
+
+    const std::string fullName = name + "/" + GetDataTypeName(dataType);
+    benchmark::RegisterBenchmark(fullName.c_str(), [fixture](benchmark::State& state) { fixture->Run(state); });
+}
+
+void Register(const std::string& name, DataType dataType, DataLayout dataLayout, const FixturePtr& fixture)
+{
+    Register(name + "/" + GetDataLayoutName(dataLayout), dataType, fixture);
+}
+
+void RegisterBenchmarks()
+{
+    const std::vector<ImageShape> imageShapes = { { 32, 56, 56 }, { 128, 14, 14 } };
+    const std::vector<ConvolutionParams> convolutions =
+    {
+        { { 16, 56, 56 }, 16, 3, 1 },
+        { { 32, 28, 28 }, 64, 1, 1 },
+        { { 64, 14, 14 }, 64, 3, 2 },
+    };
+    const std::vector<ConvolutionParams> depthwiseConvolutions =
+    {
+        { { 32, 56, 56 }, 32, 3, 1 },
+        { { 128, 14, 14 }, 128, 3, 2 },
+    };
+
+    for (DataType dataType : g_DataTypes)
+    {
+        for (const ImageShape& shape : imageShapes)
+        {
+            const TensorShape tensorShape({ 1, shape.m_Channels, shape.m_Height, shape.m_Width });
+            Register("Activation/ReLu/" + ToString(shape), dataType, CreateActivationFixture(tensorShape, dataType));
+            Register("Addition/" + ToString(shape), dataType,
+                     CreateElementwiseFixture<AdditionQueueDescriptor>(tensorShape, dataType));
+            Register("Multiplication/" + ToString(shape), dataType,
+                     CreateElementwiseFixture<MultiplicationQueueDescriptor>(tensorShape, dataType));
+            Register("Permute/" + ToString(shape), dataType, CreatePermuteFixture(shape, dataType));
+
+            for (DataLayout dataLayout : g_DataLayouts)
+            {
+                Register("Pooling2d/Max/" + ToString(shape), dataType, dataLayout,
+                         CreatePooling2dFixture(shape, PoolingAlgorithm::Max, dataType, dataLayout));
+                Register("Pooling2d/Average/" + ToString(shape), dataType, dataLayout,
+                         CreatePooling2dFixture(shape, PoolingAlgorithm::Average, dataType, dataLayout));
+                Register("BatchNormalization/" + ToString(shape), dataType, dataLayout,
+                         CreateBatchNormalizationFixture(shape, dataType, dataLayout));
+                Register("ResizeBilinear/" + ToString(shape), dataType, dataLayout,
+                         CreateResizeBilinearFixture(shape, dataType, dataLayout));
+            }
+        }
+
+        for (const ConvolutionParams& params : convolutions)
+        {
+            const std::string name = "Convolution2d/" + ToString(params.m_Input) + "/" +
+                std::to_string(params.m_OutputChannels) + "x" + std::to_string(params.m_Kernel) + "x" +
+                std::to_string(params.m_Kernel) + "s" + std::to_string(params.m_Stride);
+            for (DataLayout dataLayout : g_DataLayouts)
+            {
+                Register(name, dataType, dataLayout, CreateConvolution2dFixture(params, dataType, dataLayout));
+            }
+        }
+
+        for (const ConvolutionParams& params : depthwiseConvolutions)
+        {
+            const std::string name = "DepthwiseConvolution2d/" + ToString(params.m_Input) + "/" +
+                std::to_string(params.m_Kernel) + "x" + std::to_string(params.m_Kernel) + "s" +
+                std::to_string(params.m_Stride);
+            for (DataLayout dataLayout : g_DataLayouts)
+            {
+                Register(name, dataType, dataLayout,
+                         CreateDepthwiseConvolution2dFixture(params, dataType, dataLayout));
+            }
+        }
+
+        Register("FullyConnected/1x1024x1001", dataType, CreateFullyConnectedFixture(1, 1024, 1001, dataType));
+        Register("FullyConnected/8x1024x1024", dataType, CreateFullyConnectedFixture(8, 1024, 1024, dataType));
+        Register("Softmax/1x1001", dataType, CreateSoftmaxFixture(1, 1001, dataType));
+        Register("Softmax/8x1001", dataType, CreateSoftmaxFixture(8, 1001, dataType));
+    }
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    RegisterBenchmarks();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,143 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/ConvImpl.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+#include <backendsCommon/WorkloadData.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(RefConvImpl)
+
+namespace
+{
+
+armnn::TensorShape MakeShape(armnn::DataLayout dataLayout,
+                             unsigned int batches,
+                             unsigned int channels,
+                             unsigned int height,
+                             unsigned int width)
+{
+    return dataLayout == armnn::DataLayout::NHWC ?
+        armnn::TensorShape({ batches, height, width, channels }) :
+        armnn::TensorShape({ batches, channels, height, width });
+}
+
+// Runs the same convolution through ConvImpl and Im2ColConvImpl and checks that the outputs are identical.
+// The shapes are chosen so that the im2col tiles are only partially filled in both dimensions.
+template<typename T, typename BiasType, typename AccumulatorType>
+void CompareIm2ColWithDirectConvolution(armnn::DataLayout dataLayout,
+                                        armnn::DataType dataType,
+                                        float valueDivisor,
+                                        float inputScale,
+                                        float filterScale,
+                                        float outputScale)
+{
+    const unsigned int batches        = 2;
+    const unsigned int inputChannels  = 29;
+    const unsigned int outputChannels = 7;
+    const unsigned int inputHeight    = 13;
+    const unsigned int inputWidth     = 11;
+    const unsigned int filterHeight   = 3;
+    const unsigned int filterWidth    = 4;
+
+    armnn::Convolution2dQueueDescriptor data;
+    data.m_Parameters.m_PadLeft     = 2;
+    data.m_Parameters.m_PadRight    = 3;
+    data.m_Parameters.m_PadTop      = 1;
+    data.m_Parameters.m_PadBottom   = 2;
+    data.m_Parameters.m_StrideX     = 2;
+    data.m_Parameters.m_StrideY     = 1;
+    data.m_Parameters.m_BiasEnabled = true;
+    data.m_Parameters.m_DataLayout  = dataLayout;
+
+    const unsigned int outputHeight = (inputHeight + 1 + 2 - filterHeight) / 1 + 1;
+    const unsigned int outputWidth  = (inputWidth + 2 + 3 - filterWidth) / 2 + 1;
+
+    armnn::TensorInfo inputInfo(MakeShape(dataLayout, batches, inputChannels, inputHeight, inputWidth),
+                                dataType, inputScale, 3);
+    armnn::TensorInfo outputInfo(MakeShape(dataLayout, batches, outputChannels, outputHeight, outputWidth),
+                                 dataType, outputScale, 5);
+    armnn::TensorInfo filterInfo(MakeShape(dataLayout, outputChannels, inputChannels, filterHeight, filterWidth),
+                                 dataType, filterScale, 4);
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> valueDist(0, 255);
+    std::uniform_int_distribution<int> biasDist(-1000, 1000);
+
+    std::vector<T> input(inputInfo.GetNumElements());
+    std::vector<T> filter(filterInfo.GetNumElements());
+    std::vector<BiasType> bias(outputChannels);
+    for (auto& value : input)
+    {
+        value = static_cast<T>(static_cast<float>(valueDist(gen)) / valueDivisor);
+    }
+    for (auto& value : filter)
+    {
+        value = static_cast<T>(static_cast<float>(valueDist(gen)) / valueDivisor);
+    }
+    for (auto& value : bias)
+    {
+        value = static_cast<BiasType>(biasDist(gen));
+    }
+
+    std::vector<T> directOutput(outputInfo.GetNumElements());
+    std::vector<T> im2colOutput(outputInfo.GetNumElements());
+
+    armnn::PassthroughCpuTensorHandle inputHandle(inputInfo, input.data());
+    armnn::PassthroughCpuTensorHandle directOutputHandle(outputInfo, directOutput.data());
+    armnn::PassthroughCpuTensorHandle im2colOutputHandle(outputInfo, im2colOutput.data());
+
+    data.m_Inputs.push_back(&inputHandle);
+    data.m_Outputs.push_back(&directOutputHandle);
+
+    armnn::ConvImpl<armnn::Convolution2dQueueDescriptor, T, BiasType, AccumulatorType>(
+        data, input.data(), inputScale, inputInfo.GetQuantizationOffset(),
+        filter.data(), filterScale, filterInfo.GetQuantizationOffset(),
+        bias.data(), outputScale, outputInfo.GetQuantizationOffset(), filterInfo);
+
+    std::vector<AccumulatorType> packedFilter;
+    armnn::PackIm2ColFilter(filter.data(), filterInfo.GetQuantizationOffset(), filterInfo, dataLayout, packedFilter);
+
+    data.m_Outputs[0] = &im2colOutputHandle;
+    armnn::Im2ColConvImpl<armnn::Convolution2dQueueDescriptor, T, BiasType, AccumulatorType>(
+        data, input.data(), inputScale, inputInfo.GetQuantizationOffset(),
+        packedFilter.data(), filterScale,
+        bias.data(), outputScale, outputInfo.GetQuantizationOffset(), filterInfo);
+
+    BOOST_TEST(directOutput == im2colOutput, boost::test_tools::per_element());
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Im2ColMatchesDirectFloat32Nchw)
+{
+    CompareIm2ColWithDirectConvolution<float, float, float>(
+        armnn::DataLayout::NCHW, armnn::DataType::Float32, 37.0f, 0.0f, 0.0f, 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(Im2ColMatchesDirectFloat32Nhwc)
+{
+    CompareIm2ColWithDirectConvolution<float, float, float>(
+        armnn::DataLayout::NHWC, armnn::DataType::Float32, 37.0f, 0.0f, 0.0f, 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(Im2ColMatchesDirectUint8Nchw)
+{
+    CompareIm2ColWithDirectConvolution<uint8_t, int32_t, int32_t>(
+        armnn::DataLayout::NCHW, armnn::DataType::QuantisedAsymm8, 1.0f, 0.5f, 0.25f, 5000.0f);
+}
+
+BOOST_AUTO_TEST_CASE(Im2ColMatchesDirectUint8Nhwc)
+{
+    CompareIm2ColWithDirectConvolution<uint8_t, int32_t, int32_t>(
+        armnn::DataLayout::NHWC, armnn::DataType::QuantisedAsymm8, 1.0f, 0.5f, 0.25f, 5000.0f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -696,4 +696,44 @@ BOOST_AUTO_TEST_CASE(CreateMergerDim3Uint8Workload)
     RefCreateMergerWorkloadTest<RefMergerUint8Workload, armnn::DataType::QuantisedAsymm8>({ 2, 3, 2, 10 }, 3);
 }
 
+BOOST_AUTO_TEST_CASE(CreateSubTensorHandleViewsContiguousRegionsOnly)
+{
+    RefWorkloadFactory factory;
+    auto parent = factory.CreateTensorHandle(TensorInfo({ 4, 6, 5 }, DataType::Float32));
+
+    // Whole rows along the outermost dimension follow each other in the parent, so they are viewed in place.
+    const unsigned int rowsOrigin[] = { 1, 0, 0 };
+    auto rows = factory.CreateSubTensorHandle(*parent, TensorShape({ 2, 6, 5 }), rowsOrigin);
+    BOOST_TEST(rows->GetParent() == parent.get());
+
+    // Other regions are interleaved with the rest of the parent, so they get a tensor of their own.
+    const unsigned int columnsOrigin[] = { 0, 2, 0 };
+    auto columns = factory.CreateSubTensorHandle(*parent, TensorShape({ 4, 3, 5 }), columnsOrigin);
+    BOOST_TEST(columns->GetParent() == nullptr);
+    BOOST_TEST(columns->GetShape() == TensorShape({ 4, 3, 5 }));
+}
+
+BOOST_AUTO_TEST_CASE(CreateMergerWorkloadPlacesContiguousInputsInOutput)
+{
+    RefWorkloadFactory factory;
+
+    // Inputs concatenated along the outermost dimension follow each other in the output, so they are views into it.
+    Graph dim0Graph;
+    auto dim0Workload =
+        CreateMergerWorkloadTest<RefMergerFloat32Workload, DataType::Float32>(factory, dim0Graph, { 4, 3, 2, 5 }, 0);
+    for (ITensorHandle* inputHandle : dim0Workload->GetData().m_Inputs)
+    {
+        BOOST_TEST(inputHandle->GetParent() == dim0Workload->GetData().m_Outputs[0]);
+    }
+
+    // Elsewhere they are interleaved, so they get tensors of their own.
+    Graph dim1Graph;
+    auto dim1Workload =
+        CreateMergerWorkloadTest<RefMergerFloat32Workload, DataType::Float32>(factory, dim1Graph, { 2, 6, 2, 5 }, 1);
+    for (ITensorHandle* inputHandle : dim1Workload->GetData().m_Inputs)
+    {
+        BOOST_TEST(inputHandle->GetParent() == nullptr);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -10,9 +10,14 @@
 #include <backendsCommon/test/MergerTestImpl.hpp>
 #include <backendsCommon/test/ArithmeticTestImpl.hpp>
 
+#include <Network.hpp>
+
 #include <boost/test/unit_test.hpp>
 #include <boost/test/execution_monitor.hpp>
 
+#include <future>
+#include <thread>
+
 BOOST_AUTO_TEST_SUITE(RefEndToEnd)
 
 std::vector<armnn::BackendId> defaultBackends = {armnn::Compute::CpuRef};
@@ -619,4 +624,979 @@ BOOST_AUTO_TEST_CASE(RefDetectionPostProcessFastNmsUint8Test)
                                                                           1.0f, 1, 0.01f, 0, 0.5f, 0);
 }
 
+BOOST_AUTO_TEST_CASE(RefImportedInputsAndOutputs)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // input -> relu -> output 0, and input -> output 1 so that an imported input and an imported output share a
+    // network tensor.
+    armnn::INetworkPtr net(INetwork::Create());
+
+    TensorInfo tensorInfo(TensorShape({ 1, 8 }), DataType::Float32);
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    IConnectableLayer* input   = net->AddInputLayer(0);
+    IConnectableLayer* relu    = net->AddActivationLayer(activationDescriptor);
+    IConnectableLayer* output0 = net->AddOutputLayer(0);
+    IConnectableLayer* output1 = net->AddOutputLayer(1);
+
+    input->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(output1->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(output0->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    relu->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    IOptimizedNetworkPtr optNet = Optimize(*net, defaultBackends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    std::vector<float> inputData(8);
+    std::vector<float> outputData0(8);
+    std::vector<float> outputData1(8);
+
+    std::vector<ImportedInputId> inputIds = runtime->ImportInputs(netId,
+        { { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } });
+    std::vector<ImportedOutputId> outputIds = runtime->ImportOutputs(netId,
+        { { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData0.data()) },
+          { 1, Tensor(runtime->GetOutputTensorInfo(netId, 1), outputData1.data()) } });
+    BOOST_TEST(inputIds.size() == 1);
+    BOOST_TEST(outputIds.size() == 2);
+
+    // The imported buffers are reused by every execution.
+    for (int run = 0; run < 3; ++run)
+    {
+        for (unsigned int i = 0; i < inputData.size(); ++i)
+        {
+            inputData[i] = static_cast<float>(run) * 10.0f + static_cast<float>(i) - 4.0f;
+        }
+
+        BOOST_TEST(runtime->EnqueueWorkload(netId, {}, {}, inputIds, outputIds) == Status::Success);
+
+        for (unsigned int i = 0; i < inputData.size(); ++i)
+        {
+            BOOST_TEST(outputData0[i] == std::max(inputData[i], 0.0f));
+            BOOST_TEST(outputData1[i] == inputData[i]);
+        }
+    }
+
+    // Imported and ordinary tensors can be mixed.
+    std::vector<float> otherOutputData1(8);
+    BOOST_TEST(runtime->EnqueueWorkload(netId,
+                                        {},
+                                        { { 1, Tensor(runtime->GetOutputTensorInfo(netId, 1),
+                                                      otherOutputData1.data()) } },
+                                        inputIds,
+                                        { outputIds[0] }) == Status::Success);
+    BOOST_TEST(otherOutputData1 == inputData, boost::test_tools::per_element());
+
+    // Ordinary executions are unaffected by what was imported.
+    std::vector<float> otherInputData(8, -1.0f);
+    std::vector<float> otherOutputData0(8, 5.0f);
+    BOOST_TEST(runtime->EnqueueWorkload(netId,
+        { { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), otherInputData.data()) } },
+        { { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), otherOutputData0.data()) },
+          { 1, Tensor(runtime->GetOutputTensorInfo(netId, 1), otherOutputData1.data()) } }) == Status::Success);
+    BOOST_TEST(otherOutputData0 == std::vector<float>(8, 0.0f), boost::test_tools::per_element());
+    BOOST_TEST(otherOutputData1 == otherInputData, boost::test_tools::per_element());
+
+    runtime->ClearImportedInputs(netId, inputIds);
+    runtime->ClearImportedOutputs(netId, outputIds);
+    BOOST_CHECK_THROW(runtime->EnqueueWorkload(netId, {}, {}, inputIds, outputIds), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(RefConcurrentExecutionWithWorkingMemHandles)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // input -> relu -> (+ constant) -> output
+    armnn::INetworkPtr net(INetwork::Create());
+
+    TensorInfo tensorInfo(TensorShape({ 1, 64 }), DataType::Float32);
+    std::vector<float> constantData(64, 0.5f);
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    IConnectableLayer* input    = net->AddInputLayer(0);
+    IConnectableLayer* relu     = net->AddActivationLayer(activationDescriptor);
+    IConnectableLayer* constant = net->AddConstantLayer(ConstTensor(tensorInfo, constantData));
+    IConnectableLayer* add      = net->AddAdditionLayer();
+    IConnectableLayer* output   = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    constant->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    relu->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    constant->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    add->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    IOptimizedNetworkPtr optNet = Optimize(*net, defaultBackends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // Each thread runs its own inputs on its own handle many times.
+    constexpr unsigned int numThreads    = 4;
+    constexpr unsigned int numIterations = 50;
+
+    std::vector<std::vector<float>> inputs(numThreads, std::vector<float>(64));
+    std::vector<std::vector<float>> outputs(numThreads, std::vector<float>(64));
+    std::vector<std::vector<float>> expectedOutputs(numThreads, std::vector<float>(64));
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        for (unsigned int i = 0; i < 64; ++i)
+        {
+            inputs[t][i] = static_cast<float>(t * 64 + i) - 100.0f;
+        }
+
+        // The reference results come from the ordinary execution path.
+        InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputs[t].data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), expectedOutputs[t].data()) } };
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    }
+
+    std::vector<std::unique_ptr<IWorkingMemHandle>> handles;
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        handles.push_back(runtime->CreateWorkingMemHandle(netId));
+        BOOST_TEST(handles.back()->GetNetworkId() == netId);
+        BOOST_TEST(!handles.back()->IsAllocated());
+    }
+
+    std::vector<Status> results(numThreads, Status::Success);
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputs[t].data()) } };
+            OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputs[t].data()) } };
+            for (unsigned int i = 0; i < numIterations && results[t] == Status::Success; ++i)
+            {
+                results[t] = runtime->Execute(*handles[t], inputTensors, outputTensors);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        BOOST_TEST(results[t] == Status::Success);
+        BOOST_TEST(handles[t]->IsAllocated());
+        BOOST_TEST(outputs[t] == expectedOutputs[t], boost::test_tools::per_element());
+    }
+
+    handles[0]->Free();
+    BOOST_TEST(!handles[0]->IsAllocated());
+}
+
+BOOST_AUTO_TEST_CASE(RefMultiThreadedKernelsMatchSingleThreaded)
+{
+    using namespace armnn;
+
+    // input -> conv -> (conv + conv) -> average pool -> reshape -> fully connected -> softmax -> output,
+    // with tensors large enough for every kernel to be shared out between threads.
+    auto Fill = [](std::vector<float>& data, unsigned int seed)
+    {
+        for (float& value : data)
+        {
+            seed = seed * 1103515245u + 12345u;
+            value = static_cast<float>((seed >> 16) % 2001u) / 1000.0f - 1.0f;
+        }
+    };
+
+    TensorInfo inputInfo({ 4, 8, 32, 32 }, DataType::Float32);
+    TensorInfo convWeightsInfo({ 32, 8, 3, 3 }, DataType::Float32);
+    TensorInfo convBiasInfo({ 32 }, DataType::Float32);
+    TensorInfo convOutputInfo({ 4, 32, 30, 30 }, DataType::Float32);
+    TensorInfo poolOutputInfo({ 4, 32, 15, 15 }, DataType::Float32);
+    TensorInfo reshapeOutputInfo({ 4, 32 * 15 * 15 }, DataType::Float32);
+    TensorInfo fcWeightsInfo({ 32 * 15 * 15, 64 }, DataType::Float32);
+    TensorInfo fcBiasInfo({ 64 }, DataType::Float32);
+    TensorInfo outputInfo({ 4, 64 }, DataType::Float32);
+
+    std::vector<float> inputData(inputInfo.GetNumElements());
+    std::vector<float> convWeights(convWeightsInfo.GetNumElements());
+    std::vector<float> convBias(convBiasInfo.GetNumElements());
+    std::vector<float> fcWeights(fcWeightsInfo.GetNumElements());
+    std::vector<float> fcBias(fcBiasInfo.GetNumElements());
+    Fill(inputData, 1);
+    Fill(convWeights, 2);
+    Fill(convBias, 3);
+    Fill(fcWeights, 4);
+    Fill(fcBias, 5);
+
+    auto Run = [&](unsigned int numThreads)
+    {
+        IRuntime::CreationOptions options;
+        options.m_NumThreads = numThreads;
+        IRuntimePtr runtime(IRuntime::Create(options));
+
+        INetworkPtr net(INetwork::Create());
+
+        Convolution2dDescriptor convDescriptor;
+        convDescriptor.m_StrideX     = 1;
+        convDescriptor.m_StrideY     = 1;
+        convDescriptor.m_BiasEnabled = true;
+
+        Pooling2dDescriptor poolDescriptor;
+        poolDescriptor.m_PoolType   = PoolingAlgorithm::Average;
+        poolDescriptor.m_PoolWidth  = 2;
+        poolDescriptor.m_PoolHeight = 2;
+        poolDescriptor.m_StrideX    = 2;
+        poolDescriptor.m_StrideY    = 2;
+
+        ReshapeDescriptor reshapeDescriptor;
+        reshapeDescriptor.m_TargetShape = reshapeOutputInfo.GetShape();
+
+        FullyConnectedDescriptor fcDescriptor;
+        fcDescriptor.m_BiasEnabled = true;
+
+        const Optional<ConstTensor> convBiasTensor(ConstTensor(convBiasInfo, convBias));
+        const Optional<ConstTensor> fcBiasTensor(ConstTensor(fcBiasInfo, fcBias));
+
+        IConnectableLayer* input   = net->AddInputLayer(0);
+        IConnectableLayer* conv    = net->AddConvolution2dLayer(convDescriptor,
+                                                                ConstTensor(convWeightsInfo, convWeights),
+                                                                convBiasTensor);
+        IConnectableLayer* add     = net->AddAdditionLayer();
+        IConnectableLayer* pool    = net->AddPooling2dLayer(poolDescriptor);
+        IConnectableLayer* reshape = net->AddReshapeLayer(reshapeDescriptor);
+        IConnectableLayer* fc      = net->AddFullyConnectedLayer(fcDescriptor,
+                                                                 ConstTensor(fcWeightsInfo, fcWeights),
+                                                                 fcBiasTensor);
+        IConnectableLayer* softmax = net->AddSoftmaxLayer(SoftmaxDescriptor());
+        IConnectableLayer* output  = net->AddOutputLayer(0);
+
+        input->GetOutputSlot(0).Connect(conv->GetInputSlot(0));
+        conv->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+        conv->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+        add->GetOutputSlot(0).Connect(pool->GetInputSlot(0));
+        pool->GetOutputSlot(0).Connect(reshape->GetInputSlot(0));
+        reshape->GetOutputSlot(0).Connect(fc->GetInputSlot(0));
+        fc->GetOutputSlot(0).Connect(softmax->GetInputSlot(0));
+        softmax->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+        input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+        conv->GetOutputSlot(0).SetTensorInfo(convOutputInfo);
+        add->GetOutputSlot(0).SetTensorInfo(convOutputInfo);
+        pool->GetOutputSlot(0).SetTensorInfo(poolOutputInfo);
+        reshape->GetOutputSlot(0).SetTensorInfo(reshapeOutputInfo);
+        fc->GetOutputSlot(0).SetTensorInfo(outputInfo);
+        softmax->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+        IOptimizedNetworkPtr optNet = Optimize(*net, defaultBackends, runtime->GetDeviceSpec());
+
+        NetworkId netId;
+        BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+        std::vector<float> outputData(outputInfo.GetNumElements());
+        InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        return outputData;
+    };
+
+    const std::vector<float> singleThreaded = Run(1);
+    const std::vector<float> multiThreaded  = Run(4);
+
+    // Each output element is computed by one thread in the same order, so the results are bit exact.
+    BOOST_TEST(multiThreaded == singleThreaded, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RefInterOpParallelExecutionMatchesSerial)
+{
+    using namespace armnn;
+
+    // An inception style block: four branches reading the input, concatenated along the channels.
+    TensorInfo inputInfo({ 1, 2, 8, 8 }, DataType::Float32);
+    TensorInfo weightsInfo({ 2, 2, 1, 1 }, DataType::Float32);
+    TensorInfo outputInfo({ 1, 8, 8, 8 }, DataType::Float32);
+
+    std::vector<float> weights = { 0.5f, -1.0f, 2.0f, 0.25f };
+    std::vector<float> inputData(inputInfo.GetNumElements());
+    for (unsigned int i = 0; i < inputData.size(); ++i)
+    {
+        inputData[i] = static_cast<float>(i % 13) - 6.0f;
+    }
+
+    auto Run = [&](bool enableInterOpParallelism, bool useWorkingMemHandle)
+    {
+        IRuntime::CreationOptions options;
+        options.m_NumThreads = 4;
+        options.m_EnableInterOpParallelism = enableInterOpParallelism;
+        IRuntimePtr runtime(IRuntime::Create(options));
+
+        INetworkPtr net(INetwork::Create());
+
+        ActivationDescriptor reluDescriptor;
+        reluDescriptor.m_Function = ActivationFunction::ReLu;
+
+        ActivationDescriptor tanhDescriptor;
+        tanhDescriptor.m_Function = ActivationFunction::TanH;
+        tanhDescriptor.m_A = 1.0f;
+        tanhDescriptor.m_B = 1.0f;
+
+        Pooling2dDescriptor poolDescriptor;
+        poolDescriptor.m_PoolType   = PoolingAlgorithm::Max;
+        poolDescriptor.m_PoolWidth  = 3;
+        poolDescriptor.m_PoolHeight = 3;
+        poolDescriptor.m_StrideX    = 1;
+        poolDescriptor.m_StrideY    = 1;
+        poolDescriptor.m_PadLeft    = 1;
+        poolDescriptor.m_PadRight   = 1;
+        poolDescriptor.m_PadTop     = 1;
+        poolDescriptor.m_PadBottom  = 1;
+
+        Convolution2dDescriptor convDescriptor;
+        convDescriptor.m_StrideX = 1;
+        convDescriptor.m_StrideY = 1;
+
+        std::vector<TensorShape> branchShapes(4, inputInfo.GetShape());
+        OriginsDescriptor mergerDescriptor =
+            CreateMergerDescriptorForConcatenation(branchShapes.begin(), branchShapes.end(), 1);
+
+        IConnectableLayer* input  = net->AddInputLayer(0);
+        IConnectableLayer* relu   = net->AddActivationLayer(reluDescriptor);
+        IConnectableLayer* tanh   = net->AddActivationLayer(tanhDescriptor);
+        IConnectableLayer* pool   = net->AddPooling2dLayer(poolDescriptor);
+        IConnectableLayer* conv   = net->AddConvolution2dLayer(convDescriptor,
+                                                               ConstTensor(weightsInfo, weights),
+                                                               EmptyOptional());
+        IConnectableLayer* merger = net->AddMergerLayer(mergerDescriptor);
+        IConnectableLayer* output = net->AddOutputLayer(0);
+
+        input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+        unsigned int branchIndex = 0;
+        for (IConnectableLayer* branch : { relu, tanh, pool, conv })
+        {
+            input->GetOutputSlot(0).Connect(branch->GetInputSlot(0));
+            branch->GetOutputSlot(0).Connect(merger->GetInputSlot(branchIndex++));
+            branch->GetOutputSlot(0).SetTensorInfo(inputInfo);
+        }
+        merger->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+        merger->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+        IOptimizedNetworkPtr optNet = Optimize(*net, defaultBackends, runtime->GetDeviceSpec());
+
+        NetworkId netId;
+        BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+        std::vector<float> outputData(outputInfo.GetNumElements());
+        InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+        for (int i = 0; i < 10; ++i)
+        {
+            if (useWorkingMemHandle)
+            {
+                auto workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+                BOOST_TEST(runtime->Execute(*workingMemHandle, inputTensors, outputTensors) == Status::Success);
+            }
+            else
+            {
+                BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+            }
+        }
+        return outputData;
+    };
+
+    const std::vector<float> serial = Run(false, false);
+    BOOST_TEST(Run(true, false) == serial, boost::test_tools::per_element());
+    BOOST_TEST(Run(true, true) == serial, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RefFusedConvolutionBatchNormActivation)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    TensorInfo inputInfo({ 1, 1, 2, 2 }, DataType::Float32);
+    TensorInfo outputInfo({ 1, 2, 2, 2 }, DataType::Float32);
+    TensorInfo weightsInfo({ 2, 1, 1, 1 }, DataType::Float32);
+    TensorInfo channelInfo({ 2 }, DataType::Float32);
+
+    std::vector<float> weights  = { 1.0f, -1.0f };
+    std::vector<float> bias     = { 0.5f, 0.0f };
+    std::vector<float> mean     = { 0.0f, 0.0f };
+    std::vector<float> variance = { 1.0f, 1.0f };
+    std::vector<float> beta     = { 0.0f, -1.0f };
+    std::vector<float> gamma    = { 2.0f, 1.0f };
+
+    Convolution2dDescriptor convDescriptor;
+    convDescriptor.m_StrideX     = 1;
+    convDescriptor.m_StrideY     = 1;
+    convDescriptor.m_BiasEnabled = true;
+
+    BatchNormalizationDescriptor batchNormDescriptor;
+    batchNormDescriptor.m_Eps = 0.0f;
+
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+
+    INetworkPtr net(INetwork::Create());
+    Optional<ConstTensor> biasTensor(ConstTensor(channelInfo, bias));
+    IConnectableLayer* input     = net->AddInputLayer(0);
+    IConnectableLayer* conv      = net->AddConvolution2dLayer(convDescriptor, ConstTensor(weightsInfo, weights),
+                                                              biasTensor);
+    IConnectableLayer* batchNorm = net->AddBatchNormalizationLayer(batchNormDescriptor,
+                                                                   ConstTensor(channelInfo, mean),
+                                                                   ConstTensor(channelInfo, variance),
+                                                                   ConstTensor(channelInfo, beta),
+                                                                   ConstTensor(channelInfo, gamma));
+    IConnectableLayer* relu      = net->AddActivationLayer(reluDescriptor);
+    IConnectableLayer* output    = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(conv->GetInputSlot(0));
+    conv->GetOutputSlot(0).Connect(batchNorm->GetInputSlot(0));
+    batchNorm->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    conv->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    batchNorm->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    relu->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    // The three layers are run as a single convolution with a fused activation.
+    IOptimizedNetworkPtr optNet = Optimize(*net, defaultBackends, runtime->GetDeviceSpec());
+    BOOST_TEST(static_cast<OptimizedNetwork*>(optNet.get())->GetGraph().GetNumLayers() == 3);
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    std::vector<float> inputData  = { -2.0f, -1.0f, 1.0f, 2.0f };
+    std::vector<float> outputData(outputInfo.GetNumElements());
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+
+    // relu(2 * (x + 0.5)) and relu(-x - 1).
+    std::vector<float> expectedOutput = { 0.0f, 0.0f, 3.0f, 5.0f, 1.0f, 0.0f, 0.0f, 0.0f };
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RefExportedNetworkLoadsWithoutOptimization)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    TensorInfo inputInfo({ 1, 4 }, DataType::Float32);
+    TensorInfo outputInfo({ 1, 2 }, DataType::Float32);
+    TensorInfo weightsInfo({ 4, 2 }, DataType::Float32);
+
+    std::vector<float> weights = { 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f };
+
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input  = net->AddInputLayer(0);
+    IConnectableLayer* fc     = net->AddFullyConnectedLayer(FullyConnectedDescriptor(),
+                                                            ConstTensor(weightsInfo, weights),
+                                                            EmptyOptional());
+    IConnectableLayer* relu   = net->AddActivationLayer(reluDescriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(fc->GetInputSlot(0));
+    fc->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    fc->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    relu->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    IOptimizedNetworkPtr optNet = Optimize(*net, defaultBackends, runtime->GetDeviceSpec());
+    BOOST_TEST(static_cast<OptimizedNetwork*>(optNet.get())->GetGraph().GetNumLayers() == 3);
+
+    // The fused activation is exported as a layer of its own, and every layer keeps its backend.
+    INetworkPtr exported = optNet->ExportNetwork();
+    const Graph& exportedGraph = static_cast<Network*>(exported.get())->GetGraph();
+    BOOST_TEST(exportedGraph.GetNumLayers() == 4);
+    for (auto&& layer : exportedGraph)
+    {
+        BOOST_TEST((layer->GetBackendId() == BackendId(Compute::CpuRef)));
+    }
+
+    // Importing fuses the activation again.
+    IOptimizedNetworkPtr imported = ImportOptimizedNetwork(*exported, runtime->GetDeviceSpec());
+    BOOST_TEST(static_cast<OptimizedNetwork*>(imported.get())->GetGraph().GetNumLayers() == 3);
+
+    std::string errorMessage;
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, *exported, errorMessage) == Status::Success);
+
+    std::vector<float> inputData  = { 1.0f, 2.0f, 3.0f, 4.0f };
+    std::vector<float> outputData(outputInfo.GetNumElements());
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+
+    std::vector<float> expectedOutput = { 10.0f, 0.0f };
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+
+    // A network whose layers are not assigned to backends cannot be imported.
+    BOOST_TEST(runtime->LoadNetwork(netId, *net, errorMessage) == Status::Failure);
+    BOOST_TEST(!errorMessage.empty());
+}
+
+BOOST_AUTO_TEST_CASE(RefDynamicBatchEnqueueWorkload)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    options.m_EnableDynamicBatch = true;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // Convolution, then flattened into a fully connected layer, as found at the end of classification networks.
+    TensorInfo inputInfo({ 1, 2, 3, 3 }, DataType::Float32);
+    TensorInfo convInfo({ 1, 2, 3, 3 }, DataType::Float32);
+    TensorInfo flatInfo({ 1, 18 }, DataType::Float32);
+    TensorInfo outputInfo({ 1, 3 }, DataType::Float32);
+    TensorInfo convWeightsInfo({ 2, 2, 1, 1 }, DataType::Float32);
+    TensorInfo fcWeightsInfo({ 18, 3 }, DataType::Float32);
+
+    std::vector<float> convWeights = { 0.5f, -1.0f, 2.0f, 0.25f };
+    std::vector<float> fcWeights(fcWeightsInfo.GetNumElements());
+    for (unsigned int i = 0; i < fcWeights.size(); ++i)
+    {
+        fcWeights[i] = static_cast<float>(i % 7) * 0.125f - 0.375f;
+    }
+
+    Convolution2dDescriptor convDescriptor;
+    convDescriptor.m_StrideX = 1;
+    convDescriptor.m_StrideY = 1;
+
+    ReshapeDescriptor reshapeDescriptor;
+    reshapeDescriptor.m_TargetShape = flatInfo.GetShape();
+
+    SoftmaxDescriptor softmaxDescriptor;
+    softmaxDescriptor.m_Beta = 1.0f;
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input   = net->AddInputLayer(0);
+    IConnectableLayer* conv    = net->AddConvolution2dLayer(convDescriptor,
+                                                            ConstTensor(convWeightsInfo, convWeights),
+                                                            EmptyOptional());
+    IConnectableLayer* reshape = net->AddReshapeLayer(reshapeDescriptor);
+    IConnectableLayer* fc      = net->AddFullyConnectedLayer(FullyConnectedDescriptor(),
+                                                             ConstTensor(fcWeightsInfo, fcWeights),
+                                                             EmptyOptional());
+    IConnectableLayer* softmax = net->AddSoftmaxLayer(softmaxDescriptor);
+    IConnectableLayer* output  = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(conv->GetInputSlot(0));
+    conv->GetOutputSlot(0).Connect(reshape->GetInputSlot(0));
+    reshape->GetOutputSlot(0).Connect(fc->GetInputSlot(0));
+    fc->GetOutputSlot(0).Connect(softmax->GetInputSlot(0));
+    softmax->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    conv->GetOutputSlot(0).SetTensorInfo(convInfo);
+    reshape->GetOutputSlot(0).SetTensorInfo(flatInfo);
+    fc->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    softmax->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    IOptimizedNetworkPtr optNet = Optimize(*net, defaultBackends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    auto Run = [&](unsigned int batchSize, const std::vector<float>& inputData)
+    {
+        TensorInfo batchInputInfo = inputInfo;
+        batchInputInfo.SetShape({ batchSize, 2, 3, 3 });
+        TensorInfo batchOutputInfo = outputInfo;
+        batchOutputInfo.SetShape({ batchSize, 3 });
+
+        std::vector<float> outputData(batchOutputInfo.GetNumElements());
+        InputTensors inputTensors{ { 0, ConstTensor(batchInputInfo, inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(batchOutputInfo, outputData.data()) } };
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        return outputData;
+    };
+
+    const unsigned int batchSize = 3;
+    std::vector<float> batchInputData(batchSize * inputInfo.GetNumElements());
+    for (unsigned int i = 0; i < batchInputData.size(); ++i)
+    {
+        batchInputData[i] = static_cast<float>(i % 11) - 5.0f;
+    }
+
+    // Each item of a batch gives the same result as when run on its own, at the batch size the network was
+    // optimized for, including after the network for the larger batch has been prepared.
+    const std::vector<float> batchOutputData = Run(batchSize, batchInputData);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (unsigned int i = 0; i < batchSize; ++i)
+        {
+            const auto itemBegin = batchInputData.begin() + i * inputInfo.GetNumElements();
+            const std::vector<float> itemOutputData =
+                Run(1, std::vector<float>(itemBegin, itemBegin + inputInfo.GetNumElements()));
+
+            const std::vector<float> batchItemOutputData(batchOutputData.begin() + i * 3,
+                                                         batchOutputData.begin() + (i + 1) * 3);
+            BOOST_TEST(batchItemOutputData == itemOutputData, boost::test_tools::per_element());
+        }
+        BOOST_TEST(Run(batchSize, batchInputData) == batchOutputData, boost::test_tools::per_element());
+    }
+
+    // Inputs differing in other dimensions than the batch are still rejected.
+    std::vector<float> wrongInputData(2 * 2 * 4 * 3);
+    std::vector<float> outputData(2 * 3);
+    InputTensors wrongInputTensors{ { 0, ConstTensor(TensorInfo({ 2, 2, 4, 3 }, DataType::Float32),
+                                                     wrongInputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(TensorInfo({ 2, 3 }, DataType::Float32), outputData.data()) } };
+    BOOST_CHECK_THROW(runtime->EnqueueWorkload(netId, wrongInputTensors, outputTensors), InvalidArgumentException);
+
+    // Only the networks of the 8 most recently used batch sizes are kept.
+    std::shared_ptr<IProfiler> profiler = runtime->GetProfiler(netId);
+    profiler->EnableProfiling(true);
+    profiler->EnableRingBufferProfiling(1024);
+    auto GetNumPreparedNetworks = [&]()
+    {
+        for (const EventStatistics& statistics : profiler->GetEventStatistics())
+        {
+            if (statistics.m_Name == "PrepareBatchNetwork")
+            {
+                return statistics.m_Count;
+            }
+        }
+        return 0u;
+    };
+    auto RunBatch = [&](unsigned int size)
+    {
+        Run(size, std::vector<float>(size * inputInfo.GetNumElements(), 1.0f));
+    };
+
+    for (unsigned int size = 2; size <= 10; ++size)
+    {
+        RunBatch(size);
+    }
+    BOOST_TEST(GetNumPreparedNetworks() == 8);
+    RunBatch(3);
+    RunBatch(10);
+    BOOST_TEST(GetNumPreparedNetworks() == 8);
+    RunBatch(2);
+    BOOST_TEST(GetNumPreparedNetworks() == 9);
+}
+
+BOOST_AUTO_TEST_CASE(RefEnqueueWorkloadAsyncCoalescesRequests)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    options.m_EnableDynamicBatch = true;
+    options.m_MaxBatchSize = 4;
+    options.m_BatchTimeoutUs = 100000;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    TensorInfo inputInfo({ 1, 4 }, DataType::Float32);
+    TensorInfo outputInfo({ 1, 2 }, DataType::Float32);
+    TensorInfo weightsInfo({ 4, 2 }, DataType::Float32);
+    std::vector<float> weights = { 1.0f, -1.0f, 2.0f, 0.5f, -1.0f, 1.0f, 0.25f, 3.0f };
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input  = net->AddInputLayer(0);
+    IConnectableLayer* fc     = net->AddFullyConnectedLayer(FullyConnectedDescriptor(),
+                                                            ConstTensor(weightsInfo, weights),
+                                                            EmptyOptional());
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(fc->GetInputSlot(0));
+    fc->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    fc->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    IOptimizedNetworkPtr optNet = Optimize(*net, defaultBackends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // The ring buffer records the events of the thread evaluating the requests.
+    std::shared_ptr<IProfiler> profiler = runtime->GetProfiler(netId);
+    profiler->EnableProfiling(true);
+    profiler->EnableRingBufferProfiling(256);
+
+    const unsigned int numRequests = 8;
+    std::vector<std::vector<float>> inputData(numRequests);
+    std::vector<std::vector<float>> outputData(numRequests, std::vector<float>(2));
+    std::vector<std::future<Status>> results;
+    for (unsigned int i = 0; i < numRequests; ++i)
+    {
+        inputData[i] = { static_cast<float>(i), 1.0f, -2.0f, static_cast<float>(i) * 0.5f };
+        results.push_back(runtime->EnqueueWorkloadAsync(netId,
+                                                        { { 0, ConstTensor(inputInfo, inputData[i].data()) } },
+                                                        { { 0, Tensor(outputInfo, outputData[i].data()) } }));
+    }
+
+    std::promise<Status> callbackStatus;
+    std::vector<float> callbackOutputData(2);
+    runtime->EnqueueWorkloadAsync(netId,
+                                  { { 0, ConstTensor(inputInfo, inputData[0].data()) } },
+                                  { { 0, Tensor(outputInfo, callbackOutputData.data()) } },
+                                  [&callbackStatus](Status status) { callbackStatus.set_value(status); });
+
+    for (auto& result : results)
+    {
+        BOOST_TEST((result.get() == Status::Success));
+    }
+    BOOST_TEST((callbackStatus.get_future().get() == Status::Success));
+
+    // The 9 requests are evaluated in 3 batches, of 4, 4 and 1.
+    unsigned int numExecutions = 0;
+    for (const EventStatistics& statistics : profiler->GetEventStatistics())
+    {
+        if (statistics.m_Name == "EnqueueWorkload")
+        {
+            numExecutions = statistics.m_Count;
+        }
+    }
+    BOOST_TEST(numExecutions == 3);
+
+    for (unsigned int i = 0; i < numRequests; ++i)
+    {
+        std::vector<float> expectedOutputData(2, 0.0f);
+        for (unsigned int j = 0; j < 4; ++j)
+        {
+            expectedOutputData[0] += inputData[i][j] * weights[j * 2];
+            expectedOutputData[1] += inputData[i][j] * weights[j * 2 + 1];
+        }
+        BOOST_TEST(outputData[i] == expectedOutputData, boost::test_tools::per_element());
+    }
+    BOOST_TEST(callbackOutputData == outputData[0], boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RefStatefulLstmSequence)
+{
+    using namespace armnn;
+
+    // Dynamic batch is enabled to check that it does not apply to stateful sequences.
+    IRuntime::CreationOptions options;
+    options.m_EnableDynamicBatch = true;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    const unsigned int numInputs = 2;
+    const unsigned int numUnits  = 3;
+
+    TensorInfo inputWeightsInfo({ numUnits, numInputs }, DataType::Float32);
+    TensorInfo recurrentWeightsInfo({ numUnits, numUnits }, DataType::Float32);
+    TensorInfo biasInfo({ numUnits }, DataType::Float32);
+
+    auto MakeValues = [](unsigned int numElements, float offset)
+    {
+        std::vector<float> values(numElements);
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            values[i] = static_cast<float>(i % 5) * 0.25f - offset;
+        }
+        return values;
+    };
+    const std::vector<float> inputToForget    = MakeValues(inputWeightsInfo.GetNumElements(), 0.5f);
+    const std::vector<float> inputToCell      = MakeValues(inputWeightsInfo.GetNumElements(), 0.25f);
+    const std::vector<float> inputToOutput    = MakeValues(inputWeightsInfo.GetNumElements(), 0.375f);
+    const std::vector<float> recurrentToForget = MakeValues(recurrentWeightsInfo.GetNumElements(), 0.125f);
+    const std::vector<float> recurrentToCell   = MakeValues(recurrentWeightsInfo.GetNumElements(), 0.5f);
+    const std::vector<float> recurrentToOutput = MakeValues(recurrentWeightsInfo.GetNumElements(), 0.25f);
+    const std::vector<float> forgetBias = { 1.0f, 1.0f, 1.0f };
+    const std::vector<float> cellBias   = { 0.0f, 0.125f, -0.125f };
+    const std::vector<float> outputBias = { 0.25f, 0.0f, -0.25f };
+
+    const ConstTensor inputToForgetTensor(inputWeightsInfo, inputToForget);
+    const ConstTensor inputToCellTensor(inputWeightsInfo, inputToCell);
+    const ConstTensor inputToOutputTensor(inputWeightsInfo, inputToOutput);
+    const ConstTensor recurrentToForgetTensor(recurrentWeightsInfo, recurrentToForget);
+    const ConstTensor recurrentToCellTensor(recurrentWeightsInfo, recurrentToCell);
+    const ConstTensor recurrentToOutputTensor(recurrentWeightsInfo, recurrentToOutput);
+    const ConstTensor forgetBiasTensor(biasInfo, forgetBias);
+    const ConstTensor cellBiasTensor(biasInfo, cellBias);
+    const ConstTensor outputBiasTensor(biasInfo, outputBias);
+
+    LstmInputParams params;
+    params.m_InputToForgetWeights     = &inputToForgetTensor;
+    params.m_InputToCellWeights       = &inputToCellTensor;
+    params.m_InputToOutputWeights     = &inputToOutputTensor;
+    params.m_RecurrentToForgetWeights = &recurrentToForgetTensor;
+    params.m_RecurrentToCellWeights   = &recurrentToCellTensor;
+    params.m_RecurrentToOutputWeights = &recurrentToOutputTensor;
+    params.m_ForgetGateBias           = &forgetBiasTensor;
+    params.m_CellBias                 = &cellBiasTensor;
+    params.m_OutputGateBias           = &outputBiasTensor;
+
+    // Loads an LSTM whose input has the given shape, with its state as inputs 1 and 2 and outputs 1 and 2.
+    auto LoadLstm = [&](bool statefulSequence, const TensorShape& inputShape, const TensorShape& outputShape)
+    {
+        LstmDescriptor descriptor;
+        descriptor.m_ActivationFunc = 4;
+        descriptor.m_StatefulSequence = statefulSequence;
+
+        INetworkPtr net(INetwork::Create());
+        IConnectableLayer* input          = net->AddInputLayer(0);
+        IConnectableLayer* outputStateIn  = net->AddInputLayer(1);
+        IConnectableLayer* cellStateIn    = net->AddInputLayer(2);
+        IConnectableLayer* lstm           = net->AddLstmLayer(descriptor, params);
+        IConnectableLayer* output         = net->AddOutputLayer(0);
+        IConnectableLayer* outputStateOut = net->AddOutputLayer(1);
+        IConnectableLayer* cellStateOut   = net->AddOutputLayer(2);
+
+        input->GetOutputSlot(0).Connect(lstm->GetInputSlot(0));
+        outputStateIn->GetOutputSlot(0).Connect(lstm->GetInputSlot(1));
+        cellStateIn->GetOutputSlot(0).Connect(lstm->GetInputSlot(2));
+        lstm->GetOutputSlot(1).Connect(outputStateOut->GetInputSlot(0));
+        lstm->GetOutputSlot(2).Connect(cellStateOut->GetInputSlot(0));
+        lstm->GetOutputSlot(3).Connect(output->GetInputSlot(0));
+
+        const TensorInfo stateInfo({ 1, numUnits }, DataType::Float32);
+        input->GetOutputSlot(0).SetTensorInfo(TensorInfo(inputShape, DataType::Float32));
+        outputStateIn->GetOutputSlot(0).SetTensorInfo(stateInfo);
+        cellStateIn->GetOutputSlot(0).SetTensorInfo(stateInfo);
+        lstm->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, numUnits * 3 }, DataType::Float32));
+        lstm->GetOutputSlot(1).SetTensorInfo(stateInfo);
+        lstm->GetOutputSlot(2).SetTensorInfo(stateInfo);
+        lstm->GetOutputSlot(3).SetTensorInfo(TensorInfo(outputShape, DataType::Float32));
+
+        NetworkId netId;
+        BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*net, defaultBackends, runtime->GetDeviceSpec()))
+                   == Status::Success);
+        return netId;
+    };
+
+    const unsigned int numSteps = 4;
+    const std::vector<float> inputData = { 0.5f, -1.0f, 1.5f, 0.25f, -0.75f, 2.0f, 1.0f, -0.5f };
+    const std::vector<float> initialState(numUnits, 0.0f);
+
+    // Runs the network once, with the given working memory if any. The state is read from, and written back to, the
+    // given vectors.
+    auto Run = [&](NetworkId netId, const float* stepsData, std::vector<float>& outputState,
+                   std::vector<float>& cellState, IWorkingMemHandle* workingMemHandle = nullptr)
+    {
+        std::vector<float> outputData(runtime->GetOutputTensorInfo(netId, 0).GetNumElements());
+        const std::vector<float> outputStateIn = outputState;
+        const std::vector<float> cellStateIn = cellState;
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), stepsData) },
+            { 1, ConstTensor(runtime->GetInputTensorInfo(netId, 1), outputStateIn.data()) },
+            { 2, ConstTensor(runtime->GetInputTensorInfo(netId, 2), cellStateIn.data()) }
+        };
+        OutputTensors outputTensors
+        {
+            { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) },
+            { 1, Tensor(runtime->GetOutputTensorInfo(netId, 1), outputState.data()) },
+            { 2, Tensor(runtime->GetOutputTensorInfo(netId, 2), cellState.data()) }
+        };
+        if (workingMemHandle)
+        {
+            BOOST_TEST(runtime->Execute(*workingMemHandle, inputTensors, outputTensors) == Status::Success);
+        }
+        else
+        {
+            BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        }
+        return outputData;
+    };
+
+    // One step per call, the state going through the caller.
+    NetworkId stepNetId = LoadLstm(false, { 1, numInputs }, { 1, numUnits });
+    std::vector<float> expectedOutputData;
+    std::vector<float> expectedOutputState = initialState;
+    std::vector<float> expectedCellState = initialState;
+    for (unsigned int t = 0; t < numSteps; ++t)
+    {
+        const std::vector<float> stepOutputData =
+            Run(stepNetId, inputData.data() + t * numInputs, expectedOutputState, expectedCellState);
+        expectedOutputData.insert(expectedOutputData.end(), stepOutputData.begin(), stepOutputData.end());
+    }
+
+    // Two steps per call, the state staying in the network between the calls. The state inputs are only read by the
+    // first call.
+    NetworkId sequenceNetId = LoadLstm(true, { 2, 1, numInputs }, { 2, 1, numUnits });
+    std::vector<float> outputState = initialState;
+    std::vector<float> cellState = initialState;
+    std::vector<float> outputData = Run(sequenceNetId, inputData.data(), outputState, cellState);
+    std::vector<float> finalOutputState(numUnits, 10.0f);
+    std::vector<float> finalCellState(numUnits, 10.0f);
+    const std::vector<float> secondOutputData =
+        Run(sequenceNetId, inputData.data() + 2 * numInputs, finalOutputState, finalCellState);
+    outputData.insert(outputData.end(), secondOutputData.begin(), secondOutputData.end());
+
+    const auto tolerance = boost::test_tools::tolerance(1e-5f);
+    BOOST_TEST(outputData == expectedOutputData, tolerance << boost::test_tools::per_element());
+    BOOST_TEST(finalOutputState == expectedOutputState, tolerance << boost::test_tools::per_element());
+    BOOST_TEST(finalCellState == expectedCellState, tolerance << boost::test_tools::per_element());
+
+    // Once reset, the sequence starts again from the state inputs.
+    runtime->ResetNetworkState(sequenceNetId);
+    outputState = initialState;
+    cellState = initialState;
+    const std::vector<float> restartedOutputData = Run(sequenceNetId, inputData.data(), outputState, cellState);
+    const std::vector<float> firstExpectedOutputData(expectedOutputData.begin(),
+                                                     expectedOutputData.begin() + 2 * numUnits);
+    const std::vector<float> secondExpectedOutputData(expectedOutputData.begin() + 2 * numUnits,
+                                                      expectedOutputData.end());
+    BOOST_TEST(restartedOutputData == firstExpectedOutputData, tolerance << boost::test_tools::per_element());
+
+    // Each working memory handle runs its own sequence, separate from the one of EnqueueWorkload(), and resetting
+    // one of them leaves the others as they are.
+    std::unique_ptr<IWorkingMemHandle> firstHandle  = runtime->CreateWorkingMemHandle(sequenceNetId);
+    std::unique_ptr<IWorkingMemHandle> secondHandle = runtime->CreateWorkingMemHandle(sequenceNetId);
+    std::vector<float> firstOutputState = initialState;
+    std::vector<float> firstCellState = initialState;
+    std::vector<float> secondOutputState = initialState;
+    std::vector<float> secondCellState = initialState;
+    BOOST_TEST(Run(sequenceNetId, inputData.data(), firstOutputState, firstCellState, firstHandle.get())
+               == firstExpectedOutputData, tolerance << boost::test_tools::per_element());
+    BOOST_TEST(Run(sequenceNetId, inputData.data(), secondOutputState, secondCellState, secondHandle.get())
+               == firstExpectedOutputData, tolerance << boost::test_tools::per_element());
+    firstHandle->ResetState();
+    firstOutputState = initialState;
+    firstCellState = initialState;
+    BOOST_TEST(Run(sequenceNetId, inputData.data(), firstOutputState, firstCellState, firstHandle.get())
+               == firstExpectedOutputData, tolerance << boost::test_tools::per_element());
+    BOOST_TEST(Run(sequenceNetId, inputData.data() + 2 * numInputs, secondOutputState, secondCellState,
+                   secondHandle.get()) == secondExpectedOutputData, tolerance << boost::test_tools::per_element());
+    BOOST_TEST(Run(sequenceNetId, inputData.data() + 2 * numInputs, outputState, cellState)
+               == secondExpectedOutputData, tolerance << boost::test_tools::per_element());
+
+    // The first dimension of a sequence is time, so the batch size of the network cannot follow it.
+    NetworkId singleStepNetId = LoadLstm(true, { 1, 1, numInputs }, { 1, 1, numUnits });
+    const std::vector<float> twoStates(2 * numUnits, 0.0f);
+    std::vector<float> twoStepsOutputData(2 * numUnits);
+    std::vector<float> outputStates(2 * numUnits);
+    std::vector<float> cellStates(2 * numUnits);
+    const TensorInfo statesInfo({ 2, numUnits }, DataType::Float32);
+    InputTensors twoStepsInputTensors
+    {
+        { 0, ConstTensor(TensorInfo({ 2, 1, numInputs }, DataType::Float32), inputData.data()) },
+        { 1, ConstTensor(statesInfo, twoStates.data()) },
+        { 2, ConstTensor(statesInfo, twoStates.data()) }
+    };
+    OutputTensors twoStepsOutputTensors
+    {
+        { 0, Tensor(TensorInfo({ 2, 1, numUnits }, DataType::Float32), twoStepsOutputData.data()) },
+        { 1, Tensor(statesInfo, outputStates.data()) },
+        { 2, Tensor(statesInfo, cellStates.data()) }
+    };
+    BOOST_CHECK_THROW(runtime->EnqueueWorkload(singleStepNetId, twoStepsInputTensors, twoStepsOutputTensors),
+                      InvalidArgumentException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
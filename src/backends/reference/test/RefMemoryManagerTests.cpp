@@ -0,0 +1,203 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/RefMemoryManager.hpp>
+#include <reference/RefTensorHandle.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+
+BOOST_AUTO_TEST_SUITE(RefMemoryManager)
+
+namespace
+{
+
+bool IsAligned(const void* memory)
+{
+    return reinterpret_cast<uintptr_t>(memory) % armnn::RefMemoryManager::Alignment == 0;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(ChainReusesMemoryOfDeadTensors)
+{
+    auto memoryManager = std::make_shared<armnn::RefMemoryManager>();
+
+    // 25 floats = 100 bytes, padded to two alignment units.
+    armnn::TensorInfo info({ 1, 25 }, armnn::DataType::Float32);
+    armnn::RefTensorHandle a(info, memoryManager);
+    armnn::RefTensorHandle b(info, memoryManager);
+    armnn::RefTensorHandle c(info, memoryManager);
+
+    // The order in which Graph::AllocateDynamicBuffers reports the lifetimes of a chain a -> b -> c.
+    a.Manage();
+    b.Manage();
+    a.Allocate();
+    c.Manage();
+    b.Allocate();
+    c.Allocate();
+
+    BOOST_TEST(memoryManager->GetArenaSize() == 2 * 2 * armnn::RefMemoryManager::Alignment);
+
+    memoryManager->Acquire();
+
+    BOOST_TEST(a.GetTensor<void>() != nullptr);
+    BOOST_TEST(IsAligned(a.GetTensor<void>()));
+    BOOST_TEST(IsAligned(b.GetTensor<void>()));
+    BOOST_TEST(a.GetTensor<void>() != b.GetTensor<void>());
+    BOOST_TEST(b.GetTensor<void>() != c.GetTensor<void>());
+    BOOST_TEST(a.GetTensor<void>() == c.GetTensor<void>());
+
+    memoryManager->Release();
+
+    BOOST_TEST(a.GetTensor<void>() == nullptr);
+    BOOST_TEST(b.GetTensor<void>() == nullptr);
+    BOOST_TEST(c.GetTensor<void>() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(OverlappingLifetimesDoNotShareMemory)
+{
+    auto memoryManager = std::make_shared<armnn::RefMemoryManager>();
+
+    armnn::TensorInfo smallInfo({ 16 }, armnn::DataType::Float32);
+    armnn::TensorInfo largeInfo({ 64 }, armnn::DataType::Float32);
+
+    armnn::RefTensorHandle large(largeInfo, memoryManager);
+    armnn::RefTensorHandle small0(smallInfo, memoryManager);
+    armnn::RefTensorHandle small1(smallInfo, memoryManager);
+    armnn::RefTensorHandle neverReleased(smallInfo, memoryManager);
+
+    large.Manage();
+    small0.Manage();
+    neverReleased.Manage();
+    small0.Allocate();
+    small1.Manage();
+    large.Allocate();
+    small1.Allocate();
+
+    memoryManager->Acquire();
+
+    auto Begin = [](const armnn::RefTensorHandle& handle)
+    {
+        return reinterpret_cast<uintptr_t>(handle.GetTensor<void>());
+    };
+    auto End = [&Begin](const armnn::RefTensorHandle& handle)
+    {
+        return Begin(handle) + handle.GetTensorInfo().GetNumBytes();
+    };
+    auto Disjoint = [&](const armnn::RefTensorHandle& x, const armnn::RefTensorHandle& y)
+    {
+        return End(x) <= Begin(y) || End(y) <= Begin(x);
+    };
+
+    BOOST_TEST(Disjoint(large, small0));
+    BOOST_TEST(Disjoint(large, small1));
+    BOOST_TEST(Disjoint(large, neverReleased));
+    BOOST_TEST(Disjoint(small0, neverReleased));
+    BOOST_TEST(Disjoint(small1, neverReleased));
+
+    // small1 starts after small0 has been released, so it can take its place.
+    BOOST_TEST(Begin(small0) == Begin(small1));
+    BOOST_TEST(memoryManager->GetArenaSize() == 256 + 2 * armnn::RefMemoryManager::Alignment);
+}
+
+BOOST_AUTO_TEST_CASE(ArenaIsReacquiredAfterRelease)
+{
+    auto memoryManager = std::make_shared<armnn::RefMemoryManager>();
+
+    armnn::TensorInfo info({ 4 }, armnn::DataType::Float32);
+    armnn::RefTensorHandle handle(info, memoryManager);
+    handle.Manage();
+    handle.Allocate();
+
+    BOOST_TEST(handle.GetTensor<void>() == nullptr);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        memoryManager->Acquire();
+        BOOST_TEST(handle.GetTensor<void>() != nullptr);
+        handle.GetTensor<float>()[3] = 1.0f;
+
+        memoryManager->Release();
+        BOOST_TEST(handle.GetTensor<void>() == nullptr);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(DestroyedHandlesTakeNoSpaceInTheArena)
+{
+    auto memoryManager = std::make_shared<armnn::RefMemoryManager>();
+
+    armnn::TensorInfo bigInfo({ 64 }, armnn::DataType::Float32);
+    armnn::TensorInfo smallInfo({ 4 }, armnn::DataType::Float32);
+
+    armnn::RefTensorHandle small(smallInfo, memoryManager);
+    small.Manage();
+    {
+        armnn::RefTensorHandle big(bigInfo, memoryManager);
+        big.Manage();
+        big.Allocate();
+        BOOST_TEST(memoryManager->GetArenaSize() == 256 + armnn::RefMemoryManager::Alignment);
+    }
+    small.Allocate();
+
+    BOOST_TEST(memoryManager->GetArenaSize() == armnn::RefMemoryManager::Alignment);
+
+    memoryManager->Acquire();
+    BOOST_TEST(small.GetTensor<void>() != nullptr);
+    memoryManager->Release();
+}
+
+BOOST_AUTO_TEST_CASE(UnmanagedHandleOwnsItsMemory)
+{
+    auto memoryManager = std::make_shared<armnn::RefMemoryManager>();
+
+    armnn::TensorInfo info({ 8 }, armnn::DataType::Float32);
+    armnn::RefTensorHandle handle(info, memoryManager);
+    handle.Allocate();
+
+    BOOST_TEST(handle.GetTensor<void>() != nullptr);
+    BOOST_TEST(memoryManager->GetArenaSize() == 0);
+
+    memoryManager->Acquire();
+    memoryManager->Release();
+
+    BOOST_TEST(handle.GetTensor<void>() != nullptr);
+    BOOST_CHECK_THROW(handle.Allocate(), armnn::InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ImportedMemoryReplacesArenaMemoryUntilReleased)
+{
+    auto memoryManager = std::make_shared<armnn::RefMemoryManager>();
+
+    armnn::TensorInfo info({ 4 }, armnn::DataType::Float32);
+    armnn::RefTensorHandle handle(info, memoryManager);
+    handle.Manage();
+    handle.Allocate();
+    memoryManager->Acquire();
+
+    void* arenaMemory = handle.GetTensor<void>();
+    float userMemory[5] = {};
+
+    // Misaligned memory is refused and leaves the handle untouched.
+    void* misalignedMemory = reinterpret_cast<unsigned char*>(userMemory) + 1;
+    BOOST_TEST(!handle.CanBeImported(misalignedMemory));
+    BOOST_TEST(!handle.Import(misalignedMemory));
+    BOOST_TEST(handle.GetTensor<void>() == arenaMemory);
+
+    BOOST_TEST(handle.Import(userMemory));
+    BOOST_TEST(handle.GetTensor<void>() == userMemory);
+
+    // Reacquiring the arena does not override the imported memory.
+    memoryManager->Release();
+    memoryManager->Acquire();
+    BOOST_TEST(handle.GetTensor<void>() == userMemory);
+
+    BOOST_TEST(handle.Import(nullptr));
+    BOOST_TEST(handle.GetTensor<void>() != userMemory);
+    BOOST_TEST(handle.GetTensor<void>() != nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,262 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/Activation.hpp>
+#include <reference/workloads/FullyConnected.hpp>
+#include <reference/workloads/Mean.hpp>
+#include <reference/workloads/Pooling2d.hpp>
+#include <reference/workloads/RefWorkloadUtils.hpp>
+#include <reference/workloads/Softmax.hpp>
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/TypesUtils.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// The quantized kernels must agree with dequantizing, running the float kernel and quantizing the result,
+// to within one quantization step.
+BOOST_AUTO_TEST_SUITE(RefQuantizedKernels)
+
+namespace
+{
+
+std::vector<uint8_t> MakeRandomData(const armnn::TensorInfo& info, unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+
+    std::vector<uint8_t> data(info.GetNumElements());
+    for (auto& value : data)
+    {
+        value = static_cast<uint8_t>(dist(gen));
+    }
+    return data;
+}
+
+void CheckWithinOneStep(const std::vector<uint8_t>& actual, const std::vector<uint8_t>& expected)
+{
+    BOOST_TEST(actual.size() == expected.size());
+    for (size_t i = 0; i < actual.size(); i++)
+    {
+        BOOST_TEST(std::abs(static_cast<int>(actual[i]) - static_cast<int>(expected[i])) <= 1,
+                   "element " << i << ": " << static_cast<int>(actual[i]) << " vs "
+                              << static_cast<int>(expected[i]));
+    }
+}
+
+std::vector<uint8_t> QuantizeResults(const std::vector<float>& results, const armnn::TensorInfo& info)
+{
+    std::vector<uint8_t> quantized(results.size());
+    armnn::Quantize(quantized.data(), results.data(), info);
+    return quantized;
+}
+
+void CompareActivation(armnn::ActivationFunction function, float a, float b)
+{
+    armnn::TensorInfo inputInfo({ 2, 3, 7, 5 }, armnn::DataType::QuantisedAsymm8, 0.05f, 120);
+    armnn::TensorInfo outputInfo({ 2, 3, 7, 5 }, armnn::DataType::QuantisedAsymm8, 0.03f, 100);
+
+    std::vector<uint8_t> input = MakeRandomData(inputInfo, 1);
+
+    std::vector<float> dequantized = armnn::Dequantize(input.data(), inputInfo);
+    std::vector<float> results(inputInfo.GetNumElements());
+    armnn::Activation(dequantized.data(), results.data(), inputInfo, function, a, b);
+
+    std::vector<uint8_t> output(outputInfo.GetNumElements());
+    armnn::Activation(input.data(), output.data(), inputInfo,
+                      armnn::MakeActivationTable(inputInfo, outputInfo, function, a, b));
+
+    CheckWithinOneStep(output, QuantizeResults(results, outputInfo));
+}
+
+void ComparePooling2d(armnn::PoolingAlgorithm poolType,
+                      armnn::PaddingMethod paddingMethod,
+                      armnn::DataLayout dataLayout)
+{
+    armnn::Pooling2dDescriptor descriptor;
+    descriptor.m_PoolType      = poolType;
+    descriptor.m_PaddingMethod = paddingMethod;
+    descriptor.m_DataLayout    = dataLayout;
+    descriptor.m_PoolWidth     = 3;
+    descriptor.m_PoolHeight    = 3;
+    descriptor.m_StrideX       = 2;
+    descriptor.m_StrideY       = 2;
+    descriptor.m_PadLeft       = 1;
+    descriptor.m_PadRight      = 1;
+    descriptor.m_PadTop        = 1;
+    descriptor.m_PadBottom     = 1;
+
+    const bool nhwc = dataLayout == armnn::DataLayout::NHWC;
+    armnn::TensorInfo inputInfo(nhwc ? armnn::TensorShape({ 2, 9, 9, 3 }) : armnn::TensorShape({ 2, 3, 9, 9 }),
+                                armnn::DataType::QuantisedAsymm8, 0.1f, 128);
+    armnn::TensorInfo outputInfo(nhwc ? armnn::TensorShape({ 2, 5, 5, 3 }) : armnn::TensorShape({ 2, 3, 5, 5 }),
+                                 armnn::DataType::QuantisedAsymm8, 0.15f, 90);
+
+    std::vector<uint8_t> input = MakeRandomData(inputInfo, 2);
+
+    std::vector<float> dequantized = armnn::Dequantize(input.data(), inputInfo);
+    std::vector<float> results(outputInfo.GetNumElements());
+    armnn::Pooling2d(dequantized.data(), results.data(), inputInfo, outputInfo, descriptor);
+
+    std::vector<uint8_t> output(outputInfo.GetNumElements());
+    armnn::Pooling2d(input.data(), output.data(), inputInfo, outputInfo, descriptor);
+
+    CheckWithinOneStep(output, QuantizeResults(results, outputInfo));
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(ActivationReLu)
+{
+    CompareActivation(armnn::ActivationFunction::ReLu, 0.0f, 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(ActivationBoundedReLu)
+{
+    CompareActivation(armnn::ActivationFunction::BoundedReLu, 3.0f, -1.0f);
+}
+
+BOOST_AUTO_TEST_CASE(ActivationSigmoid)
+{
+    CompareActivation(armnn::ActivationFunction::Sigmoid, 0.0f, 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(ActivationTanH)
+{
+    CompareActivation(armnn::ActivationFunction::TanH, 1.0f, 1.0f);
+}
+
+void CompareSoftmax(float inputScale, float beta, float outputScale, unsigned int numChannels)
+{
+    armnn::TensorInfo inputInfo({ 3, numChannels }, armnn::DataType::QuantisedAsymm8, inputScale, 128);
+    armnn::TensorInfo outputInfo({ 3, numChannels }, armnn::DataType::QuantisedAsymm8, outputScale, 0);
+
+    std::vector<uint8_t> input = MakeRandomData(inputInfo, 3);
+
+    std::vector<float> dequantized = armnn::Dequantize(input.data(), inputInfo);
+    std::vector<float> results(inputInfo.GetNumElements());
+    armnn::Softmax(dequantized.data(), results.data(), inputInfo, beta);
+
+    std::vector<uint8_t> output(outputInfo.GetNumElements());
+    armnn::Softmax(input.data(), output.data(), inputInfo, outputInfo, armnn::MakeSoftmaxExpTable(inputInfo, beta));
+
+    CheckWithinOneStep(output, QuantizeResults(results, outputInfo));
+}
+
+BOOST_AUTO_TEST_CASE(Softmax)
+{
+    CompareSoftmax(0.05f, 1.5f, 1.0f / 256.0f, 40);
+}
+
+BOOST_AUTO_TEST_CASE(SoftmaxFlatInput)
+{
+    // Small differences between the inputs spread the probability over many channels.
+    CompareSoftmax(0.001f, 1.0f, 1.0f / 256.0f, 1000);
+}
+
+BOOST_AUTO_TEST_CASE(SoftmaxSharpInput)
+{
+    // Large differences put almost all the probability on the maximum.
+    CompareSoftmax(0.5f, 2.0f, 1.0f / 255.0f, 16);
+}
+
+BOOST_AUTO_TEST_CASE(SoftmaxSingleChannel)
+{
+    CompareSoftmax(0.1f, 1.0f, 1.0f / 256.0f, 1);
+}
+
+BOOST_AUTO_TEST_CASE(MaxPooling2dNchw)
+{
+    ComparePooling2d(armnn::PoolingAlgorithm::Max, armnn::PaddingMethod::Exclude, armnn::DataLayout::NCHW);
+}
+
+BOOST_AUTO_TEST_CASE(AveragePooling2dNhwc)
+{
+    ComparePooling2d(armnn::PoolingAlgorithm::Average, armnn::PaddingMethod::Exclude, armnn::DataLayout::NHWC);
+}
+
+BOOST_AUTO_TEST_CASE(AveragePooling2dIgnoreValue)
+{
+    ComparePooling2d(armnn::PoolingAlgorithm::Average, armnn::PaddingMethod::IgnoreValue, armnn::DataLayout::NCHW);
+}
+
+BOOST_AUTO_TEST_CASE(MaxPooling2dSameQuantization)
+{
+    armnn::Pooling2dDescriptor descriptor;
+    descriptor.m_PoolType   = armnn::PoolingAlgorithm::Max;
+    descriptor.m_PoolWidth  = 2;
+    descriptor.m_PoolHeight = 2;
+    descriptor.m_StrideX    = 2;
+    descriptor.m_StrideY    = 2;
+
+    // With the same quantization on both sides, max pooling must return one of the input values unchanged.
+    armnn::TensorInfo inputInfo({ 1, 1, 2, 2 }, armnn::DataType::QuantisedAsymm8, 0.1f, 128);
+    armnn::TensorInfo outputInfo({ 1, 1, 1, 1 }, armnn::DataType::QuantisedAsymm8, 0.1f, 128);
+    std::vector<uint8_t> input = { 3, 200, 17, 199 };
+
+    std::vector<uint8_t> output(1);
+    armnn::Pooling2d(input.data(), output.data(), inputInfo, outputInfo, descriptor);
+    BOOST_TEST(output[0] == 200);
+}
+
+BOOST_AUTO_TEST_CASE(L2Pooling2d)
+{
+    ComparePooling2d(armnn::PoolingAlgorithm::L2, armnn::PaddingMethod::IgnoreValue, armnn::DataLayout::NHWC);
+}
+
+BOOST_AUTO_TEST_CASE(FullyConnected)
+{
+    for (bool transposeWeights : { false, true })
+    {
+        armnn::TensorInfo inputInfo({ 3, 64 }, armnn::DataType::QuantisedAsymm8, 0.02f, 130);
+        armnn::TensorInfo weightInfo(transposeWeights ? armnn::TensorShape({ 10, 64 }) : armnn::TensorShape({ 64, 10 }),
+                                     armnn::DataType::QuantisedAsymm8, 0.01f, 120);
+        armnn::TensorInfo biasInfo({ 10 }, armnn::DataType::Signed32, 0.02f * 0.01f, 0);
+        armnn::TensorInfo outputInfo({ 3, 10 }, armnn::DataType::QuantisedAsymm8, 0.05f, 128);
+
+        std::vector<uint8_t> input   = MakeRandomData(inputInfo, 4);
+        std::vector<uint8_t> weights = MakeRandomData(weightInfo, 5);
+        std::vector<int32_t> bias    = { -3000, -2000, -1000, 0, 500, 1000, 1500, 2000, 2500, 3000 };
+
+        std::vector<float> dequantizedInput   = armnn::Dequantize(input.data(), inputInfo);
+        std::vector<float> dequantizedWeights = armnn::Dequantize(weights.data(), weightInfo);
+        std::vector<float> dequantizedBias    = armnn::Dequantize(bias.data(), biasInfo);
+        std::vector<float> results(outputInfo.GetNumElements());
+        armnn::FullyConnected(dequantizedInput.data(), results.data(), inputInfo, outputInfo,
+                              dequantizedWeights.data(), dequantizedBias.data(), transposeWeights);
+
+        std::vector<int32_t> packedWeights =
+            armnn::PackFullyConnectedWeights(weights.data(), weightInfo, transposeWeights);
+        std::vector<uint8_t> output(outputInfo.GetNumElements());
+        armnn::FullyConnected(input.data(), output.data(), inputInfo, outputInfo,
+                              packedWeights.data(), weightInfo.GetQuantizationScale(), bias.data());
+
+        CheckWithinOneStep(output, QuantizeResults(results, outputInfo));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Mean)
+{
+    armnn::TensorInfo inputInfo({ 2, 6, 5, 4 }, armnn::DataType::QuantisedAsymm8, 0.1f, 100);
+    armnn::TensorInfo outputInfo({ 2, 4 }, armnn::DataType::QuantisedAsymm8, 0.05f, 110);
+    std::vector<unsigned int> axis = { 1, 2 };
+
+    std::vector<uint8_t> input = MakeRandomData(inputInfo, 6);
+
+    std::vector<float> dequantized = armnn::Dequantize(input.data(), inputInfo);
+    std::vector<float> results(outputInfo.GetNumElements());
+    armnn::Mean(inputInfo, outputInfo, axis, dequantized.data(), results.data());
+
+    std::vector<uint8_t> output(outputInfo.GetNumElements());
+    armnn::Mean(inputInfo, outputInfo, axis, input.data(), output.data());
+
+    CheckWithinOneStep(output, QuantizeResults(results, outputInfo));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -5,13 +5,68 @@
 
 #include "Activation.hpp"
 
-#include <boost/log/trivial.hpp>
+#include <armnn/Exceptions.hpp>
+#include <armnn/TypesUtils.hpp>
 
+#include <array>
 #include <cmath>
+#include <limits>
 
 namespace armnn
 {
 
+float Activation(float input, ActivationFunction function, float a, float b)
+{
+    // Compute the result of the activation function.
+    switch (function)
+    {
+        case ActivationFunction::Linear:
+        {
+            return a * input + b;
+        }
+        case ActivationFunction::Sigmoid:
+        {
+            return 1.f / (1.f + expf(-input));
+        }
+        case ActivationFunction::ReLu:
+        {
+            return std::max(0.f, input);
+        }
+        case ActivationFunction::BoundedReLu:
+        {
+            return std::min(a, std::max(b, input));
+        }
+        case ActivationFunction::SoftReLu:
+        {
+            return logf(1.0f + expf(input));
+        }
+        case ActivationFunction::LeakyReLu:
+        {
+            return input > 0.0f ? input : (input * a);
+        }
+        case ActivationFunction::Abs:
+        {
+            return input < 0 ? -input : input;
+        }
+        case ActivationFunction::Sqrt:
+        {
+            return sqrtf(input);
+        }
+        case ActivationFunction::Square:
+        {
+            return input * input;
+        }
+        case ActivationFunction::TanH:
+        {
+            return a * tanhf(b * input);
+        }
+        default:
+        {
+            throw InvalidArgumentException("Unsupported activation function");
+        }
+    }
+}
+
 void Activation(const float* in,
                float* out,
                const TensorInfo& tensorInfo,
@@ -21,70 +76,57 @@ void Activation(const float* in,
 {
     for (size_t i = 0; i<tensorInfo.GetNumElements(); i++)
     {
-        float input = in[i];
-        float output;
+        out[i] = Activation(in[i], function, a, b);
+    }
+}
 
-        // Compute the result of the activation function.
-        switch (function)
-        {
-            case ActivationFunction::Linear:
-            {
-                output = a * input + b;
-                break;
-            }
-            case ActivationFunction::Sigmoid:
-            {
-                output = 1.f / (1.f + expf(-input));
-                break;
-            }
-            case ActivationFunction::ReLu:
-            {
-                output = std::max(0.f, input);
-                break;
-            }
-            case ActivationFunction::BoundedReLu:
-            {
-                output = std::min(a, std::max(b, input));
-                break;
-            }
-            case ActivationFunction::SoftReLu:
-            {
-                output = logf(1.0f + expf(input));
-                break;
-            }
-            case ActivationFunction::LeakyReLu:
-            {
-                output = input > 0.0f ? input : (input * a);
-                break;
-            }
-            case ActivationFunction::Abs:
-            {
-                output = input < 0 ? -input : input;
-                break;
-            }
-            case ActivationFunction::Sqrt:
-            {
-                output = sqrtf(input);
-                break;
-            }
-            case ActivationFunction::Square:
-            {
-                output = input * input;
-                break;
-            }
-            case ActivationFunction::TanH:
-            {
-                output = a * tanhf(b * input);
-                break;
-            }
-            default:
-            {
-                BOOST_LOG_TRIVIAL(error) << "Unsupported activation function";
-                return;
-            }
-        }
+ActivationTable MakeActivationTable(const TensorInfo& inputInfo,
+                                    const TensorInfo& outputInfo,
+                                    ActivationFunction function,
+                                    float a,
+                                    float b)
+{
+    constexpr unsigned int tableSize = std::numeric_limits<uint8_t>::max() + 1;
+
+    std::array<float, tableSize> tableInputs;
+    for (unsigned int i = 0; i < tableSize; i++)
+    {
+        tableInputs[i] = Dequantize(static_cast<uint8_t>(i),
+                                    inputInfo.GetQuantizationScale(),
+                                    inputInfo.GetQuantizationOffset());
+    }
+
+    std::array<float, tableSize> tableOutputs;
+    Activation(tableInputs.data(), tableOutputs.data(), TensorInfo({ tableSize }, DataType::Float32), function, a, b);
 
-        out[i] = output;
+    ActivationTable table;
+    for (unsigned int i = 0; i < tableSize; i++)
+    {
+        // Entries outside the domain of the function (e.g. the square root of a negative value) cannot be quantized.
+        // They are only looked up if the input contains them, which the float implementation does not support either.
+        table[i] = std::isnan(tableOutputs[i]) ? static_cast<uint8_t>(0) :
+                   Quantize<uint8_t>(tableOutputs[i],
+                                     outputInfo.GetQuantizationScale(),
+                                     outputInfo.GetQuantizationOffset());
+    }
+    return table;
+}
+
+void Activation(const uint8_t* in, uint8_t* out, const TensorInfo& inputInfo, const ActivationTable& table)
+{
+    for (unsigned int i = 0; i < inputInfo.GetNumElements(); i++)
+    {
+        out[i] = table[in[i]];
+    }
+}
+
+FusedActivation::FusedActivation(const Optional<ActivationDescriptor>& descriptor, const TensorInfo& tensorInfo)
+    : m_Descriptor(descriptor)
+{
+    if (m_Descriptor.has_value() && tensorInfo.GetDataType() == DataType::QuantisedAsymm8)
+    {
+        m_Table = MakeActivationTable(tensorInfo, tensorInfo, m_Descriptor.value().m_Function,
+                                      m_Descriptor.value().m_A, m_Descriptor.value().m_B);
     }
 }
 
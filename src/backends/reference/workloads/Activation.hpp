@@ -3,12 +3,22 @@
 // SPDX-License-Identifier: MIT
 //
 
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Optional.hpp>
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 
+#include <array>
+#include <cstdint>
+
 namespace armnn
 {
 
+/// Performs the ActivationFunction on a single value.
+float Activation(float in, ActivationFunction function, float a, float b);
+
 /// Performs the ActivationFunction elementwise on the inputs to give the outputs.
 void Activation(const float* in,
                 float* out,
@@ -17,4 +27,46 @@ void Activation(const float* in,
                 float a,
                 float b);
 
+/// Lookup table for a quantized activation: entry q is the activation of the input value q, requantized.
+using ActivationTable = std::array<uint8_t, 256>;
+
+/// A quantized input can only take 256 distinct values, so the activation is evaluated once for each of them into a
+/// lookup table, giving exactly the result of dequantizing, activating and requantizing.
+ActivationTable MakeActivationTable(const TensorInfo& inputInfo,
+                                    const TensorInfo& outputInfo,
+                                    ActivationFunction function,
+                                    float a,
+                                    float b);
+
+/// Quantized activation, mapping each input value through a table built by MakeActivationTable().
+void Activation(const uint8_t* in, uint8_t* out, const TensorInfo& inputInfo, const ActivationTable& table);
+
+/// An activation fused into the workload producing its input, applied to each value as the workload computes it.
+/// Quantized values are mapped through a lookup table, so the activation must keep the quantization of the tensor.
+class FusedActivation
+{
+public:
+    /// @param descriptor - The activation, if any.
+    /// @param tensorInfo - The output of the workload, which is both the input and the output of the activation.
+    FusedActivation(const Optional<ActivationDescriptor>& descriptor = EmptyOptional(),
+                    const TensorInfo& tensorInfo = TensorInfo());
+
+    float operator()(float value) const
+    {
+        return m_Descriptor.has_value() ?
+               Activation(value, m_Descriptor.value().m_Function, m_Descriptor.value().m_A, m_Descriptor.value().m_B) :
+               value;
+    }
+
+    /// @param value - A quantized value, in [0, 255].
+    int32_t operator()(int32_t value) const
+    {
+        return m_Descriptor.has_value() ? m_Table[static_cast<size_t>(value)] : value;
+    }
+
+private:
+    Optional<ActivationDescriptor> m_Descriptor;
+    ActivationTable m_Table;
+};
+
 } //namespace armnn
@@ -23,6 +23,8 @@ public:
     virtual BaseIterator& operator+=(const unsigned int increment) = 0;
 
     virtual BaseIterator& operator-=(const unsigned int increment) = 0;
+
+    virtual void Reset(void* data) = 0;
 };
 
 template<typename IType>
@@ -77,6 +79,11 @@ public:
         return *this;
     }
 
+    void Reset(void* data) override
+    {
+        m_Iterator = reinterpret_cast<T*>(data);
+    }
+
     T* m_Iterator;
 };
 
@@ -10,6 +10,7 @@ namespace armnn
 
 BroadcastLoop::BroadcastLoop(const TensorShape& inShape0, const TensorShape& inShape1, const TensorShape& outShape)
 : m_DimData(outShape.GetNumDimensions())
+, m_SplitDimension(GetSplitDimension(outShape))
 {
     const unsigned int numDims = GetNumDimensions();
 
@@ -30,4 +31,16 @@ BroadcastLoop::BroadcastLoop(const TensorShape& inShape0, const TensorShape& inS
     }
 }
 
+unsigned int BroadcastLoop::GetSplitDimension(const TensorShape& outShape)
+{
+    for (unsigned int i = 0; i < outShape.GetNumDimensions(); i++)
+    {
+        if (outShape[i] > 1)
+        {
+            return i;
+        }
+    }
+    return 0;
+}
+
 } // namespace armnn
@@ -20,6 +20,47 @@ struct BroadcastLoop
         return static_cast<unsigned int>(m_DimData.size());
     }
 
+    /// Index of the outermost dimension of the output with more than one element (0 if there is none).
+    static unsigned int GetSplitDimension(const TensorShape& outShape);
+
+    /// Runs the loop over the elements whose index along the split dimension (see GetSplitDimension()) is in
+    /// [begin, end). Disjoint ranges can be run concurrently, given iterators of their own.
+    template <typename Func, typename DecoderOp, typename EncoderOp>
+    void UnrollRange(Func operationFunc,
+                     unsigned int begin,
+                     unsigned int end,
+                     DecoderOp& inData0,
+                     DecoderOp& inData1,
+                     EncoderOp& outData)
+    {
+        if (GetNumDimensions() == 0)
+        {
+            Unroll(operationFunc, 0, inData0, inData1, outData);
+            return;
+        }
+
+        // The dimensions outside the split one have a single element, so the iterators only move along it.
+        const BroadcastDimensionData& dimData = m_DimData[m_SplitDimension];
+
+        inData0 += begin * dimData.m_Stride1;
+        inData1 += begin * dimData.m_Stride2;
+        outData += begin * dimData.m_StrideOut;
+
+        for (unsigned int i = begin; i < end; i++)
+        {
+            Unroll(operationFunc, m_SplitDimension + 1, inData0, inData1, outData);
+
+            inData0 += dimData.m_Stride1;
+            inData1 += dimData.m_Stride2;
+            outData += dimData.m_StrideOut;
+        }
+
+        // move iterator back to the start
+        inData0 -= end * dimData.m_Stride1;
+        inData1 -= end * dimData.m_Stride2;
+        outData -= end * dimData.m_StrideOut;
+    }
+
     template <typename Func, typename DecoderOp, typename EncoderOp>
     void Unroll(Func operationFunc,
                 unsigned int dimension,
@@ -67,6 +108,7 @@ private:
     };
 
     std::vector<BroadcastDimensionData> m_DimData;
+    unsigned int m_SplitDimension;
 };
 
 } //namespace armnn
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include <boost/assert.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -68,4 +69,41 @@ int32_t QuantizedMultiplierSmallerThanOne::RoundingDivideByPOT(int32_t x, int ex
     return (x >> exponent) + (remainder > threshold ? 1 : 0);
 }
 
+QuantizedMultiplier::QuantizedMultiplier(float multiplier)
+{
+    BOOST_ASSERT(multiplier >= 0.0f);
+    int exponent = 0;
+    const double q = std::frexp(multiplier, &exponent);
+    m_Multiplier = static_cast<int64_t>(std::round(q * (1ll << 31)));
+    m_RightShift = 31 - exponent;
+}
+
+int32_t QuantizedMultiplier::Apply(int64_t value, int64_t divisor, int extraShift) const
+{
+    BOOST_ASSERT(divisor > 0);
+    BOOST_ASSERT(value > -(1ll << 32) && value < (1ll << 32));
+
+    const int shift = m_RightShift + extraShift;
+    BOOST_ASSERT(shift >= 0);
+    if (shift >= 63)
+    {
+        // The product is below 2^63, so it rounds to zero.
+        return 0;
+    }
+
+    // Works on the magnitude so that rounding is symmetric around zero.
+    const uint64_t magnitude = static_cast<uint64_t>(value < 0 ? -value : value);
+    const uint64_t product   = magnitude * static_cast<uint64_t>(m_Multiplier);
+    const uint64_t udivisor  = static_cast<uint64_t>(divisor);
+    uint64_t result = (product + udivisor / 2) / udivisor;
+    if (shift > 0)
+    {
+        result = (result + (1ull << (shift - 1))) >> shift;
+    }
+
+    const uint64_t limit = static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+    const int32_t saturated = static_cast<int32_t>(std::min(result, limit));
+    return value < 0 ? -saturated : saturated;
+}
+
 } //namespace armnn
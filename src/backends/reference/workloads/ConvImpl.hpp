@@ -5,11 +5,14 @@
 
 #pragma once
 
+#include "Activation.hpp"
 #include "RefWorkloadUtils.hpp"
 #include "TensorBufferArrayView.hpp"
 
 #include <armnn/Tensor.hpp>
 
+#include <backendsCommon/ThreadPool.hpp>
+
 #include <DataLayoutIndexed.hpp>
 
 #include <boost/assert.hpp>
@@ -17,8 +20,10 @@
 
 #include <DataLayoutIndexed.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace armnn
 {
@@ -47,7 +52,24 @@ private:
     int32_t m_RightShift;
 };
 
+/// Multiplies integers by a non-negative real multiplier of any magnitude, held as a Q0.31 fixed-point mantissa and a
+/// power-of-two exponent. Results are rounded to the nearest integer, halves away from zero, as Quantize() does.
+struct QuantizedMultiplier
+{
+public:
+    QuantizedMultiplier(float multiplier);
+
+    /// Returns round(value * multiplier / (divisor * 2^extraShift)), saturated to the int32 range.
+    /// The magnitude of value must be below 2^32.
+    int32_t Apply(int64_t value, int64_t divisor = 1, int extraShift = 0) const;
+
+private:
+    int64_t m_Multiplier;
+    int m_RightShift;
+};
+
 /// An implementation shared by normal and depthwise convolution.
+/// The activation is applied to each output value after requantization.
 template<typename ConvData, typename InputType, typename BiasType, typename AccumulatorType>
 static void ConvImpl(ConvData data,
                      const InputType* inputData,
@@ -60,7 +82,8 @@ static void ConvImpl(ConvData data,
                      float outputScale,
                      int32_t outputOffset,
                      const TensorInfo& filterInfo,
-                     bool depthwise = false)
+                     bool depthwise = false,
+                     const FusedActivation& activation = FusedActivation())
 {
     if (data.m_Parameters.m_BiasEnabled && !biasData)
     {
@@ -99,10 +122,16 @@ static void ConvImpl(ConvData data,
     unsigned int yStride     = data.m_Parameters.m_StrideY;
 
     // The world's least efficient convolution.
-    for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
+    // Each output channel of each batch is computed on its own, so they can be shared out between threads.
+    const unsigned int workPerChannel =
+        outputHeight * outputWidth * filterHeight * filterWidth * (depthwise ? 1 : inputChannels);
+    ParallelFor(batchSize * outputChannels, workPerChannel, [&](unsigned int begin, unsigned int end)
     {
-        for (unsigned int cOutput = 0; cOutput < outputChannels; cOutput++)
+        for (unsigned int index = begin; index < end; index++)
         {
+            const unsigned int batchIdx = index / outputChannels;
+            const unsigned int cOutput  = index % outputChannels;
+
             for (unsigned int yOutput = 0; yOutput < outputHeight; yOutput++)
             {
                 for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
@@ -215,11 +244,270 @@ static void ConvImpl(ConvData data,
                         sum = std::min<AccumulatorType>(std::max<AccumulatorType>(sum, 0), 255);
                     }
 
-                    output.Get(batchIdx, cOutput, yOutput, xOutput) = boost::numeric_cast<InputType>(sum);
+                    output.Get(batchIdx, cOutput, yOutput, xOutput) = boost::numeric_cast<InputType>(activation(sum));
+                }
+            }
+        }
+    });
+}
+
+/// Tile sizes used by Im2ColConvImpl. A column tile holds Im2ColTileDepth rows of the unrolled input, each
+/// Im2ColTileWidth output positions wide, and stays resident in cache while every output channel is accumulated
+/// against it.
+constexpr unsigned int Im2ColTileWidth = 64;
+constexpr unsigned int Im2ColTileDepth = 256;
+
+/// Reorders a (non-depthwise) convolution filter into a row-major [outputChannels][inputChannels * height * width]
+/// matrix with the filter offset already subtracted, as consumed by Im2ColConvImpl. Each row runs over input
+/// channel, then filter row, then filter column: the order in which ConvImpl accumulates.
+template<typename InputType, typename AccumulatorType>
+void PackIm2ColFilter(const InputType* filterData,
+                      int32_t filterOffset,
+                      const TensorInfo& filterInfo,
+                      DataLayout dataLayout,
+                      std::vector<AccumulatorType>& packedFilter)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const TensorShape& filterShape = filterInfo.GetShape();
+
+    const unsigned int outputChannels = filterShape[0];
+    const unsigned int inputChannels  = filterShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int filterHeight   = filterShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int filterWidth    = filterShape[dataLayoutIndexed.GetWidthIndex()];
+
+    const AccumulatorType offset = boost::numeric_cast<AccumulatorType>(filterOffset);
+
+    packedFilter.resize(filterInfo.GetNumElements());
+    AccumulatorType* packed = packedFilter.data();
+
+    for (unsigned int cOutput = 0; cOutput < outputChannels; cOutput++)
+    {
+        for (unsigned int cInput = 0; cInput < inputChannels; cInput++)
+        {
+            for (unsigned int yFilter = 0; yFilter < filterHeight; yFilter++)
+            {
+                for (unsigned int xFilter = 0; xFilter < filterWidth; xFilter++)
+                {
+                    unsigned int filterIndex;
+                    if (dataLayout == DataLayout::NHWC)
+                    {
+                        filterIndex = cOutput * filterHeight * filterWidth * inputChannels +
+                                      yFilter * filterWidth * inputChannels +
+                                      xFilter * inputChannels +
+                                      cInput;
+                    }
+                    else
+                    {
+                        filterIndex = cOutput * filterWidth * filterHeight * inputChannels +
+                                      cInput  * filterWidth * filterHeight +
+                                      yFilter * filterWidth +
+                                      xFilter;
+                    }
+
+                    *packed++ = filterData[filterIndex] - offset;
                 }
             }
         }
     }
 }
 
+/// A tiled im2col + GEMM implementation of (non-depthwise) convolution, taking a filter prepared by
+/// PackIm2ColFilter. Padding is resolved while unrolling the input, so the multiply-accumulate loop is branch free.
+/// Every output accumulates its products in the same order as ConvImpl, so the results are bit-exact with it.
+/// The activation is applied to each output value after requantization, while the tile is still in cache.
+template<typename ConvData, typename InputType, typename BiasType, typename AccumulatorType>
+static void Im2ColConvImpl(const ConvData& data,
+                           const InputType* inputData,
+                           float inputScale,
+                           int32_t inputOffset,
+                           const AccumulatorType* packedFilter,
+                           float filterScale,
+                           const BiasType* biasData,
+                           float outputScale,
+                           int32_t outputOffset,
+                           const TensorInfo& filterInfo,
+                           const FusedActivation& activation = FusedActivation())
+{
+    if (data.m_Parameters.m_BiasEnabled && !biasData)
+    {
+        throw InvalidArgumentException("Bias is enabled but the bias data is invalid");
+    }
+
+    const TensorInfo& inputInfo  = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
+
+    InputType* outputData = GetOutputTensorData<InputType>(0, data);
+
+    const DataLayout dataLayout = data.m_Parameters.m_DataLayout;
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+
+    const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
+    const unsigned int heightIndex   = dataLayoutIndexed.GetHeightIndex();
+    const unsigned int widthIndex    = dataLayoutIndexed.GetWidthIndex();
+
+    const unsigned int inputChannels  = filterInfo.GetShape()[channelsIndex];
+    const unsigned int outputChannels = filterInfo.GetShape()[0];
+    const unsigned int filterHeight   = filterInfo.GetShape()[heightIndex];
+    const unsigned int filterWidth    = filterInfo.GetShape()[widthIndex];
+
+    const unsigned int batchSize    = outputInfo.GetShape()[0];
+    const unsigned int outputHeight = outputInfo.GetShape()[heightIndex];
+    const unsigned int outputWidth  = outputInfo.GetShape()[widthIndex];
+    const unsigned int inputHeight  = inputInfo.GetShape()[heightIndex];
+    const unsigned int inputWidth   = inputInfo.GetShape()[widthIndex];
+
+    const unsigned int paddingTop  = data.m_Parameters.m_PadTop;
+    const unsigned int paddingLeft = data.m_Parameters.m_PadLeft;
+    const unsigned int xStride     = data.m_Parameters.m_StrideX;
+    const unsigned int yStride     = data.m_Parameters.m_StrideY;
+
+    // The GEMM is [outputChannels x depth] * [depth x positions], where depth runs over the filter taps.
+    const unsigned int filterArea     = filterHeight * filterWidth;
+    const unsigned int depth          = inputChannels * filterArea;
+    const unsigned int positions      = outputHeight * outputWidth;
+    const unsigned int inputBatchSize = inputInfo.GetShape().GetNumElements() / inputInfo.GetShape()[0];
+
+    // Distance between horizontally adjacent input elements of one channel, and between channels.
+    const unsigned int xInputStride = dataLayout == DataLayout::NHWC ? inputChannels : 1;
+    const unsigned int cInputStride = dataLayout == DataLayout::NHWC ? 1 : inputHeight * inputWidth;
+    const unsigned int yInputStride = inputWidth * xInputStride;
+
+    const AccumulatorType inputZero = boost::numeric_cast<AccumulatorType>(inputOffset);
+
+    const bool requantize = outputScale != 0.0f;
+    const QuantizedMultiplierSmallerThanOne quantizedMultiplier(
+        requantize ? (inputScale * filterScale) / outputScale : 0.0f);
+
+    // Scratch space is kept per thread so that steady-state execution does not allocate.
+    static thread_local std::vector<AccumulatorType> columnTile;
+    static thread_local std::vector<AccumulatorType> accumulators;
+
+    // Tiles of output positions are computed independently of each other, so they are shared out between threads.
+    const unsigned int tilesPerBatch = (positions + Im2ColTileWidth - 1) / Im2ColTileWidth;
+    ParallelFor(batchSize * tilesPerBatch, outputChannels * depth * Im2ColTileWidth,
+                [&](unsigned int begin, unsigned int end)
+    {
+        columnTile.resize(Im2ColTileDepth * Im2ColTileWidth);
+        accumulators.resize(outputChannels * Im2ColTileWidth);
+
+        for (unsigned int tile = begin; tile < end; tile++)
+        {
+            const unsigned int batchIdx = tile / tilesPerBatch;
+            const unsigned int pStart   = (tile % tilesPerBatch) * Im2ColTileWidth;
+
+            const InputType* batchInput = inputData + batchIdx * inputBatchSize;
+
+            const unsigned int pEnd   = std::min(positions, pStart + Im2ColTileWidth);
+            const unsigned int pCount = pEnd - pStart;
+
+            std::fill(accumulators.begin(), accumulators.end(), AccumulatorType());
+
+            for (unsigned int kStart = 0; kStart < depth; kStart += Im2ColTileDepth)
+            {
+                const unsigned int kEnd = std::min(depth, kStart + Im2ColTileDepth);
+
+                // Unrolls the input patches feeding this tile, one row per filter tap.
+                for (unsigned int k = kStart; k < kEnd; k++)
+                {
+                    const unsigned int cInput  = k / filterArea;
+                    const unsigned int yFilter = (k % filterArea) / filterWidth;
+                    const unsigned int xFilter = k % filterWidth;
+
+                    // Output columns whose tap lands inside the input, i.e.
+                    // paddingLeft <= xOutput * xStride + xFilter < inputWidth + paddingLeft.
+                    const unsigned int xValidBegin = xFilter >= paddingLeft ?
+                        0 : (paddingLeft - xFilter + xStride - 1) / xStride;
+                    const unsigned int xValidEnd = xFilter >= inputWidth + paddingLeft ?
+                        0 : (inputWidth + paddingLeft - xFilter + xStride - 1) / xStride;
+
+                    const InputType* channelInput = batchInput + cInput * cInputStride;
+                    AccumulatorType* columnRow = columnTile.data() + (k - kStart) * Im2ColTileWidth;
+
+                    // Walks the tile one output row segment at a time.
+                    unsigned int p = pStart;
+                    while (p < pEnd)
+                    {
+                        const unsigned int yOutput = p / outputWidth;
+                        const unsigned int xBegin  = p % outputWidth;
+                        const unsigned int xEnd    = std::min(outputWidth, xBegin + (pEnd - p));
+                        AccumulatorType* column    = columnRow + (p - pStart);
+
+                        const unsigned int yInput = yOutput * yStride + yFilter;
+                        if (yInput < paddingTop || yInput >= inputHeight + paddingTop)
+                        {
+                            std::fill(column, column + (xEnd - xBegin), AccumulatorType());
+                        }
+                        else
+                        {
+                            const unsigned int validBegin = std::min(std::max(xValidBegin, xBegin), xEnd);
+                            const unsigned int validEnd   = std::min(std::max(xValidEnd, validBegin), xEnd);
+
+                            const InputType* rowInput = channelInput + (yInput - paddingTop) * yInputStride;
+
+                            std::fill(column, column + (validBegin - xBegin), AccumulatorType());
+                            for (unsigned int xOutput = validBegin; xOutput < validEnd; xOutput++)
+                            {
+                                const unsigned int xInput = xOutput * xStride + xFilter - paddingLeft;
+                                column[xOutput - xBegin] = rowInput[xInput * xInputStride] - inputZero;
+                            }
+                            std::fill(column + (validEnd - xBegin), column + (xEnd - xBegin), AccumulatorType());
+                        }
+
+                        p += xEnd - xBegin;
+                    }
+                }
+
+                // Accumulates the tile into every output channel, walking the filter taps in order.
+                for (unsigned int cOutput = 0; cOutput < outputChannels; cOutput++)
+                {
+                    AccumulatorType* sums = accumulators.data() + cOutput * Im2ColTileWidth;
+                    const AccumulatorType* filterRow = packedFilter + cOutput * depth;
+
+                    for (unsigned int k = kStart; k < kEnd; k++)
+                    {
+                        const AccumulatorType filterValue = filterRow[k];
+                        const AccumulatorType* column = columnTile.data() + (k - kStart) * Im2ColTileWidth;
+
+                        for (unsigned int i = 0; i < pCount; i++)
+                        {
+                            sums[i] += filterValue * column[i];
+                        }
+                    }
+                }
+            }
+
+            for (unsigned int cOutput = 0; cOutput < outputChannels; cOutput++)
+            {
+                const AccumulatorType* sums = accumulators.data() + cOutput * Im2ColTileWidth;
+
+                for (unsigned int i = 0; i < pCount; i++)
+                {
+                    AccumulatorType sum = sums[i];
+
+                    if (data.m_Parameters.m_BiasEnabled)
+                    {
+                        sum += biasData[cOutput];
+                    }
+
+                    if (requantize)
+                    {
+                        // See ConvImpl for the rounding behaviour of the quantized multiplication.
+                        sum = boost::numeric_cast<AccumulatorType>(
+                                quantizedMultiplier * boost::numeric_cast<int32_t>(sum))
+                            + boost::numeric_cast<AccumulatorType>(outputOffset);
+                        sum = std::min<AccumulatorType>(std::max<AccumulatorType>(sum, 0), 255);
+                    }
+
+                    const unsigned int position = pStart + i;
+                    const unsigned int outputIndex = dataLayout == DataLayout::NHWC ?
+                        (batchIdx * positions + position) * outputChannels + cOutput :
+                        (batchIdx * outputChannels + cOutput) * positions + position;
+
+                    outputData[outputIndex] = boost::numeric_cast<InputType>(activation(sum));
+                }
+            }
+        }
+    });
+}
+
 } //namespace armnn
@@ -24,6 +24,25 @@ ElementwiseFunction<Functor>::ElementwiseFunction(const TensorShape& inShape0,
     BroadcastLoop(inShape0, inShape1, outShape).Unroll(Functor(), 0, inData0, inData1, outData);
 }
 
+template <typename Functor>
+ElementwiseFunction<Functor>::ElementwiseFunction(const TensorShape& inShape0,
+                                                   const TensorShape& inShape1,
+                                                   const TensorShape& outShape,
+                                                   armnn::Decoder<InType>& inData0,
+                                                   armnn::Decoder<InType>& inData1,
+                                                   armnn::Encoder<OutType>& outData,
+                                                   unsigned int begin,
+                                                   unsigned int end)
+{
+    BroadcastLoop(inShape0, inShape1, outShape).UnrollRange(Functor(), begin, end, inData0, inData1, outData);
+}
+
+template <typename Functor>
+unsigned int ElementwiseFunction<Functor>::GetSplitSize(const TensorShape& outShape)
+{
+    return outShape.GetNumDimensions() > 0 ? outShape[BroadcastLoop::GetSplitDimension(outShape)] : 1;
+}
+
 } //namespace armnn
 
 template struct armnn::ElementwiseFunction<std::plus<float>>;
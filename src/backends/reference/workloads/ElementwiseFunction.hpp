@@ -23,6 +23,20 @@ struct ElementwiseFunction
                         armnn::Decoder<InType>& inData0,
                         armnn::Decoder<InType>& inData1,
                         armnn::Encoder<OutType>& outData);
+
+    /// Computes the part of the output whose index along its outermost dimension of more than one element is in
+    /// [begin, end). Disjoint parts can be computed concurrently, given iterators of their own.
+    ElementwiseFunction(const TensorShape& inShape0,
+                        const TensorShape& inShape1,
+                        const TensorShape& outShape,
+                        armnn::Decoder<InType>& inData0,
+                        armnn::Decoder<InType>& inData1,
+                        armnn::Encoder<OutType>& outData,
+                        unsigned int begin,
+                        unsigned int end);
+
+    /// Size of the dimension of outShape the parts computed by the constructor above are taken along.
+    static unsigned int GetSplitSize(const TensorShape& outShape);
 };
 
 } //namespace armnn
@@ -5,7 +5,47 @@
 
 #include "FullyConnected.hpp"
 
+#include "ConvImpl.hpp"
+
+#include <backendsCommon/ThreadPool.hpp>
+
 #include <boost/assert.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+// Copies the weights into a row-major [outputs][inputs] matrix, subtracting the given offset from each of them.
+template<typename T, typename PackedType>
+std::vector<PackedType> PackWeights(const T*                 weightData,
+                                    const armnn::TensorInfo& weightTensorInfo,
+                                    bool                     transposeWeights,
+                                    PackedType               offset)
+{
+    BOOST_ASSERT(weightTensorInfo.GetNumDimensions() == 2);
+
+    std::vector<PackedType> packed(weightTensorInfo.GetNumElements());
+
+    // When transposeWeights is set the weights are already [outputs][inputs], otherwise [inputs][outputs].
+    const unsigned int N = weightTensorInfo.GetShape()[transposeWeights ? 0 : 1];
+    const unsigned int K = weightTensorInfo.GetShape()[transposeWeights ? 1 : 0];
+
+    for (unsigned int channelOutput = 0; channelOutput < N; channelOutput++)
+    {
+        for (unsigned int channelInput = 0; channelInput < K; channelInput++)
+        {
+            const T weight = transposeWeights ? weightData[channelOutput * K + channelInput]
+                                              : weightData[channelInput * N + channelOutput];
+            packed[channelOutput * K + channelInput] = weight - offset;
+        }
+    }
+    return packed;
+}
+
+} // anonymous namespace
 
 namespace armnn
 {
@@ -16,7 +56,8 @@ void FullyConnected(const float*      inputData,
                     const TensorInfo& outputTensorInfo,
                     const float*      weightData,
                     const float*      biasData,
-                    bool              transposeWeights)
+                    bool              transposeWeights,
+                    const FusedActivation& activation)
 {
     unsigned int N = outputTensorInfo.GetShape()[1]; // Outputs Vector Size.
 
@@ -28,10 +69,14 @@ void FullyConnected(const float*      inputData,
         K *= inputTensorInfo.GetShape()[i];
     }
 
-    for (unsigned int n = 0; n < inputTensorInfo.GetShape()[0]; n++)
+    // Every output is a dot product of its own, so they can be shared out between threads.
+    ParallelFor(inputTensorInfo.GetShape()[0] * N, K, [&](unsigned int begin, unsigned int end)
     {
-        for (unsigned int channelOutput = 0; channelOutput < N; channelOutput++)
+        for (unsigned int index = begin; index < end; index++)
         {
+            const unsigned int n             = index / N;
+            const unsigned int channelOutput = index % N;
+
             float outval = 0.f;
 
             for (unsigned int channelInput = 0; channelInput < K; channelInput++)
@@ -54,9 +99,83 @@ void FullyConnected(const float*      inputData,
                 outval += biasData[channelOutput];
             }
 
-            outputData[n * N + channelOutput] = outval;
+            outputData[n * N + channelOutput] = activation(outval);
         }
+    });
+}
+
+std::vector<float> PackFullyConnectedWeights(const float*      weightData,
+                                             const TensorInfo& weightTensorInfo,
+                                             bool              transposeWeights)
+{
+    return PackWeights(weightData, weightTensorInfo, transposeWeights, 0.0f);
+}
+
+std::vector<int32_t> PackFullyConnectedWeights(const uint8_t*    weightData,
+                                               const TensorInfo& weightTensorInfo,
+                                               bool              transposeWeights)
+{
+    return PackWeights(weightData, weightTensorInfo, transposeWeights, weightTensorInfo.GetQuantizationOffset());
+}
+
+void FullyConnected(const uint8_t*    inputData,
+                    uint8_t*          outputData,
+                    const TensorInfo& inputTensorInfo,
+                    const TensorInfo& outputTensorInfo,
+                    const int32_t*    weightData,
+                    float             weightScale,
+                    const int32_t*    biasData,
+                    const FusedActivation& activation)
+{
+    unsigned int N = outputTensorInfo.GetShape()[1]; // Outputs Vector Size.
+
+    BOOST_ASSERT(inputTensorInfo.GetNumDimensions() > 1); // Needs some data.
+
+    unsigned int K = 1; // Total number of activations in the input.
+    for (unsigned int i = 1; i < inputTensorInfo.GetNumDimensions(); i++)
+    {
+        K *= inputTensorInfo.GetShape()[i];
     }
+
+    const int32_t inputOffset  = inputTensorInfo.GetQuantizationOffset();
+    const int32_t outputOffset = outputTensorInfo.GetQuantizationOffset();
+
+    // The accumulators are in the quantization of inputScale * weightScale.
+    const float multiplier = inputTensorInfo.GetQuantizationScale() * weightScale /
+                             outputTensorInfo.GetQuantizationScale();
+    const bool fixedPoint = multiplier < 1.0f;
+    const QuantizedMultiplierSmallerThanOne quantizedMultiplier(fixedPoint ? multiplier : 0.0f);
+
+    ParallelFor(inputTensorInfo.GetShape()[0] * N, K, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int index = begin; index < end; index++)
+        {
+            const unsigned int n             = index / N;
+            const unsigned int channelOutput = index % N;
+
+            const uint8_t* input   = inputData + n * K;
+            const int32_t* weights = weightData + channelOutput * K;
+
+            int32_t sum = 0;
+            for (unsigned int channelInput = 0; channelInput < K; channelInput++)
+            {
+                sum += weights[channelInput] * (input[channelInput] - inputOffset);
+            }
+
+            if (biasData)
+            {
+                sum += biasData[channelOutput];
+            }
+
+            // Rescales with the same fixed-point arithmetic as quantized convolution when possible.
+            int32_t result = fixedPoint ?
+                quantizedMultiplier * sum :
+                static_cast<int32_t>(std::round(multiplier * boost::numeric_cast<float>(sum)));
+            result = std::min<int32_t>(std::max<int32_t>(result + outputOffset, 0), 255);
+
+            outputData[n * N + channelOutput] = static_cast<uint8_t>(activation(result));
+        }
+    });
 }
 
 } //namespace armnn
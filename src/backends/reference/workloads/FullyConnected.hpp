@@ -5,8 +5,12 @@
 
 #pragma once
 
+#include "Activation.hpp"
+
 #include <armnn/Tensor.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
@@ -17,6 +21,30 @@ void FullyConnected(const float*      inputData,
                     const TensorInfo& outputTensorInfo,
                     const float*      weightData,
                     const float*      biasData,
-                    bool              transposeWeights);
+                    bool              transposeWeights,
+                    const FusedActivation& activation = FusedActivation());
+
+/// Returns a copy of the weights as a row-major [outputs][inputs] matrix, the layout FullyConnected reads
+/// contiguously when transposeWeights is set.
+std::vector<float> PackFullyConnectedWeights(const float*      weightData,
+                                             const TensorInfo& weightTensorInfo,
+                                             bool              transposeWeights);
+
+/// Quantized overload of PackFullyConnectedWeights which also subtracts the weight offset.
+std::vector<int32_t> PackFullyConnectedWeights(const uint8_t*    weightData,
+                                               const TensorInfo& weightTensorInfo,
+                                               bool              transposeWeights);
+
+/// Performs a quantized matrix multiplication, accumulating in int32, and optionally adds a bias. The weights must
+/// come from the quantized PackFullyConnectedWeights and the bias must be quantized with the product of the input
+/// and weight scales.
+void FullyConnected(const uint8_t*    inputData,
+                    uint8_t*          outputData,
+                    const TensorInfo& inputTensorInfo,
+                    const TensorInfo& outputTensorInfo,
+                    const int32_t*    weightData,
+                    float             weightScale,
+                    const int32_t*    biasData,
+                    const FusedActivation& activation = FusedActivation());
 
 } //namespace armnn
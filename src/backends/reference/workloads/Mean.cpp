@@ -6,60 +6,93 @@
 #include "Mean.hpp"
 #include "backendsCommon/WorkloadData.hpp"
 
+#include <armnn/TypesUtils.hpp>
+
+#include <backendsCommon/ThreadPool.hpp>
+
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <functional>
 #include <limits>
+#include <numeric>
 
 namespace armnn
 {
-bool NextIndex(const unsigned int numDims, const armnn::TensorShape& dims, std::vector<unsigned int>& current)
+// Calls accumulate(outputIndex, inputIndex) for every element of the input, where outputIndex is the element of the
+// reduced tensor it contributes to. The elements reduced into an output are visited in increasing order of their
+// index, and each output is handled by a single thread, so the results do not depend on the number of threads.
+template <typename Accumulate>
+void ForEachReducedElement(const armnn::TensorShape& dims,
+                           const std::vector<unsigned int>& axis,
+                           Accumulate accumulate)
 {
-    unsigned int carry = 1;
+    const unsigned int numDims = dims.GetNumDimensions();
 
+    std::vector<unsigned int> keptDims;
+    std::vector<unsigned int> keptStrides;
+    std::vector<unsigned int> reducedDims;
+    std::vector<unsigned int> reducedStrides;
+
+    unsigned int stride = 1;
     for (unsigned int idx = numDims; idx-- > 0; )
     {
-        unsigned int current_val = current[idx] + carry;
-        if (dims[idx] == current_val)
+        if (std::find(axis.begin(), axis.end(), idx) != axis.end())
         {
-            current[idx] = 0;
+            reducedDims.insert(reducedDims.begin(), dims[idx]);
+            reducedStrides.insert(reducedStrides.begin(), stride);
         }
         else
         {
-            current[idx] = current_val;
-            carry = 0;
-            break;
+            keptDims.insert(keptDims.begin(), dims[idx]);
+            keptStrides.insert(keptStrides.begin(), stride);
         }
+        stride *= dims[idx];
+    }
+
+    const unsigned int numOutputs = std::accumulate(keptDims.begin(), keptDims.end(), 1u, std::multiplies<>());
+    const unsigned int numReduced = std::accumulate(reducedDims.begin(), reducedDims.end(), 1u, std::multiplies<>());
+    if (numOutputs == 0 || numReduced == 0)
+    {
+        return;
     }
-    return (carry == 0);
-}
 
-std::size_t ReducedOutputOffset(const unsigned int numDims, const armnn::TensorShape& dims,
-                                std::vector<unsigned int>& index, const unsigned int numAxis,
-                                const std::vector<unsigned int>& axis) {
-    std::size_t offset = 0;
-    for (unsigned int idx = 0; idx < numDims; ++idx)
+    ParallelFor(numOutputs, numReduced, [&](unsigned int begin, unsigned int end)
     {
-        bool isAxis = false;
-        if (!axis.empty())
+        std::vector<unsigned int> reducedIndex(reducedDims.size());
+
+        for (unsigned int outputIndex = begin; outputIndex < end; ++outputIndex)
         {
-            for (unsigned int axisIdx = 0; axisIdx < numAxis; ++axisIdx)
+            // Offset of the first input element reduced into this output.
+            unsigned int inputIndex = 0;
+            unsigned int remainder = outputIndex;
+            for (size_t idx = keptDims.size(); idx-- > 0; )
+            {
+                inputIndex += (remainder % keptDims[idx]) * keptStrides[idx];
+                remainder /= keptDims[idx];
+            }
+
+            std::fill(reducedIndex.begin(), reducedIndex.end(), 0u);
+            for (unsigned int count = 0; count < numReduced; ++count)
             {
-                if (idx == axis[axisIdx])
+                accumulate(outputIndex, inputIndex);
+
+                // Steps to the next element along the reduced dimensions, innermost first.
+                for (size_t idx = reducedDims.size(); idx-- > 0; )
                 {
-                    isAxis = true;
-                    break;
+                    if (++reducedIndex[idx] < reducedDims[idx])
+                    {
+                        inputIndex += reducedStrides[idx];
+                        break;
+                    }
+                    inputIndex -= (reducedDims[idx] - 1) * reducedStrides[idx];
+                    reducedIndex[idx] = 0;
                 }
             }
         }
-        if (!isAxis)
-        {
-            offset = offset * boost::numeric_cast<size_t>(dims[idx]) + boost::numeric_cast<size_t>(index[idx]);
-        }
-    }
-    return offset;
+    });
 }
 } // namespace
 
@@ -91,13 +124,6 @@ void Mean(const armnn::TensorInfo& inputInfo,
         tempSum[idx] = 0.0f;
     }
 
-    // Initialise temp index.
-    std::vector<unsigned int> tempIndex(inputNumDims);
-    for (unsigned int idx = 0; idx < inputNumDims; ++idx)
-    {
-        tempIndex[idx] = 0;
-    }
-
     std::vector<unsigned int> resolvedAxis = axis;
     if (resolvedAxis.empty())
     {
@@ -109,13 +135,10 @@ void Mean(const armnn::TensorInfo& inputInfo,
     unsigned int numResolvedAxis = boost::numeric_cast<unsigned int>(resolvedAxis.size());
 
     // Iterates through input_data and sum up the reduced axis.
-    for (bool hasNext = true; hasNext; hasNext = NextIndex(inputNumDims, inputDims, tempIndex))
+    ForEachReducedElement(inputDims, resolvedAxis, [&](unsigned int outputIndex, unsigned int inputIndex)
     {
-        size_t inputOffset = ReducedOutputOffset(inputNumDims, inputDims, tempIndex, 0, {});
-        size_t outputOffset = ReducedOutputOffset(inputNumDims, inputDims, tempIndex,
-                                                  numResolvedAxis, resolvedAxis);
-        tempSum[outputOffset] += inputData[inputOffset];
-    }
+        tempSum[outputIndex] += inputData[inputIndex];
+    });
 
     // Takes average by num of elements added to get mean.
     size_t numElementsInAxis = 1;
@@ -133,4 +156,54 @@ void Mean(const armnn::TensorInfo& inputInfo,
         }
     }
 }
+
+void Mean(const armnn::TensorInfo& inputInfo,
+          const armnn::TensorInfo& outputInfo,
+          const std::vector<unsigned int>& axis,
+          const uint8_t* inputData,
+          uint8_t* outputData)
+{
+    unsigned int inputNumDims = inputInfo.GetNumDimensions();
+
+    armnn::TensorShape inputDims = inputInfo.GetShape();
+
+    std::vector<int64_t> tempSum(outputInfo.GetNumElements(), 0);
+
+    std::vector<unsigned int> resolvedAxis = axis;
+    if (resolvedAxis.empty())
+    {
+        for (unsigned int idx = 0; idx < inputNumDims; ++idx)
+        {
+            resolvedAxis.push_back(idx);
+        }
+    }
+    unsigned int numResolvedAxis = boost::numeric_cast<unsigned int>(resolvedAxis.size());
+
+    // Sums the raw quantized values; the input offset is taken off once per output below.
+    ForEachReducedElement(inputDims, resolvedAxis, [&](unsigned int outputIndex, unsigned int inputIndex)
+    {
+        tempSum[outputIndex] += inputData[inputIndex];
+    });
+
+    size_t numElementsInAxis = 1;
+    for (unsigned int idx = 0; idx < numResolvedAxis; ++idx)
+    {
+        numElementsInAxis *= boost::numeric_cast<size_t>(inputDims[resolvedAxis[idx]]);
+    }
+
+    const int64_t count = boost::numeric_cast<int64_t>(numElementsInAxis);
+    for (size_t idx = 0; idx < tempSum.size(); ++idx)
+    {
+        float mean = 0.0f;
+        if (count > 0)
+        {
+            const int64_t sum = tempSum[idx] - count * inputInfo.GetQuantizationOffset();
+            mean = boost::numeric_cast<float>(sum) * inputInfo.GetQuantizationScale() /
+                   boost::numeric_cast<float>(count);
+        }
+        outputData[idx] = Quantize<uint8_t>(mean, outputInfo.GetQuantizationScale(),
+                                            outputInfo.GetQuantizationOffset());
+    }
+}
+
 } //namespace armnn
@@ -17,5 +17,12 @@ void Mean(const TensorInfo& inputInfo,
           const std::vector<unsigned int>& axis,
           const float* inputData,
           float* outputData);
+
+/// Quantized mean. The reduced values are summed in integer arithmetic and only the means are requantized.
+void Mean(const TensorInfo& inputInfo,
+          const TensorInfo& outputInfo,
+          const std::vector<unsigned int>& axis,
+          const uint8_t* inputData,
+          uint8_t* outputData);
 } //namespace armnn
 
@@ -5,6 +5,9 @@
 
 #include "Merger.hpp"
 #include "RefWorkloadUtils.hpp"
+#include "SubTensorRuns.hpp"
+
+#include <algorithm>
 
 namespace armnn
 {
@@ -38,73 +41,62 @@ void CopyValue<uint8_t>(const uint8_t& source, const TensorInfo& sourceInfo, uin
 }
 
 template <typename DataType>
-void Merger(const MergerQueueDescriptor& data)
+void Merger(const MergerQueueDescriptor& data, const std::vector<TensorInfo>& inputInfos)
 {
-    const TensorInfo& outputInfo0 = GetTensorInfo(data.m_Outputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
-    for (unsigned int index = 0 ; index < outputInfo0.GetNumElements(); ++index)
+    for (unsigned int viewIdx = 0; viewIdx < data.m_ViewOrigins.size(); ++viewIdx)
     {
-        unsigned int indices[MaxNumOfTensorDimensions] = { 0 };
-
-        unsigned int indexRemainder = index;
-        unsigned int dimensionStride = outputInfo0.GetNumElements();
-
-        for (unsigned int i = 0; i < outputInfo0.GetNumDimensions(); i++)
+        // The producers of the inputs placed in views of the output have written them there already, in their own
+        // quantization, which is converted in place if it differs from the one of the output.
+        if (data.m_Inputs[viewIdx]->GetParent() == data.m_Outputs[0])
         {
-            dimensionStride /= outputInfo0.GetShape()[i];
-            indices[i] = indexRemainder / dimensionStride; // Use integer division to round down.
-            indexRemainder -= indices[i] * dimensionStride;
+            const TensorInfo& viewInfo = inputInfos[viewIdx];
+            if (viewInfo.GetQuantizationScale() == outputInfo.GetQuantizationScale() &&
+                viewInfo.GetQuantizationOffset() == outputInfo.GetQuantizationOffset())
+            {
+                continue;
+            }
+
+            DataType* outputData = GetOutputTensorData<DataType>(0, data);
+            ForEachSubTensorRun(outputInfo.GetShape(), viewInfo.GetShape(), data.m_ViewOrigins[viewIdx].m_Origin.data(),
+                [&](unsigned int, unsigned int outIndex, unsigned int length)
+                {
+                    for (unsigned int i = outIndex; i < outIndex + length; ++i)
+                    {
+                        CopyValue<DataType>(outputData[i], viewInfo, outputData[i], outputInfo);
+                    }
+                });
+            continue;
         }
 
-        for (unsigned int viewIdx = 0; viewIdx < data.m_ViewOrigins.size(); ++viewIdx)
-        {
-            MergerQueueDescriptor::ViewOrigin const& view = data.m_ViewOrigins[viewIdx];
+        //Split view extents are defined by the size of (the corresponding) input tensor.
+        const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[viewIdx]);
+        BOOST_ASSERT(inputInfo.GetNumDimensions() == outputInfo.GetNumDimensions());
 
-            //Split view extents are defined by the size of (the corresponding) input tensor.
-            const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[viewIdx]);
-            BOOST_ASSERT(inputInfo.GetNumDimensions() == outputInfo0.GetNumDimensions());
+        const DataType* inputData = GetInputTensorData<DataType>(viewIdx, data);
+        DataType* outputData = GetOutputTensorData<DataType>(0, data);
+        const bool sameQuantization = inputInfo.GetQuantizationScale() == outputInfo.GetQuantizationScale() &&
+                                      inputInfo.GetQuantizationOffset() == outputInfo.GetQuantizationOffset();
 
-            // Check all dimensions to see if this element is inside the given input view.
-            bool insideView = true;
-            for (unsigned int i = 0; i < inputInfo.GetNumDimensions(); i++)
+        ForEachSubTensorRun(outputInfo.GetShape(), inputInfo.GetShape(), data.m_ViewOrigins[viewIdx].m_Origin.data(),
+            [&](unsigned int inIndex, unsigned int outIndex, unsigned int length)
             {
-                if (indices[i] < view.m_Origin[i])
-                {
-                    insideView = false;
-                }
-                if (indices[i] >= view.m_Origin[i] + inputInfo.GetShape()[i])
+                if (sameQuantization)
                 {
-                    insideView = false;
+                    std::copy(inputData + inIndex, inputData + inIndex + length, outputData + outIndex);
+                    return;
                 }
-            }
-
-            if (insideView)
-            {
-                unsigned int inIndex = 0;
-                unsigned int dimensionStride = 1;
-
-                for (unsigned int i = inputInfo.GetNumDimensions(); i-- > 0;)
+                for (unsigned int i = 0; i < length; ++i)
                 {
-                    inIndex += dimensionStride * (indices[i] - view.m_Origin[i]);
-                    dimensionStride *= inputInfo.GetShape()[i];
+                    CopyValue<DataType>(inputData[inIndex + i], inputInfo, outputData[outIndex + i], outputInfo);
                 }
-
-                CopyValue<DataType>((GetInputTensorData<DataType>(viewIdx, data))[inIndex],
-                                    GetTensorInfo(data.m_Inputs[viewIdx]),
-                                    (GetOutputTensorData<DataType>(0, data))[index],
-                                    outputInfo0);
-
-                //What should we do if input views overlap on the output tensor?
-                //We could error, take the average, or shm else...
-                //For now just stop after finding first view (input) that matches.
-                break;
-            }
-        }
+            });
     }
 }
 
-template void Merger<float>(const MergerQueueDescriptor& data);
+template void Merger<float>(const MergerQueueDescriptor& data, const std::vector<TensorInfo>& inputInfos);
 
-template void Merger<uint8_t>(const MergerQueueDescriptor& data);
+template void Merger<uint8_t>(const MergerQueueDescriptor& data, const std::vector<TensorInfo>& inputInfos);
 
 } //namespace armnn
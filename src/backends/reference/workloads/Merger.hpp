@@ -8,13 +8,17 @@
 #include <backendsCommon/WorkloadData.hpp>
 #include <armnn/Tensor.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
 template <typename DataType>
 void CopyValue(const DataType& source, const TensorInfo& sourceInfo, DataType& dest, const TensorInfo& destInfo);
 
+/// @param inputInfos - The tensor infos of the inputs, which may be quantized differently from the views of the output
+///                     they are written into.
 template <typename DataType>
-void Merger(const MergerQueueDescriptor& data);
+void Merger(const MergerQueueDescriptor& data, const std::vector<TensorInfo>& inputInfos);
 
 } //namespace armnn
@@ -4,13 +4,18 @@
 //
 
 #include "Pooling2d.hpp"
+#include "ConvImpl.hpp"
 #include "TensorBufferArrayView.hpp"
 
 #include <armnn/Exceptions.hpp>
 #include <armnn/Types.hpp>
+#include <armnn/TypesUtils.hpp>
+
+#include <backendsCommon/ThreadPool.hpp>
 
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <cmath>
 #include <limits>
 #include <algorithm>
 #include <functional>
@@ -133,6 +138,25 @@ namespace
             return false;
         }
     }
+
+    /// Integer square root, rounded down.
+    int64_t SquareRoot(int64_t value)
+    {
+        int64_t root = 0;
+        for (int64_t bit = int64_t(1) << 62; bit != 0; bit >>= 2)
+        {
+            if (value >= root + bit)
+            {
+                value -= root + bit;
+                root = (root >> 1) + bit;
+            }
+            else
+            {
+                root >>= 1;
+            }
+        }
+        return root;
+    }
 }
 
 using namespace armnnUtils;
@@ -182,10 +206,17 @@ void Pooling2d(const float* in,
         throw armnn::InvalidArgumentException("Unsupported padding type");
     }
 
-    for (int n = 0; n < batchSize; n++)
+    // Each channel of each batch is pooled on its own, so they can be shared out between threads.
+    const unsigned int numPlanes    = boost::numeric_cast<unsigned int>(batchSize * channels);
+    const unsigned int workPerPlane =
+        boost::numeric_cast<unsigned int>(heightOutput * widthOutput * poolHeight * poolWidth);
+    ParallelFor(numPlanes, workPerPlane, [&](unsigned int begin, unsigned int end)
     {
-        for (int c = 0; c < channels; c++)
+        for (unsigned int plane = begin; plane < end; plane++)
         {
+            const int n = boost::numeric_cast<int>(plane) / channels;
+            const int c = boost::numeric_cast<int>(plane) % channels;
+
             for (int yOutput = 0; yOutput < heightOutput; yOutput++)
             {
                 for (int xOutput = 0; xOutput < widthOutput; xOutput++)
@@ -246,7 +277,153 @@ void Pooling2d(const float* in,
                 }
             }
         }
+    });
+}
+
+void Pooling2d(const uint8_t* in,
+               uint8_t* out,
+               const TensorInfo& inputInfo,
+               const TensorInfo& outputInfo,
+               const Pooling2dDescriptor& params)
+{
+    const DataLayoutIndexed dataLayout = params.m_DataLayout;
+    auto channelsIndex = dataLayout.GetChannelsIndex();
+    auto heightIndex = dataLayout.GetHeightIndex();
+    auto widthIndex = dataLayout.GetWidthIndex();
+
+    const int batchSize    = boost::numeric_cast<int>(outputInfo.GetShape()[0]);
+    const int channels     = boost::numeric_cast<int>(outputInfo.GetShape()[channelsIndex]);
+    const int heightOutput = boost::numeric_cast<int>(outputInfo.GetShape()[heightIndex]);
+    const int widthOutput  = boost::numeric_cast<int>(outputInfo.GetShape()[widthIndex]);
+    const int heightInput  = boost::numeric_cast<int>(inputInfo.GetShape()[heightIndex]);
+    const int widthInput   = boost::numeric_cast<int>(inputInfo.GetShape()[widthIndex]);
+    const int padLeft      = boost::numeric_cast<int>(params.m_PadLeft);
+    const int padRight     = boost::numeric_cast<int>(params.m_PadRight);
+    const int padTop       = boost::numeric_cast<int>(params.m_PadTop);
+    const int padBottom    = boost::numeric_cast<int>(params.m_PadBottom);
+    const int strideX      = boost::numeric_cast<int>(params.m_StrideX);
+    const int strideY      = boost::numeric_cast<int>(params.m_StrideY);
+    const int poolHeight   = boost::numeric_cast<int>(params.m_PoolHeight);
+    const int poolWidth    = boost::numeric_cast<int>(params.m_PoolWidth);
+
+    const int32_t inputOffset  = inputInfo.GetQuantizationOffset();
+    const int32_t outputOffset = outputInfo.GetQuantizationOffset();
+
+    // Rescales a value from the input to the output quantization.
+    const QuantizedMultiplier multiplier(inputInfo.GetQuantizationScale() / outputInfo.GetQuantizationScale());
+
+    TensorBufferArrayView<const uint8_t> input(inputInfo.GetShape(), in, dataLayout);
+    TensorBufferArrayView<uint8_t> output(outputInfo.GetShape(), out, dataLayout);
+
+    if (params.m_PoolType != PoolingAlgorithm::Max &&
+        params.m_PoolType != PoolingAlgorithm::Average &&
+        params.m_PoolType != PoolingAlgorithm::L2)
+    {
+        throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
+    }
+
+    if (params.m_PaddingMethod != PaddingMethod::Exclude &&
+        params.m_PaddingMethod != PaddingMethod::IgnoreValue)
+    {
+        throw armnn::InvalidArgumentException("Unsupported padding type");
     }
+
+    // Each channel of each batch is pooled on its own, so they can be shared out between threads.
+    const unsigned int numPlanes    = boost::numeric_cast<unsigned int>(batchSize * channels);
+    const unsigned int workPerPlane =
+        boost::numeric_cast<unsigned int>(heightOutput * widthOutput * poolHeight * poolWidth);
+    ParallelFor(numPlanes, workPerPlane, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int plane = begin; plane < end; plane++)
+        {
+            const int n = boost::numeric_cast<int>(plane) / channels;
+            const int c = boost::numeric_cast<int>(plane) % channels;
+
+            for (int yOutput = 0; yOutput < heightOutput; yOutput++)
+            {
+                for (int xOutput = 0; xOutput < widthOutput; xOutput++)
+                {
+                    int hstart = (yOutput * strideY) - padTop;
+                    int wstart = (xOutput * strideX) - padLeft;
+                    int hend = hstart + poolHeight;
+                    int wend = wstart + poolWidth;
+
+                    // See the float implementation for how the pooling region and its size are determined.
+                    hend = std::min(hend, heightInput + padBottom);
+                    wend = std::min(wend, widthInput + padRight);
+
+                    // Padding is a real zero, i.e. zero once the input offset has been subtracted.
+                    int32_t result = params.m_PoolType == PoolingAlgorithm::Max ?
+                        std::numeric_limits<int32_t>::lowest() : 0;
+                    int64_t poolAreaSize = (hend - hstart) * (wend - wstart);
+
+                    if (OnPaddingOnly(hstart, hend, heightInput, padBottom) ||
+                        OnPaddingOnly(wstart, wend, widthInput, padRight))
+                    {
+                        result = 0;
+                    }
+
+                    bool clamped = ClampRange(wstart, wend, widthInput);
+                    clamped |= ClampRange(hstart, hend, heightInput);
+
+                    if (clamped && params.m_PaddingMethod == PaddingMethod::Exclude)
+                    {
+                        poolAreaSize = (hend - hstart) * (wend - wstart);
+                    }
+
+                    for (auto yInput = hstart; yInput < hend; yInput++)
+                    {
+                        for (auto xInput = wstart; xInput < wend; xInput++)
+                        {
+                            const int32_t inval = input.Get(boost::numeric_cast<unsigned int>(n),
+                                                            boost::numeric_cast<unsigned int>(c),
+                                                            boost::numeric_cast<unsigned int>(yInput),
+                                                            boost::numeric_cast<unsigned int>(xInput)) - inputOffset;
+
+                            switch (params.m_PoolType)
+                            {
+                                case PoolingAlgorithm::Max:
+                                    result = std::max(result, inval);
+                                    break;
+                                case PoolingAlgorithm::Average:
+                                    result += inval;
+                                    break;
+                                case PoolingAlgorithm::L2:
+                                default:
+                                    result += inval * inval;
+                                    break;
+                            }
+                        }
+                    }
+
+                    int32_t scaledResult;
+                    switch (params.m_PoolType)
+                    {
+                        case PoolingAlgorithm::Max:
+                            scaledResult = multiplier.Apply(result);
+                            break;
+                        case PoolingAlgorithm::Average:
+                            scaledResult = multiplier.Apply(result, poolAreaSize);
+                            break;
+                        case PoolingAlgorithm::L2:
+                        default:
+                        {
+                            // The root of the mean square is taken with 15 fractional bits.
+                            const int64_t meanSquare = (static_cast<int64_t>(result) << 30) / poolAreaSize;
+                            scaledResult = multiplier.Apply(SquareRoot(meanSquare), 1, 15);
+                            break;
+                        }
+                    }
+
+                    output.Get(boost::numeric_cast<unsigned int>(n),
+                               boost::numeric_cast<unsigned int>(c),
+                               boost::numeric_cast<unsigned int>(yOutput),
+                               boost::numeric_cast<unsigned int>(xOutput)) =
+                        static_cast<uint8_t>(std::min(std::max(scaledResult + outputOffset, 0), 255));
+                }
+            }
+        }
+    });
 }
 
 } //namespace armnn
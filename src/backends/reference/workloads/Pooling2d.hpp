@@ -18,4 +18,12 @@ void Pooling2d(const float* in,
                const TensorInfo& outputInfo,
                const Pooling2dDescriptor& params);
 
+/// Quantized pooling. The window is reduced in int32 on the offset-corrected quantized values and only the result is
+/// rescaled to the output quantization, with a fixed-point multiplier.
+void Pooling2d(const uint8_t* in,
+               uint8_t* out,
+               const TensorInfo& inputInfo,
+               const TensorInfo& outputInfo,
+               const Pooling2dDescriptor& params);
+
 } //namespace armnn
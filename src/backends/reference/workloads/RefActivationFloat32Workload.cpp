@@ -14,15 +14,25 @@ namespace armnn
 {
 
 void RefActivationFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefActivationFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefActivationFloat32Workload::Execute(const ActivationQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefActivationFloat32Workload_Execute");
 
-    Activation(GetInputTensorDataFloat(0, m_Data),
-               GetOutputTensorDataFloat(0, m_Data),
-               GetTensorInfo(m_Data.m_Inputs[0]),
-               m_Data.m_Parameters.m_Function,
-               m_Data.m_Parameters.m_A,
-               m_Data.m_Parameters.m_B);
+    Activation(GetInputTensorDataFloat(0, data),
+               GetOutputTensorDataFloat(0, data),
+               GetTensorInfo(data.m_Inputs[0]),
+               data.m_Parameters.m_Function,
+               data.m_Parameters.m_A,
+               data.m_Parameters.m_B);
 }
 
 } //namespace armnn
@@ -15,6 +15,10 @@ class RefActivationFloat32Workload : public Float32Workload<ActivationQueueDescr
 public:
     using Float32Workload<ActivationQueueDescriptor>::Float32Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const ActivationQueueDescriptor& data) const;
 };
 
 } //namespace armnn
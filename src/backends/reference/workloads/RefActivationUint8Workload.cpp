@@ -10,29 +10,36 @@
 
 #include "Profiling.hpp"
 
-#include <vector>
-
 namespace armnn
 {
 
+RefActivationUint8Workload::RefActivationUint8Workload(const ActivationQueueDescriptor& descriptor,
+                                                       const WorkloadInfo& info)
+    : Uint8Workload<ActivationQueueDescriptor>(descriptor, info)
+    , m_Table(MakeActivationTable(info.m_InputTensorInfos[0],
+                                  info.m_OutputTensorInfos[0],
+                                  descriptor.m_Parameters.m_Function,
+                                  descriptor.m_Parameters.m_A,
+                                  descriptor.m_Parameters.m_B)) {}
+
 void RefActivationUint8Workload::Execute() const
 {
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefActivationUint8Workload_Execute");
-
-    const TensorInfo& tensorInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), tensorInfo);
+    Execute(m_Data);
+}
 
-    std::vector<float> results(tensorInfo.GetNumElements());
+void RefActivationUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
 
-    Activation(dequant.data(),
-               results.data(),
-               tensorInfo,
-               m_Data.m_Parameters.m_Function,
-               m_Data.m_Parameters.m_A,
-               m_Data.m_Parameters.m_B);
+void RefActivationUint8Workload::Execute(const ActivationQueueDescriptor& data) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefActivationUint8Workload_Execute");
 
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), GetTensorInfo(m_Data.m_Outputs[0]));
+    Activation(GetInputTensorDataU8(0, data),
+               GetOutputTensorDataU8(0, data),
+               GetTensorInfo(data.m_Inputs[0]),
+               m_Table);
 }
 
 } //namespace armnn
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "Activation.hpp"
+
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
@@ -14,8 +16,14 @@ namespace armnn
 class RefActivationUint8Workload : public Uint8Workload<ActivationQueueDescriptor>
 {
 public:
-    using Uint8Workload<ActivationQueueDescriptor>::Uint8Workload;
+    explicit RefActivationUint8Workload(const ActivationQueueDescriptor& descriptor, const WorkloadInfo& info);
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const ActivationQueueDescriptor& data) const;
+
+    ActivationTable m_Table;
 };
 
 } //namespace armnn
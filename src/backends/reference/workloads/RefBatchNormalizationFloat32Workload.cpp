@@ -21,6 +21,16 @@ RefBatchNormalizationFloat32Workload::RefBatchNormalizationFloat32Workload(
         m_Gamma(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Gamma))) {}
 
 void RefBatchNormalizationFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefBatchNormalizationFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefBatchNormalizationFloat32Workload::Execute(const BatchNormalizationQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefBatchNormalizationFloat32Workload_Execute");
 
@@ -29,10 +39,10 @@ void RefBatchNormalizationFloat32Workload::Execute() const
     const float* gamma = m_Gamma->GetConstTensor<float>();
     const float* beta  = m_Beta->GetConstTensor<float>();
 
-    auto inputData = GetInputTensorDataFloat(0, m_Data);
-    auto outputData = GetOutputTensorDataFloat(0, m_Data);
+    auto inputData = GetInputTensorDataFloat(0, data);
+    auto outputData = GetOutputTensorDataFloat(0, data);
 
-    BatchNormImpl(m_Data, var, mean, gamma, beta, outputData, inputData);
+    BatchNormImpl(data, var, mean, gamma, beta, outputData, inputData);
 }
 
 } //namespace armnn
@@ -17,8 +17,11 @@ public:
     explicit RefBatchNormalizationFloat32Workload(const BatchNormalizationQueueDescriptor& descriptor,
                                                   const WorkloadInfo& info);
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(const BatchNormalizationQueueDescriptor& data) const;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_Mean;
     std::unique_ptr<ScopedCpuTensorHandle> m_Variance;
     std::unique_ptr<ScopedCpuTensorHandle> m_Beta;
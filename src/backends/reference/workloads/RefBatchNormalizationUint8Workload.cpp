@@ -23,25 +23,35 @@ RefBatchNormalizationUint8Workload::RefBatchNormalizationUint8Workload(
          m_Gamma(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Gamma))) {}
 
 void RefBatchNormalizationUint8Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefBatchNormalizationUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefBatchNormalizationUint8Workload::Execute(const BatchNormalizationQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefBatchNormalizationUint8Workload_Execute");
 
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
+    const TensorInfo& inputInfo0 = GetTensorInfo(data.m_Inputs[0]);
     const TensorInfo& varInfo = GetTensorInfo(m_Variance.get());
     const TensorInfo& meanInfo = GetTensorInfo(m_Mean.get());
     const TensorInfo& gammaInfo = GetTensorInfo(m_Gamma.get());
     const TensorInfo& betaInfo = GetTensorInfo(m_Beta.get());
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
-    auto input = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo0);
+    auto input = Dequantize(GetInputTensorDataU8(0, data), inputInfo0);
     auto var = Dequantize(m_Variance->GetConstTensor<uint8_t>(), varInfo);
     auto mean = Dequantize(m_Mean->GetConstTensor<uint8_t>(), meanInfo);
     auto gamma = Dequantize(m_Gamma->GetConstTensor<uint8_t>(), gammaInfo);
     auto beta = Dequantize(m_Beta->GetConstTensor<uint8_t>(), betaInfo);
 
     std::vector<float> results(outputInfo.GetNumElements());
-    BatchNormImpl(m_Data, var.data(), mean.data(), gamma.data(), beta.data(), results.data(), input.data());
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), outputInfo);
+    BatchNormImpl(data, var.data(), mean.data(), gamma.data(), beta.data(), results.data(), input.data());
+    Quantize(GetOutputTensorDataU8(0, data), results.data(), outputInfo);
 }
 
 } //namespace armnn
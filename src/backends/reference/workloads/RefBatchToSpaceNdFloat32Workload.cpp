@@ -12,16 +12,26 @@ namespace armnn
 {
 
 void RefBatchToSpaceNdFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefBatchToSpaceNdFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefBatchToSpaceNdFloat32Workload::Execute(const BatchToSpaceNdQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefBatchToSpaceNdFloat32Workload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    const float* inputData = GetInputTensorDataFloat(0, m_Data);
-    float* outputData = GetOutputTensorDataFloat(0, m_Data);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
+    const float* inputData = GetInputTensorDataFloat(0, data);
+    float* outputData = GetOutputTensorDataFloat(0, data);
 
-    BatchToSpaceNd(m_Data.m_Parameters.m_DataLayout, inputInfo, outputInfo, m_Data.m_Parameters.m_BlockShape,
-                   m_Data.m_Parameters.m_Crops, inputData, outputData);
+    BatchToSpaceNd(data.m_Parameters.m_DataLayout, inputInfo, outputInfo, data.m_Parameters.m_BlockShape,
+                   data.m_Parameters.m_Crops, inputData, outputData);
 }
 
 
@@ -17,6 +17,10 @@ public:
     using Float32Workload<BatchToSpaceNdQueueDescriptor>::Float32Workload;
 
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const BatchToSpaceNdQueueDescriptor& data) const;
 };
 
 } // namespace armnn
\ No newline at end of file
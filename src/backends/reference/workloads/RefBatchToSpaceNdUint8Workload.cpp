@@ -12,18 +12,28 @@ namespace armnn
 {
 
 void RefBatchToSpaceNdUint8Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefBatchToSpaceNdUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefBatchToSpaceNdUint8Workload::Execute(const BatchToSpaceNdQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefBatchToSpaceNdUint8Workload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    auto dequantizedInputData = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
+    auto dequantizedInputData = Dequantize(GetInputTensorDataU8(0, data), inputInfo);
 
     std::vector<float> results(outputInfo.GetNumElements());
-    BatchToSpaceNd(m_Data.m_Parameters.m_DataLayout, inputInfo, outputInfo, m_Data.m_Parameters.m_BlockShape,
-                   m_Data.m_Parameters.m_Crops, dequantizedInputData.data(), results.data());
+    BatchToSpaceNd(data.m_Parameters.m_DataLayout, inputInfo, outputInfo, data.m_Parameters.m_BlockShape,
+                   data.m_Parameters.m_Crops, dequantizedInputData.data(), results.data());
 
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), outputInfo);
+    Quantize(GetOutputTensorDataU8(0, data), results.data(), outputInfo);
 }
 
 } //namespace armnn
\ No newline at end of file
@@ -18,6 +18,10 @@ public:
     using Uint8Workload<BatchToSpaceNdQueueDescriptor>::Uint8Workload;
 
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const BatchToSpaceNdQueueDescriptor& data) const;
 };
 
 } // namespace armnn
\ No newline at end of file
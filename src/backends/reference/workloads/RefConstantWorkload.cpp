@@ -29,7 +29,8 @@ void RefConstantWorkload<DataType>::Execute() const
     // may not be worth the effort (skipping a memory copy in the first inference).
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConstantWorkload_Execute");
 
-    if (!m_RanOnce)
+    // A view into the output of a merger is filled every time, as the memory of that tensor may be imported.
+    if (!m_RanOnce || this->m_Data.m_Outputs[0]->GetParent())
     {
         const ConstantQueueDescriptor& data = this->m_Data;
 
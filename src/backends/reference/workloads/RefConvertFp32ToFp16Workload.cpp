@@ -15,14 +15,24 @@ namespace armnn
 {
 
 void RefConvertFp32ToFp16Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefConvertFp32ToFp16Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefConvertFp32ToFp16Workload::Execute(const ConvertFp32ToFp16QueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConvertFp32ToFp16Workload_Execute");
 
-    const float* const input = GetInputTensorDataFloat(0, m_Data);
-    Half*  const output = GetOutputTensorDataHalf(0, m_Data);
+    const float* const input = GetInputTensorDataFloat(0, data);
+    Half*  const output = GetOutputTensorDataHalf(0, data);
 
     // convert Fp32 input to Fp16 output
-    unsigned int numElements = GetTensorInfo(m_Data.m_Inputs[0]).GetNumElements();
+    unsigned int numElements = GetTensorInfo(data.m_Inputs[0]).GetNumElements();
     armnnUtils::FloatingPointConverter::ConvertFloat32To16(input, numElements, output);
 }
 
@@ -15,21 +15,43 @@ namespace armnn
 RefConvolution2dFloat32Workload::RefConvolution2dFloat32Workload(
     const Convolution2dQueueDescriptor& descriptor, const WorkloadInfo& info)
         : Float32Workload<Convolution2dQueueDescriptor>(descriptor, info),
-          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
+          m_WeightInfo(descriptor.m_Weight->GetTensorInfo()),
           m_Bias(descriptor.m_Parameters.m_BiasEnabled
-                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr) {}
+                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr),
+          m_FusedActivation(descriptor.m_FusedActivation, info.m_OutputTensorInfos[0])
+{
+    const ConstCpuTensorHandle& weight = *descriptor.m_Weight;
+    const DataLayout dataLayout = descriptor.m_Parameters.m_DataLayout;
+    m_PackedWeight = GetDerivedData<std::vector<float>>(weight,
+        std::string("Im2ColFilter/") + GetDataLayoutName(dataLayout),
+        [&weight, dataLayout]()
+        {
+            std::vector<float> packedWeight;
+            PackIm2ColFilter(weight.GetConstTensor<float>(), 0, weight.GetTensorInfo(), dataLayout, packedWeight);
+            return packedWeight;
+        });
+}
 
 void RefConvolution2dFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefConvolution2dFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefConvolution2dFloat32Workload::Execute(const Convolution2dQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConvolution2dFloat32Workload_Execute");
 
-    const float* inputData  = GetInputTensorDataFloat(0, m_Data);
-    const float* filterData = m_Weight->template GetConstTensor<float>();
-    const float* biasData   = m_Data.m_Parameters.m_BiasEnabled ? m_Bias->template GetConstTensor<float>() : nullptr;
-    const TensorInfo& filterInfo = m_Weight->GetTensorInfo();
+    const float* inputData  = GetInputTensorDataFloat(0, data);
+    const float* biasData   = data.m_Parameters.m_BiasEnabled ? m_Bias->template GetConstTensor<float>() : nullptr;
 
-    ConvImpl<armnn::Convolution2dQueueDescriptor, float, float, float>(
-        m_Data, inputData, 0.0f, 0, filterData, 0.0f, 0, biasData, 0.0f, 0, filterInfo);
+    Im2ColConvImpl<armnn::Convolution2dQueueDescriptor, float, float, float>(
+        data, inputData, 0.0f, 0, m_PackedWeight->data(), 0.0f, biasData, 0.0f, 0, m_WeightInfo,
+        m_FusedActivation);
 }
 
 } //namespace armnn
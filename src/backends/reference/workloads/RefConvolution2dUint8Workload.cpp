@@ -15,28 +15,51 @@ namespace armnn
 RefConvolution2dUint8Workload::RefConvolution2dUint8Workload(
     const Convolution2dQueueDescriptor& descriptor, const WorkloadInfo& info)
         : Uint8Workload<Convolution2dQueueDescriptor>(descriptor, info),
-          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
+          m_WeightInfo(descriptor.m_Weight->GetTensorInfo()),
           m_Bias(descriptor.m_Parameters.m_BiasEnabled
-                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr) {}
+                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr),
+          m_FusedActivation(descriptor.m_FusedActivation, info.m_OutputTensorInfos[0])
+{
+    const ConstCpuTensorHandle& weight = *descriptor.m_Weight;
+    const DataLayout dataLayout = descriptor.m_Parameters.m_DataLayout;
+    const int32_t weightOffset = m_WeightInfo.GetQuantizationOffset();
+    m_PackedWeight = GetDerivedData<std::vector<int32_t>>(weight,
+        std::string("Im2ColFilter/") + GetDataLayoutName(dataLayout) + "/" + std::to_string(weightOffset),
+        [&weight, dataLayout, weightOffset]()
+        {
+            std::vector<int32_t> packedWeight;
+            PackIm2ColFilter(weight.GetConstTensor<uint8_t>(), weightOffset, weight.GetTensorInfo(), dataLayout,
+                             packedWeight);
+            return packedWeight;
+        });
+}
 
 void RefConvolution2dUint8Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefConvolution2dUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefConvolution2dUint8Workload::Execute(const Convolution2dQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConvolution2dUint8Workload_Execute");
 
-    const uint8_t* inputData = GetInputTensorDataU8(0, m_Data);
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const uint8_t* weightsData = m_Weight->template GetConstTensor<uint8_t>();
-    const TensorInfo& weightsInfo = GetTensorInfo(m_Weight.get());
-    const int32_t* biasData = m_Data.m_Parameters.m_BiasEnabled ? m_Bias->template GetConstTensor<int32_t>() : nullptr;
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    const TensorInfo& filterInfo = m_Weight->GetTensorInfo();
+    const uint8_t* inputData = GetInputTensorDataU8(0, data);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const int32_t* biasData = data.m_Parameters.m_BiasEnabled ? m_Bias->template GetConstTensor<int32_t>() : nullptr;
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
-    ConvImpl<armnn::Convolution2dQueueDescriptor, uint8_t, int32_t, int32_t>(
-        m_Data,
+    Im2ColConvImpl<armnn::Convolution2dQueueDescriptor, uint8_t, int32_t, int32_t>(
+        data,
         inputData, inputInfo.GetQuantizationScale(),  inputInfo.GetQuantizationOffset(),
-        weightsData, weightsInfo.GetQuantizationScale(), weightsInfo.GetQuantizationOffset(),
+        m_PackedWeight->data(), m_WeightInfo.GetQuantizationScale(),
         biasData,
-        outputInfo.GetQuantizationScale(), outputInfo.GetQuantizationOffset(), filterInfo);
+        outputInfo.GetQuantizationScale(), outputInfo.GetQuantizationOffset(), m_WeightInfo,
+        m_FusedActivation);
 }
 
 } //namespace armnn
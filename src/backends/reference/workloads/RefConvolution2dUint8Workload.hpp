@@ -5,9 +5,14 @@
 
 #pragma once
 
+#include "Activation.hpp"
+
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace armnn
 {
 
@@ -18,10 +23,17 @@ public:
                                              const WorkloadInfo& info);
 
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
-    std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
+    void Execute(const Convolution2dQueueDescriptor& data) const;
+
+    TensorInfo m_WeightInfo;
+    // Shared by the workloads created from copies of the layer, such as those of the networks prepared for other
+    // batch sizes.
+    std::shared_ptr<const std::vector<int32_t>> m_PackedWeight;
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
+    FusedActivation m_FusedActivation;
 
 };
 
@@ -16,23 +16,35 @@ namespace armnn
 
 template<armnn::DataType DataType>
 void RefDebugWorkload<DataType>::Execute() const
+{
+    Execute(m_Data);
+}
+
+template<armnn::DataType DataType>
+void RefDebugWorkload<DataType>::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+template<armnn::DataType DataType>
+void RefDebugWorkload<DataType>::Execute(const DebugQueueDescriptor& data) const
 {
     using T = ResolveType<DataType>;
 
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, GetName() + "_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
 
-    const T* inputData = GetInputTensorData<T>(0, m_Data);
-    T* outputData = GetOutputTensorData<T>(0, m_Data);
+    const T* inputData = GetInputTensorData<T>(0, data);
+    T* outputData = GetOutputTensorData<T>(0, data);
 
     if (m_Callback)
     {
-        m_Callback(m_Data.m_Guid, m_Data.m_SlotIndex, m_Data.m_Inputs[0]);
+        m_Callback(data.m_Guid, data.m_SlotIndex, data.m_Inputs[0]);
     }
     else
     {
-        Debug(inputInfo, inputData, m_Data.m_Guid, m_Data.m_LayerName, m_Data.m_SlotIndex);
+        Debug(inputInfo, inputData, data.m_Guid, data.m_LayerName, data.m_SlotIndex);
     }
 
     std::memcpy(outputData, inputData, inputInfo.GetNumElements()*sizeof(T));
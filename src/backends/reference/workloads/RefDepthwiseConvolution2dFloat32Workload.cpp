@@ -17,19 +17,30 @@ RefDepthwiseConvolution2dFloat32Workload::RefDepthwiseConvolution2dFloat32Worklo
         : Float32Workload<DepthwiseConvolution2dQueueDescriptor>(descriptor, info),
           m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
           m_Bias(descriptor.m_Parameters.m_BiasEnabled
-                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr) {}
+                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr),
+          m_FusedActivation(descriptor.m_FusedActivation, info.m_OutputTensorInfos[0]) {}
 
 void RefDepthwiseConvolution2dFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefDepthwiseConvolution2dFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefDepthwiseConvolution2dFloat32Workload::Execute(const DepthwiseConvolution2dQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefDepthwiseConvolution2dFloat32Workload_Execute");
 
-    const float* inputData  = GetInputTensorDataFloat(0, m_Data);
+    const float* inputData  = GetInputTensorDataFloat(0, data);
     const float* weightData = m_Weight->template GetConstTensor<float>();
-    const float* biasData   = m_Data.m_Parameters.m_BiasEnabled ? m_Bias->template GetConstTensor<float>() : nullptr;
+    const float* biasData   = data.m_Parameters.m_BiasEnabled ? m_Bias->template GetConstTensor<float>() : nullptr;
     const TensorInfo& filterInfo = m_Weight->GetTensorInfo();
 
     ConvImpl<armnn::DepthwiseConvolution2dQueueDescriptor, float, float, float>
-        (m_Data, inputData, 0.0f, 0, weightData, 0.0f, 0, biasData, 0.0f, 0, filterInfo, true);
+        (data, inputData, 0.0f, 0, weightData, 0.0f, 0, biasData, 0.0f, 0, filterInfo, true, m_FusedActivation);
 }
 
 } //namespace armnn
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "Activation.hpp"
+
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
@@ -18,10 +20,14 @@ public:
                                              const WorkloadInfo& info);
 
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(const DepthwiseConvolution2dQueueDescriptor& data) const;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
+    FusedActivation m_FusedActivation;
 };
 
 } //namespace armnn
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "Activation.hpp"
+
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
@@ -17,10 +19,14 @@ public:
     explicit RefDepthwiseConvolution2dUint8Workload(const DepthwiseConvolution2dQueueDescriptor& descriptor,
                                            const WorkloadInfo& info);
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(const DepthwiseConvolution2dQueueDescriptor& data) const;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
+    FusedActivation m_FusedActivation;
 };
 
 } //namespace armnn
@@ -10,21 +10,31 @@ namespace armnn
 {
 
 void RefDequantizeWorkload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefDequantizeWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefDequantizeWorkload::Execute(const DequantizeQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefDequantizeWorkload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
     const DataType& inputDataType = inputInfo.GetDataType();
 
-    float* outputData = GetOutputTensorData<float>(0, m_Data);
+    float* outputData = GetOutputTensorData<float>(0, data);
 
     switch (inputDataType)
     {
         case DataType::QuantisedAsymm8:
-            Dequantize<uint8_t>(GetInputTensorData<uint8_t>(0, m_Data), outputData, inputInfo);
+            Dequantize<uint8_t>(GetInputTensorData<uint8_t>(0, data), outputData, inputInfo);
             break;
         case DataType::QuantisedSymm16:
-            Dequantize<int16_t>(GetInputTensorData<int16_t>(0, m_Data), outputData, inputInfo);
+            Dequantize<int16_t>(GetInputTensorData<int16_t>(0, data), outputData, inputInfo);
             break;
         default:
             throw InvalidArgumentException("RefDequantizeWorkload: Unsupported input data type");
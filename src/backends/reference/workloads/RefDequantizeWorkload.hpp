@@ -17,6 +17,10 @@ public:
     using BaseWorkload<DequantizeQueueDescriptor>::BaseWorkload;
 
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const DequantizeQueueDescriptor& data) const;
 };
 
 } // namespace armnn
@@ -18,29 +18,39 @@ RefDetectionPostProcessFloat32Workload::RefDetectionPostProcessFloat32Workload(
           m_Anchors(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Anchors))) {}
 
 void RefDetectionPostProcessFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefDetectionPostProcessFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefDetectionPostProcessFloat32Workload::Execute(const DetectionPostProcessQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefDetectionPostProcessUint8Workload_Execute");
 
-    const TensorInfo& boxEncodingsInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& scoresInfo = GetTensorInfo(m_Data.m_Inputs[1]);
+    const TensorInfo& boxEncodingsInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& scoresInfo = GetTensorInfo(data.m_Inputs[1]);
     const TensorInfo& anchorsInfo = GetTensorInfo(m_Anchors.get());
-    const TensorInfo& detectionBoxesInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    const TensorInfo& detectionClassesInfo = GetTensorInfo(m_Data.m_Outputs[1]);
-    const TensorInfo& detectionScoresInfo = GetTensorInfo(m_Data.m_Outputs[2]);
-    const TensorInfo& numDetectionsInfo = GetTensorInfo(m_Data.m_Outputs[3]);
+    const TensorInfo& detectionBoxesInfo = GetTensorInfo(data.m_Outputs[0]);
+    const TensorInfo& detectionClassesInfo = GetTensorInfo(data.m_Outputs[1]);
+    const TensorInfo& detectionScoresInfo = GetTensorInfo(data.m_Outputs[2]);
+    const TensorInfo& numDetectionsInfo = GetTensorInfo(data.m_Outputs[3]);
 
-    const float* boxEncodings = GetInputTensorDataFloat(0, m_Data);
-    const float* scores = GetInputTensorDataFloat(1, m_Data);
+    const float* boxEncodings = GetInputTensorDataFloat(0, data);
+    const float* scores = GetInputTensorDataFloat(1, data);
     const float* anchors = m_Anchors->GetConstTensor<float>();
 
-    float* detectionBoxes = GetOutputTensorData<float>(0, m_Data);
-    float* detectionClasses = GetOutputTensorData<float>(1, m_Data);
-    float* detectionScores = GetOutputTensorData<float>(2, m_Data);
-    float* numDetections = GetOutputTensorData<float>(3, m_Data);
+    float* detectionBoxes = GetOutputTensorData<float>(0, data);
+    float* detectionClasses = GetOutputTensorData<float>(1, data);
+    float* detectionScores = GetOutputTensorData<float>(2, data);
+    float* numDetections = GetOutputTensorData<float>(3, data);
 
     DetectionPostProcess(boxEncodingsInfo, scoresInfo, anchorsInfo,
                          detectionBoxesInfo, detectionClassesInfo,
-                         detectionScoresInfo, numDetectionsInfo, m_Data.m_Parameters,
+                         detectionScoresInfo, numDetectionsInfo, data.m_Parameters,
                          boxEncodings, scores, anchors, detectionBoxes,
                          detectionClasses, detectionScores, numDetections);
 }
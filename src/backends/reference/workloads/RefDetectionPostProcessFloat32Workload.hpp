@@ -17,8 +17,11 @@ public:
     explicit RefDetectionPostProcessFloat32Workload(const DetectionPostProcessQueueDescriptor& descriptor,
                                                     const WorkloadInfo& info);
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(const DetectionPostProcessQueueDescriptor& data) const;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_Anchors;
 };
 
@@ -18,33 +18,43 @@ RefDetectionPostProcessUint8Workload::RefDetectionPostProcessUint8Workload(
           m_Anchors(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Anchors))) {}
 
 void RefDetectionPostProcessUint8Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefDetectionPostProcessUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefDetectionPostProcessUint8Workload::Execute(const DetectionPostProcessQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefDetectionPostProcessUint8Workload_Execute");
 
-    const TensorInfo& boxEncodingsInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& scoresInfo = GetTensorInfo(m_Data.m_Inputs[1]);
+    const TensorInfo& boxEncodingsInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& scoresInfo = GetTensorInfo(data.m_Inputs[1]);
     const TensorInfo& anchorsInfo = GetTensorInfo(m_Anchors.get());
-    const TensorInfo& detectionBoxesInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    const TensorInfo& detectionClassesInfo = GetTensorInfo(m_Data.m_Outputs[1]);
-    const TensorInfo& detectionScoresInfo = GetTensorInfo(m_Data.m_Outputs[2]);
-    const TensorInfo& numDetectionsInfo = GetTensorInfo(m_Data.m_Outputs[3]);
+    const TensorInfo& detectionBoxesInfo = GetTensorInfo(data.m_Outputs[0]);
+    const TensorInfo& detectionClassesInfo = GetTensorInfo(data.m_Outputs[1]);
+    const TensorInfo& detectionScoresInfo = GetTensorInfo(data.m_Outputs[2]);
+    const TensorInfo& numDetectionsInfo = GetTensorInfo(data.m_Outputs[3]);
 
-    const uint8_t* boxEncodingsData = GetInputTensorDataU8(0, m_Data);
-    const uint8_t* scoresData = GetInputTensorDataU8(1, m_Data);
+    const uint8_t* boxEncodingsData = GetInputTensorDataU8(0, data);
+    const uint8_t* scoresData = GetInputTensorDataU8(1, data);
     const uint8_t* anchorsData = m_Anchors->GetConstTensor<uint8_t>();
 
     auto boxEncodings = Dequantize(boxEncodingsData, boxEncodingsInfo);
     auto scores = Dequantize(scoresData, scoresInfo);
     auto anchors = Dequantize(anchorsData, anchorsInfo);
 
-    float* detectionBoxes = GetOutputTensorData<float>(0, m_Data);
-    float* detectionClasses = GetOutputTensorData<float>(1, m_Data);
-    float* detectionScores = GetOutputTensorData<float>(2, m_Data);
-    float* numDetections = GetOutputTensorData<float>(3, m_Data);
+    float* detectionBoxes = GetOutputTensorData<float>(0, data);
+    float* detectionClasses = GetOutputTensorData<float>(1, data);
+    float* detectionScores = GetOutputTensorData<float>(2, data);
+    float* numDetections = GetOutputTensorData<float>(3, data);
 
     DetectionPostProcess(boxEncodingsInfo, scoresInfo, anchorsInfo,
                          detectionBoxesInfo, detectionClassesInfo,
-                         detectionScoresInfo, numDetectionsInfo, m_Data.m_Parameters,
+                         detectionScoresInfo, numDetectionsInfo, data.m_Parameters,
                          boxEncodings.data(), scores.data(), anchors.data(),
                          detectionBoxes, detectionClasses, detectionScores, numDetections);
 }
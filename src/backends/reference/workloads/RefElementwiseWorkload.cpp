@@ -12,6 +12,10 @@
 #include "RefWorkloadUtils.hpp"
 #include "StringMapping.hpp"
 #include <ResolveType.hpp>
+
+#include <backendsCommon/ThreadPool.hpp>
+
+#include <algorithm>
 #include <vector>
 
 namespace armnn
@@ -39,22 +43,65 @@ void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::PostAllocat
 
 template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
 void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::Execute() const
+{
+    // The tensor memory may have moved since PostAllocationConfigure() (e.g. working memory released and
+    // acquired again), so the iterators are re-pointed at the current data before every run.
+    m_Input0->Reset(m_Data.m_Inputs[0]->Map());
+    m_Input1->Reset(m_Data.m_Inputs[1]->Map());
+    m_Output->Reset(m_Data.m_Outputs[0]->Map());
+
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs, *m_Input0, *m_Input1, *m_Output);
+}
+
+template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
+void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::ExecuteAsync(
+    WorkingMemDescriptor& workingMemDescriptor)
+{
+    // The member iterators are shared by all callers, so each run on a working memory gets its own.
+    std::vector<ITensorHandle*>& inputs  = workingMemDescriptor.m_Inputs;
+    std::vector<ITensorHandle*>& outputs = workingMemDescriptor.m_Outputs;
+
+    auto input0 = MakeDecoder<InType>(GetTensorInfo(inputs[0]), inputs[0]->Map());
+    auto input1 = MakeDecoder<InType>(GetTensorInfo(inputs[1]), inputs[1]->Map());
+    auto output = MakeEncoder<OutType>(GetTensorInfo(outputs[0]), outputs[0]->Map());
+
+    Execute(inputs, outputs, *input0, *input1, *output);
+}
+
+template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
+void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::Execute(const std::vector<ITensorHandle*>& inputs,
+                                                                    const std::vector<ITensorHandle*>& outputs,
+                                                                    Decoder<InType>& input0,
+                                                                    Decoder<InType>& input1,
+                                                                    Encoder<OutType>& output) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, StringMapping::Instance().Get(DebugString));
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo0 = GetTensorInfo(inputs[0]);
+    const TensorInfo& inputInfo1 = GetTensorInfo(inputs[1]);
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
 
     const TensorShape& inShape0 = inputInfo0.GetShape();
     const TensorShape& inShape1 = inputInfo1.GetShape();
     const TensorShape& outShape = outputInfo.GetShape();
 
-    ElementwiseFunction<Functor>(inShape0,
-                                 inShape1,
-                                 outShape,
-                                 *m_Input0,
-                                 *m_Input1,
-                                 *m_Output);
+    // The output is split along its outermost dimension and the parts are shared out between threads. Iterators
+    // hold a position, so every part but the first walks the tensors with iterators of its own.
+    const unsigned int splitSize = ElementwiseFunction<Functor>::GetSplitSize(outShape);
+    ParallelFor(splitSize, outputInfo.GetNumElements() / std::max(splitSize, 1u),
+                [&](unsigned int begin, unsigned int end)
+    {
+        if (begin == 0)
+        {
+            ElementwiseFunction<Functor>(inShape0, inShape1, outShape, input0, input1, output, begin, end);
+            return;
+        }
+
+        auto partInput0 = MakeDecoder<InType>(inputInfo0, inputs[0]->Map());
+        auto partInput1 = MakeDecoder<InType>(inputInfo1, inputs[1]->Map());
+        auto partOutput = MakeEncoder<OutType>(outputInfo, outputs[0]->Map());
+
+        ElementwiseFunction<Functor>(inShape0, inShape1, outShape, *partInput0, *partInput1, *partOutput, begin, end);
+    });
 }
 
 } //namespace armnn
@@ -27,16 +27,26 @@ void FakeQuantization(const float* inputData, float* outputData, uint32_t numEle
 }
 
 void RefFakeQuantizationFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefFakeQuantizationFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefFakeQuantizationFloat32Workload::Execute(const FakeQuantizationQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFakeQuantizationFloat32Workload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
 
-    const float* inputData = GetInputTensorDataFloat(0, m_Data);
-    float* outputData = GetOutputTensorDataFloat(0, m_Data);
+    const float* inputData = GetInputTensorDataFloat(0, data);
+    float* outputData = GetOutputTensorDataFloat(0, data);
     FakeQuantization(inputData, outputData, inputInfo.GetNumElements(),
-                     m_Data.m_Parameters.m_Min,
-                     m_Data.m_Parameters.m_Max);
+                     data.m_Parameters.m_Min,
+                     data.m_Parameters.m_Max);
 }
 
 } //namespace armnn
@@ -16,6 +16,10 @@ class RefFakeQuantizationFloat32Workload : public Float32Workload<FakeQuantizati
 public:
     using Float32Workload<FakeQuantizationQueueDescriptor>::Float32Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const FakeQuantizationQueueDescriptor& data) const;
 };
 
 } //namespace armnn
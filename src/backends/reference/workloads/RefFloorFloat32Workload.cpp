@@ -13,13 +13,23 @@ namespace armnn
 {
 
 void RefFloorFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefFloorFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefFloorFloat32Workload::Execute(const FloorQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFloorFloat32Workload_Execute");
 
-    const float* const input = GetInputTensorDataFloat(0, m_Data);
-    float* const output = GetOutputTensorDataFloat(0, m_Data);
+    const float* const input = GetInputTensorDataFloat(0, data);
+    float* const output = GetOutputTensorDataFloat(0, data);
 
-    unsigned int numElements = GetTensorInfo(m_Data.m_Inputs[0]).GetNumElements();
+    unsigned int numElements = GetTensorInfo(data.m_Inputs[0]).GetNumElements();
     for (unsigned int i = 0; i < numElements; ++i)
     {
         output[i] = floorf(input[i]);
@@ -16,6 +16,10 @@ class RefFloorFloat32Workload : public Float32Workload<FloorQueueDescriptor>
 public:
     using Float32Workload<FloorQueueDescriptor>::Float32Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const FloorQueueDescriptor& data) const;
 };
 
 } //namespace armnn
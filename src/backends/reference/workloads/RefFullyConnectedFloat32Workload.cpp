@@ -15,29 +15,48 @@ namespace armnn
 RefFullyConnectedFloat32Workload::RefFullyConnectedFloat32Workload(
     const FullyConnectedQueueDescriptor& descriptor, const WorkloadInfo& info)
         : Float32Workload<FullyConnectedQueueDescriptor>(descriptor, info),
-          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
+          m_PackedWeight(GetDerivedData<std::vector<float>>(*descriptor.m_Weight,
+              descriptor.m_Parameters.m_TransposeWeightMatrix ? "FullyConnectedWeights/Transposed"
+                                                              : "FullyConnectedWeights",
+              [&descriptor]()
+              {
+                  return PackFullyConnectedWeights(descriptor.m_Weight->GetConstTensor<float>(),
+                                                   descriptor.m_Weight->GetTensorInfo(),
+                                                   descriptor.m_Parameters.m_TransposeWeightMatrix);
+              })),
           m_Bias(descriptor.m_Parameters.m_BiasEnabled
-                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr) {}
+                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr),
+          m_FusedActivation(descriptor.m_FusedActivation, info.m_OutputTensorInfos[0]) {}
 
 void RefFullyConnectedFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefFullyConnectedFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefFullyConnectedFloat32Workload::Execute(const FullyConnectedQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFullyConnectedFloat32Workload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
-    float*       outputData = GetOutputTensorDataFloat(0, m_Data);
-    const float* inputData  = GetInputTensorDataFloat(0, m_Data);
-    const float* weightData = m_Weight->GetConstTensor<float>();
-    const float* biasData   = m_Data.m_Parameters.m_BiasEnabled ? m_Bias->GetConstTensor<float>() : nullptr;
+    float*       outputData = GetOutputTensorDataFloat(0, data);
+    const float* inputData  = GetInputTensorDataFloat(0, data);
+    const float* biasData   = data.m_Parameters.m_BiasEnabled ? m_Bias->GetConstTensor<float>() : nullptr;
 
     FullyConnected(inputData,
                    outputData,
                    inputInfo,
                    outputInfo,
-                   weightData,
+                   m_PackedWeight->data(),
                    biasData,
-                   m_Data.m_Parameters.m_TransposeWeightMatrix);
+                   true,
+                   m_FusedActivation);
 }
 
 } //namespace armnn
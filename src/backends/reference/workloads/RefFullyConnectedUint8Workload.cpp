@@ -10,57 +10,51 @@
 
 #include "Profiling.hpp"
 
-#include <vector>
-
 namespace armnn
 {
 RefFullyConnectedUint8Workload::RefFullyConnectedUint8Workload(
     const FullyConnectedQueueDescriptor& descriptor, const WorkloadInfo& info)
      : Uint8Workload<FullyConnectedQueueDescriptor>(descriptor, info),
-        m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
+        m_PackedWeight(GetDerivedData<std::vector<int32_t>>(*descriptor.m_Weight,
+            std::string(descriptor.m_Parameters.m_TransposeWeightMatrix ? "FullyConnectedWeights/Transposed/"
+                                                                        : "FullyConnectedWeights/") +
+                std::to_string(descriptor.m_Weight->GetTensorInfo().GetQuantizationOffset()),
+            [&descriptor]()
+            {
+                return PackFullyConnectedWeights(descriptor.m_Weight->GetConstTensor<uint8_t>(),
+                                                 descriptor.m_Weight->GetTensorInfo(),
+                                                 descriptor.m_Parameters.m_TransposeWeightMatrix);
+            })),
+        m_WeightScale(descriptor.m_Weight->GetTensorInfo().GetQuantizationScale()),
         m_Bias(descriptor.m_Parameters.m_BiasEnabled
-               ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr) {}
+               ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr),
+        m_FusedActivation(descriptor.m_FusedActivation, info.m_OutputTensorInfos[0]) {}
 
 void RefFullyConnectedUint8Workload::Execute() const
 {
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFullyConnectedUint8Workload_Execute");
-
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-
-    const uint8_t* weightData = m_Weight->GetConstTensor<uint8_t>();
-
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo);
-
-    auto weight = Dequantize(weightData, m_Weight->GetTensorInfo());
-
-    std::vector<float> results(outputInfo.GetNumElements());
+    Execute(m_Data);
+}
 
-    if (m_Data.m_Parameters.m_BiasEnabled)
-    {
-        const int32_t* biasData = m_Bias->GetConstTensor<int32_t>();
-        auto           bias     = Dequantize(biasData, m_Bias->GetTensorInfo());
+void RefFullyConnectedUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
 
-        FullyConnected(dequant.data(),
-                       results.data(),
-                       inputInfo,
-                       outputInfo,
-                       weight.data(),
-                       bias.data(),
-                       m_Data.m_Parameters.m_TransposeWeightMatrix);
-    }
-    else
-    {
-        FullyConnected(dequant.data(),
-                       results.data(),
-                       inputInfo,
-                       outputInfo,
-                       weight.data(),
-                       nullptr,
-                       m_Data.m_Parameters.m_TransposeWeightMatrix);
-    }
+void RefFullyConnectedUint8Workload::Execute(const FullyConnectedQueueDescriptor& data) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFullyConnectedUint8Workload_Execute");
 
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), outputInfo);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
+
+    FullyConnected(GetInputTensorDataU8(0, data),
+                   GetOutputTensorDataU8(0, data),
+                   inputInfo,
+                   outputInfo,
+                   m_PackedWeight->data(),
+                   m_WeightScale,
+                   data.m_Parameters.m_BiasEnabled ? m_Bias->GetConstTensor<int32_t>() : nullptr,
+                   m_FusedActivation);
 }
 
 } //namespace armnn
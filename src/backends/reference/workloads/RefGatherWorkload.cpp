@@ -15,18 +15,30 @@ namespace armnn
 
 template <armnn::DataType DataType>
 void RefGatherWorkload<DataType>::Execute() const
+{
+    Execute(m_Data);
+}
+
+template <armnn::DataType DataType>
+void RefGatherWorkload<DataType>::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+template <armnn::DataType DataType>
+void RefGatherWorkload<DataType>::Execute(const GatherQueueDescriptor& data) const
 {
     using T = ResolveType<DataType>;
 
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefGatherWorkload_Execute");
 
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo0 = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& inputInfo1 = GetTensorInfo(data.m_Inputs[1]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
-    const T* paramsData = GetInputTensorData<T>(0, m_Data);
-    const int32_t* indicesData = GetInputTensorData<int32_t>(1, m_Data);
-    T* outputData = GetOutputTensorData<T>(0, m_Data);
+    const T* paramsData = GetInputTensorData<T>(0, data);
+    const int32_t* indicesData = GetInputTensorData<int32_t>(1, data);
+    T* outputData = GetOutputTensorData<T>(0, data);
 
     Gather(inputInfo0, inputInfo1, outputInfo, paramsData, indicesData, outputData);
 }
@@ -28,6 +28,10 @@ public:
     using FirstInputTypedWorkload<GatherQueueDescriptor, DataType>::FirstInputTypedWorkload;
 
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const GatherQueueDescriptor& data) const;
 };
 
 using RefGatherFloat32Workload = RefGatherWorkload<DataType::Float32>;
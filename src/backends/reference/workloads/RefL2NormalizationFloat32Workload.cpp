@@ -18,20 +18,30 @@ namespace armnn
 {
 
 void RefL2NormalizationFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefL2NormalizationFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefL2NormalizationFloat32Workload::Execute(const L2NormalizationQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefL2NormalizationFloat32Workload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
     TensorBufferArrayView<const float> input(inputInfo.GetShape(),
-                                             GetInputTensorDataFloat(0, m_Data),
-                                             m_Data.m_Parameters.m_DataLayout);
+                                             GetInputTensorDataFloat(0, data),
+                                             data.m_Parameters.m_DataLayout);
     TensorBufferArrayView<float> output(outputInfo.GetShape(),
-                                        GetOutputTensorDataFloat(0, m_Data),
-                                        m_Data.m_Parameters.m_DataLayout);
+                                        GetOutputTensorDataFloat(0, data),
+                                        data.m_Parameters.m_DataLayout);
 
-    DataLayoutIndexed dataLayout(m_Data.m_Parameters.m_DataLayout);
+    DataLayoutIndexed dataLayout(data.m_Parameters.m_DataLayout);
 
     const unsigned int batches  = inputInfo.GetShape()[0];
     const unsigned int channels = inputInfo.GetShape()[dataLayout.GetChannelsIndex()];
@@ -17,6 +17,10 @@ public:
     using Float32Workload<L2NormalizationQueueDescriptor>::Float32Workload;
 
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const L2NormalizationQueueDescriptor& data) const;
 };
 
 } //namespace armnn
@@ -196,33 +196,104 @@ RefLstmFloat32Workload::RefLstmFloat32Workload(const LstmQueueDescriptor &descri
     , m_OutputGateBiasTensor          (AssignScopedCpuTensorHandle(descriptor.m_OutputGateBias))
     , m_ProjectionWeightsTensor       (AssignScopedCpuTensorHandle(descriptor.m_ProjectionWeights))
     , m_ProjectionBiasTensor          (AssignScopedCpuTensorHandle(descriptor.m_ProjectionBias))
+    , m_State                         (std::make_unique<SequenceState>())
 {}
 
 void RefLstmFloat32Workload::Execute() const
 {
-    // This is a porting of the LSTM::Eval() method in the Android code base
-    // Refer to: android/frameworks/ml/nn/common/operations/LSTM.cpp
+    Execute(m_Data, m_State.get());
+}
+
+void RefLstmFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor),
+            boost::polymorphic_downcast<SequenceState*>(workingMemDescriptor.m_State.get()));
+}
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
+std::unique_ptr<IWorkloadState> RefLstmFloat32Workload::CreateState() const
+{
+    if (!m_Data.m_Parameters.m_StatefulSequence)
+    {
+        return nullptr;
+    }
+    return std::make_unique<SequenceState>();
+}
+
+void RefLstmFloat32Workload::ResetState()
+{
+    m_State->Reset();
+}
+
+void RefLstmFloat32Workload::Execute(const LstmQueueDescriptor& data, SequenceState* state) const
+{
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
     const TensorShape& inputShape = inputInfo.GetShape();
 
-    float* scratchBuffer  = GetOutputTensorDataFloat(0, m_Data);
-    float* outputStateOut = GetOutputTensorDataFloat(1, m_Data);
-    float* cellStateOut   = GetOutputTensorDataFloat(2, m_Data);
-    float* output         = GetOutputTensorDataFloat(3, m_Data);
+    float* scratchBuffer  = GetOutputTensorDataFloat(0, data);
+    float* outputStateOut = GetOutputTensorDataFloat(1, data);
+    float* cellStateOut   = GetOutputTensorDataFloat(2, data);
+    float* output         = GetOutputTensorDataFloat(3, data);
 
-    const float* inputData     = GetInputTensorDataFloat(0, m_Data);
-    const float* outputStateIn = GetInputTensorDataFloat(1, m_Data);
-    const float* cellStateIn   = GetInputTensorDataFloat(2, m_Data);
+    const float* inputData     = GetInputTensorDataFloat(0, data);
+    const float* outputStateIn = GetInputTensorDataFloat(1, data);
+    const float* cellStateIn   = GetInputTensorDataFloat(2, data);
 
-    const uint32_t nBatch = inputShape[0];
-    const uint32_t nInput = inputShape[1];
+    if (!data.m_Parameters.m_StatefulSequence)
+    {
+        ExecuteStep(data.m_Parameters, inputShape[0], inputShape[1], inputData, outputStateIn, cellStateIn,
+                    scratchBuffer, outputStateOut, cellStateOut, output);
+        return;
+    }
+
+    const uint32_t nTime  = inputShape[0];
+    const uint32_t nBatch = inputShape[1];
+    const uint32_t nInput = inputShape[2];
+
+    const uint32_t nCell   = m_InputToOutputWeightsTensor->GetShape()[0];
+    const uint32_t nOutput = m_RecurrentToOutputWeightsTensor->GetShape()[1];
+
+    BOOST_ASSERT(state != nullptr);
+    std::vector<float>& outputState = state->m_OutputState;
+    std::vector<float>& cellState   = state->m_CellState;
+
+    // The state starts from the inputs after a reset, or if the batch size has changed.
+    if (outputState.size() != nBatch * nOutput || cellState.size() != nBatch * nCell)
+    {
+        outputState.assign(outputStateIn, outputStateIn + nBatch * nOutput);
+        cellState.assign(cellStateIn, cellStateIn + nBatch * nCell);
+    }
+
+    // Each step updates the state in place.
+    for (uint32_t t = 0; t < nTime; t++)
+    {
+        ExecuteStep(data.m_Parameters, nBatch, nInput, inputData + t * nBatch * nInput,
+                    outputState.data(), cellState.data(), scratchBuffer,
+                    outputState.data(), cellState.data(), output + t * nBatch * nOutput);
+    }
+
+    CopyVector(outputState.data(), nBatch * nOutput, outputStateOut);
+    CopyVector(cellState.data(), nBatch * nCell, cellStateOut);
+}
+
+void RefLstmFloat32Workload::ExecuteStep(const LstmDescriptor& parameters,
+                                         uint32_t nBatch,
+                                         uint32_t nInput,
+                                         const float* inputData,
+                                         const float* outputStateIn,
+                                         const float* cellStateIn,
+                                         float* scratchBuffer,
+                                         float* outputStateOut,
+                                         float* cellStateOut,
+                                         float* output) const
+{
+    // This is a porting of the LSTM::Eval() method in the Android code base
+    // Refer to: android/frameworks/ml/nn/common/operations/LSTM.cpp
 
     const uint32_t nCell   = m_InputToOutputWeightsTensor->GetShape()[0];
     const uint32_t nOutput = m_RecurrentToOutputWeightsTensor->GetShape()[1];
 
-    const bool useCifg     = m_Data.m_Parameters.m_CifgEnabled;
-    const bool usePeephole = m_Data.m_Parameters.m_PeepholeEnabled;
+    const bool useCifg     = parameters.m_CifgEnabled;
+    const bool usePeephole = parameters.m_PeepholeEnabled;
 
     // Index the scratch buffers pointers to the global scratch buffer.
     float* inputGateScratch  = nullptr;
@@ -312,9 +383,9 @@ void RefLstmFloat32Workload::Execute() const
     ActivationFunction armnnActivationFunc = ActivationFunction::Sigmoid;
     float a = 0;
     float b = 0;
-    SetActivationParameters(m_Data.m_Parameters.m_ActivationFunc, armnnActivationFunc, a, b);
+    SetActivationParameters(parameters.m_ActivationFunc, armnnActivationFunc, a, b);
 
-    if (m_Data.m_Parameters.m_ActivationFunc > 0)
+    if (parameters.m_ActivationFunc > 0)
     {
         Activation(cellScratch, cellScratch,
                    TensorInfo({nCell, nBatch}, DataType::Float32),
@@ -329,9 +400,9 @@ void RefLstmFloat32Workload::Execute() const
     {
         VectorVectorCwiseProductAccumulate(cellScratch, inputGateScratch, nBatch * nCell, cellStateOut);
     }
-    if (m_Data.m_Parameters.m_ClippingThresCell > 0.0)
+    if (parameters.m_ClippingThresCell > 0.0)
     {
-        ClipVector(cellStateOut, nBatch * nCell, m_Data.m_Parameters.m_ClippingThresCell, cellStateOut);
+        ClipVector(cellStateOut, nBatch * nCell, parameters.m_ClippingThresCell, cellStateOut);
     }
 
     // For each batch and cell: update the output gate.
@@ -344,7 +415,7 @@ void RefLstmFloat32Workload::Execute() const
                TensorInfo({nCell, nBatch}, DataType::Float32),
                ActivationFunction::Sigmoid, 0, 0);
 
-    if (m_Data.m_Parameters.m_ActivationFunc > 0)
+    if (parameters.m_ActivationFunc > 0)
     {
         Activation(cellStateOut, cellScratch,
                    TensorInfo({nCell, nBatch}, DataType::Float32),
@@ -353,7 +424,7 @@ void RefLstmFloat32Workload::Execute() const
     VectorVectorCwiseProduct(outputGateScratch, cellScratch, nBatch * nCell, outputGateScratch);
 
     // For each batch: update the projection and output_state.
-    if (m_Data.m_Parameters.m_ProjectionEnabled)
+    if (parameters.m_ProjectionEnabled)
     {
         if (m_ProjectionBiasTensor)
         {
@@ -363,9 +434,9 @@ void RefLstmFloat32Workload::Execute() const
         MatrixBatchVectorMultiplyAccumulate(m_ProjectionWeightsTensor->GetTensor<float>(),
                                             nOutput, nCell, outputGateScratch, nBatch, output);
 
-        if (m_Data.m_Parameters.m_ClippingThresProj > 0.0)
+        if (parameters.m_ClippingThresProj > 0.0)
         {
-            ClipVector(output, nBatch * nOutput, m_Data.m_Parameters.m_ClippingThresProj, output);
+            ClipVector(output, nBatch * nOutput, parameters.m_ClippingThresProj, output);
         }
     }
     else
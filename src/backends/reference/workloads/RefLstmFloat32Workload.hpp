@@ -10,6 +10,9 @@
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace armnn
 {
 
@@ -19,8 +22,40 @@ public:
     explicit RefLstmFloat32Workload(const LstmQueueDescriptor& descriptor, const WorkloadInfo& info);
 
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+    virtual std::unique_ptr<IWorkloadState> CreateState() const override;
+    virtual void ResetState() override;
 
 private:
+    /// The output and cell states of a stateful sequence, carried from one execution to the next. Empty until the
+    /// first execution after a reset.
+    struct SequenceState : public IWorkloadState
+    {
+        void Reset() override
+        {
+            m_OutputState.clear();
+            m_CellState.clear();
+        }
+
+        std::vector<float> m_OutputState;
+        std::vector<float> m_CellState;
+    };
+
+    /// Runs the workload on the given tensors. The state is only used by stateful sequences.
+    void Execute(const LstmQueueDescriptor& data, SequenceState* state) const;
+
+    /// Runs one time step. The state outputs may be the same memory as the state inputs.
+    void ExecuteStep(const LstmDescriptor& parameters,
+                     uint32_t nBatch,
+                     uint32_t nInput,
+                     const float* inputData,
+                     const float* outputStateIn,
+                     const float* cellStateIn,
+                     float* scratchBuffer,
+                     float* outputStateOut,
+                     float* cellStateOut,
+                     float* output) const;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_InputToInputWeightsTensor;
     std::unique_ptr<ScopedCpuTensorHandle> m_InputToForgetWeightsTensor;
     std::unique_ptr<ScopedCpuTensorHandle> m_InputToCellWeightsTensor;
@@ -38,6 +73,10 @@ private:
     std::unique_ptr<ScopedCpuTensorHandle> m_OutputGateBiasTensor;
     std::unique_ptr<ScopedCpuTensorHandle> m_ProjectionWeightsTensor;
     std::unique_ptr<ScopedCpuTensorHandle> m_ProjectionBiasTensor;
+
+    /// The state of the executions on the tensor handles the workload was created with. Working memories have their
+    /// own (see CreateState()).
+    std::unique_ptr<SequenceState> m_State;
 };
 
 } //namespace armnn
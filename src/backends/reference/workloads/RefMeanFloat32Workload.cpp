@@ -19,15 +19,25 @@ RefMeanFloat32Workload::RefMeanFloat32Workload(const MeanQueueDescriptor& descri
 
 
 void RefMeanFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefMeanFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefMeanFloat32Workload::Execute(const MeanQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefMeanFloat32Workload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    const float* inputData = GetInputTensorDataFloat(0, m_Data);
-    float* outputData = GetOutputTensorDataFloat(0, m_Data);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
+    const float* inputData = GetInputTensorDataFloat(0, data);
+    float* outputData = GetOutputTensorDataFloat(0, data);
 
-    Mean(inputInfo, outputInfo, m_Data.m_Parameters.m_Axis, inputData, outputData);
+    Mean(inputInfo, outputInfo, data.m_Parameters.m_Axis, inputData, outputData);
 }
 
 } //namespace armnn
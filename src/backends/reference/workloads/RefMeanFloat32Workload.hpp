@@ -17,6 +17,10 @@ class RefMeanFloat32Workload : public Float32Workload<MeanQueueDescriptor>
 public:
     explicit RefMeanFloat32Workload (const MeanQueueDescriptor& descriptor, const WorkloadInfo& info);
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const MeanQueueDescriptor& data) const;
 };
 
 }//namespace armnn
@@ -10,8 +10,6 @@
 
 #include "Profiling.hpp"
 
-#include <vector>
-
 namespace armnn
 {
 
@@ -21,18 +19,23 @@ RefMeanUint8Workload::RefMeanUint8Workload(const MeanQueueDescriptor& descriptor
 
 void RefMeanUint8Workload::Execute() const
 {
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefMeanUint8Workload_Execute");
-
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    Execute(m_Data);
+}
 
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo);
+void RefMeanUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
 
-    std::vector<float> results(outputInfo.GetNumElements());
+void RefMeanUint8Workload::Execute(const MeanQueueDescriptor& data) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefMeanUint8Workload_Execute");
 
-    Mean(inputInfo, outputInfo, m_Data.m_Parameters.m_Axis, dequant.data(), results.data());
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), outputInfo);
+    Mean(inputInfo, outputInfo, data.m_Parameters.m_Axis,
+         GetInputTensorDataU8(0, data), GetOutputTensorDataU8(0, data));
 }
 
 } //namespace armnn
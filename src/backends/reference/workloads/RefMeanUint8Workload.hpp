@@ -16,6 +16,10 @@ class RefMeanUint8Workload : public Uint8Workload<MeanQueueDescriptor>
 public:
     explicit RefMeanUint8Workload (const MeanQueueDescriptor& descriptor, const WorkloadInfo& info);
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const MeanQueueDescriptor& data) const;
 };
 
 } //namespace armnn
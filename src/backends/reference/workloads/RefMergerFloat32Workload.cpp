@@ -12,10 +12,24 @@
 namespace armnn
 {
 
+RefMergerFloat32Workload::RefMergerFloat32Workload(const MergerQueueDescriptor& descriptor, const WorkloadInfo& info)
+    : Float32Workload<MergerQueueDescriptor>(descriptor, info)
+    , m_InputInfos(info.m_InputTensorInfos) {}
+
 void RefMergerFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefMergerFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefMergerFloat32Workload::Execute(const MergerQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefMergerFloat32Workload_Execute");
-    Merger<float>(m_Data);
+    Merger<float>(data, m_InputInfos);
 }
 
 } //namespace armnn
@@ -8,14 +8,23 @@
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
 class RefMergerFloat32Workload : public Float32Workload<MergerQueueDescriptor>
 {
 public:
-    using Float32Workload<MergerQueueDescriptor>::Float32Workload;
+    explicit RefMergerFloat32Workload(const MergerQueueDescriptor& descriptor, const WorkloadInfo& info);
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const MergerQueueDescriptor& data) const;
+
+    // The quantization of inputs written straight into views of the output is only known from here.
+    std::vector<TensorInfo> m_InputInfos;
 };
 
 } //namespace armnn
@@ -12,10 +12,24 @@
 namespace armnn
 {
 
+RefMergerUint8Workload::RefMergerUint8Workload(const MergerQueueDescriptor& descriptor, const WorkloadInfo& info)
+    : Uint8Workload<MergerQueueDescriptor>(descriptor, info)
+    , m_InputInfos(info.m_InputTensorInfos) {}
+
 void RefMergerUint8Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefMergerUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefMergerUint8Workload::Execute(const MergerQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefMergerUint8Workload_Execute");
-    Merger<uint8_t>(m_Data);
+    Merger<uint8_t>(data, m_InputInfos);
 }
 
 } //namespace armnn
@@ -143,36 +143,46 @@ void NormalizeAcrossUingLbr(const float*       inputData,
 }
 
 void RefNormalizationFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefNormalizationFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefNormalizationFloat32Workload::Execute(const NormalizationQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefNormalizationFloat32Workload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
 
-    float*       outputData = GetOutputTensorDataFloat(0, m_Data);
-    const float* inputData = GetInputTensorDataFloat(0, m_Data);
+    float*       outputData = GetOutputTensorDataFloat(0, data);
+    const float* inputData = GetInputTensorDataFloat(0, data);
 
-    if (NormalizationAlgorithmMethod::LocalBrightness == m_Data.m_Parameters.m_NormMethodType)
+    if (NormalizationAlgorithmMethod::LocalBrightness == data.m_Parameters.m_NormMethodType)
     {
-        if (NormalizationAlgorithmChannel::Within == m_Data.m_Parameters.m_NormChannelType)
+        if (NormalizationAlgorithmChannel::Within == data.m_Parameters.m_NormChannelType)
         {
             NormalizeWithinUingLbr(inputData,
                                    outputData,
                                    inputInfo.GetShape(),
-                                   m_Data.m_Parameters.m_NormSize,
-                                   m_Data.m_Parameters.m_Alpha,
-                                   m_Data.m_Parameters.m_Beta,
-                                   m_Data.m_Parameters.m_K);
+                                   data.m_Parameters.m_NormSize,
+                                   data.m_Parameters.m_Alpha,
+                                   data.m_Parameters.m_Beta,
+                                   data.m_Parameters.m_K);
         }
-        else if (NormalizationAlgorithmChannel::Across == m_Data.m_Parameters.m_NormChannelType)
+        else if (NormalizationAlgorithmChannel::Across == data.m_Parameters.m_NormChannelType)
         {
             NormalizeAcrossUingLbr(inputData,
                                    outputData,
                                    inputInfo.GetShape(),
-                                   m_Data.m_Parameters.m_NormSize,
-                                   m_Data.m_Parameters.m_Alpha,
-                                   m_Data.m_Parameters.m_Beta,
-                                   m_Data.m_Parameters.m_K,
-                                   m_Data.m_Parameters.m_DataLayout);
+                                   data.m_Parameters.m_NormSize,
+                                   data.m_Parameters.m_Alpha,
+                                   data.m_Parameters.m_Beta,
+                                   data.m_Parameters.m_K,
+                                   data.m_Parameters.m_DataLayout);
         }
         else
         {
@@ -16,6 +16,10 @@ class RefNormalizationFloat32Workload : public Float32Workload<NormalizationQueu
 public:
     using Float32Workload<NormalizationQueueDescriptor>::Float32Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const NormalizationQueueDescriptor& data) const;
 };
 
 } //namespace armnn
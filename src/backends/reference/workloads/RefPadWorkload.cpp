@@ -19,19 +19,31 @@ namespace armnn
 
 template <armnn::DataType DataType>
 void RefPadWorkload<DataType>::Execute() const
+{
+    Execute(m_Data);
+}
+
+template <armnn::DataType DataType>
+void RefPadWorkload<DataType>::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+template <armnn::DataType DataType>
+void RefPadWorkload<DataType>::Execute(const PadQueueDescriptor& data) const
 {
     using T = ResolveType<DataType>;
 
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefPadWorkload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
-    const T* inputData = GetInputTensorData<T>(0, m_Data);
-    T* outputData = GetOutputTensorData<T>(0, m_Data);
+    const T* inputData = GetInputTensorData<T>(0, data);
+    T* outputData = GetOutputTensorData<T>(0, data);
 
 
-    Pad(inputInfo, outputInfo, m_Data.m_Parameters.m_PadList, inputData, outputData);
+    Pad(inputInfo, outputInfo, data.m_Parameters.m_PadList, inputData, outputData);
 }
 
 template class RefPadWorkload<DataType::Float32>;
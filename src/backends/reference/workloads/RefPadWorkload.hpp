@@ -28,6 +28,10 @@ public:
     using TypedWorkload<PadQueueDescriptor, DataType>::TypedWorkload;
 
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const PadQueueDescriptor& data) const;
 };
 
 using RefPadFloat32Workload = RefPadWorkload<DataType::Float32>;
@@ -14,14 +14,26 @@ namespace armnn
 
 template <armnn::DataType DataType>
 void RefPermuteWorkload<DataType>::Execute() const
+{
+    Execute(m_Data);
+}
+
+template <armnn::DataType DataType>
+void RefPermuteWorkload<DataType>::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+template <armnn::DataType DataType>
+void RefPermuteWorkload<DataType>::Execute(const PermuteQueueDescriptor& data) const
 {
     using T = ResolveType<DataType>;
 
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, GetName() + "_Execute");
 
-    const ITensorHandle*     src      = m_Data.m_Inputs[0];
-    const ITensorHandle*     dst      = m_Data.m_Outputs[0];
-    const PermutationVector& mappings = m_Data.m_Parameters.m_DimMappings;
+    const ITensorHandle*     src      = data.m_Inputs[0];
+    const ITensorHandle*     dst      = data.m_Outputs[0];
+    const PermutationVector& mappings = data.m_Parameters.m_DimMappings;
 
     armnnUtils::Permute(GetTensorInfo(dst).GetShape(), mappings,
                         GetConstCpuData<void>(src), GetCpuData<void>(dst), sizeof(T));
@@ -25,6 +25,10 @@ public:
     using TypedWorkload<PermuteQueueDescriptor, DataType>::m_Data;
     using TypedWorkload<PermuteQueueDescriptor, DataType>::TypedWorkload;
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const PermuteQueueDescriptor& data) const;
 };
 
 using RefPermuteFloat16Workload = RefPermuteWorkload<DataType::Float16>;
@@ -14,20 +14,30 @@ namespace armnn
 {
 
 void RefPooling2dFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefPooling2dFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefPooling2dFloat32Workload::Execute(const Pooling2dQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefPooling2dFloat32Workload_Execute");
 
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo0 = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo0 = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo0 = GetTensorInfo(data.m_Outputs[0]);
 
-    float*       outputData = GetOutputTensorDataFloat(0, m_Data);
-    const float* inputData  = GetInputTensorDataFloat(0, m_Data);
+    float*       outputData = GetOutputTensorDataFloat(0, data);
+    const float* inputData  = GetInputTensorDataFloat(0, data);
 
     Pooling2d(inputData,
               outputData,
               inputInfo0,
               outputInfo0,
-              m_Data.m_Parameters);
+              data.m_Parameters);
 }
 
 } //namespace armnn
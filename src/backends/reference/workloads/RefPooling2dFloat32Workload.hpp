@@ -16,6 +16,10 @@ class RefPooling2dFloat32Workload : public Float32Workload<Pooling2dQueueDescrip
 public:
     using Float32Workload<Pooling2dQueueDescriptor>::Float32Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const Pooling2dQueueDescriptor& data) const;
 };
 
 } //namespace armnn
@@ -10,28 +10,31 @@
 
 #include "Profiling.hpp"
 
-#include <vector>
-
 namespace armnn
 {
 
 void RefPooling2dUint8Workload::Execute() const
 {
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefPooling2dUint8Workload_Execute");
+    Execute(m_Data);
+}
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+void RefPooling2dUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
 
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo);
+void RefPooling2dUint8Workload::Execute(const Pooling2dQueueDescriptor& data) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefPooling2dUint8Workload_Execute");
 
-    std::vector<float> results(outputInfo.GetNumElements());
-    Pooling2d(dequant.data(),
-              results.data(),
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
+
+    Pooling2d(GetInputTensorDataU8(0, data),
+              GetOutputTensorDataU8(0, data),
               inputInfo,
               outputInfo,
-              m_Data.m_Parameters);
-
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), outputInfo);
+              data.m_Parameters);
 }
 
 } //namespace armnn
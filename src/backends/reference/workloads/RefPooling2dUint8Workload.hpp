@@ -16,6 +16,10 @@ class RefPooling2dUint8Workload : public Uint8Workload<Pooling2dQueueDescriptor>
 public:
     using Uint8Workload<Pooling2dQueueDescriptor>::Uint8Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const Pooling2dQueueDescriptor& data) const;
 };
 
 } //namespace armnn
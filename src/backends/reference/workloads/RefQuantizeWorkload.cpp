@@ -38,8 +38,18 @@ RefQuantizeWorkload::RefQuantizeWorkload(const QuantizeQueueDescriptor& descript
 
 void RefQuantizeWorkload::Execute() const
 {
-    const void* input = m_Data.m_Inputs[0]->Map(true);
-    void* output =  m_Data.m_Outputs[0]->Map(true);
+    Execute(m_Data);
+}
+
+void RefQuantizeWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefQuantizeWorkload::Execute(const QuantizeQueueDescriptor& data) const
+{
+    const void* input = data.m_Inputs[0]->Map(true);
+    void* output =  data.m_Outputs[0]->Map(true);
 
     switch(m_TargetType)
     {
@@ -59,8 +69,8 @@ void RefQuantizeWorkload::Execute() const
         }
     }
 
-    m_Data.m_Inputs[0]->Unmap();
-    m_Data.m_Outputs[0]->Unmap();
+    data.m_Inputs[0]->Unmap();
+    data.m_Outputs[0]->Unmap();
 }
 
 } //namespace armnn
\ No newline at end of file
@@ -15,8 +15,11 @@ class RefQuantizeWorkload : public BaseWorkload<QuantizeQueueDescriptor>
 public:
     RefQuantizeWorkload(const QuantizeQueueDescriptor& descriptor, const WorkloadInfo &info);
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(const QuantizeQueueDescriptor& data) const;
+
     size_t m_NumElements;
     armnn::DataType m_TargetType;
     float m_Scale;
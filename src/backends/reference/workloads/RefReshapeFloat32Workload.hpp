@@ -16,6 +16,10 @@ class RefReshapeFloat32Workload : public Float32Workload<ReshapeQueueDescriptor>
 public:
     using Float32Workload<ReshapeQueueDescriptor>::Float32Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const ReshapeQueueDescriptor& data) const;
 };
 
 } //namespace armnn
@@ -15,13 +15,28 @@ namespace armnn
 {
 
 void RefReshapeUint8Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefReshapeUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefReshapeUint8Workload::Execute(const ReshapeQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefReshapeUint8Workload_Execute");
 
-    void* output = GetOutputTensorData<void>(0, m_Data);
-    const void* input = GetInputTensorData<void>(0, m_Data);
-    unsigned int numBytes = GetTensorInfo(m_Data.m_Inputs[0]).GetNumBytes();
-    memcpy(output, input, numBytes);
+    void* output = GetOutputTensorData<void>(0, data);
+    const void* input = GetInputTensorData<void>(0, data);
+    unsigned int numBytes = GetTensorInfo(data.m_Inputs[0]).GetNumBytes();
+
+    // The output usually aliases the input (see LoadedNetwork::AliasOutputs()).
+    if (output != input)
+    {
+        memcpy(output, input, numBytes);
+    }
 }
 
 } //namespace armnn
@@ -16,6 +16,10 @@ class RefReshapeUint8Workload : public Uint8Workload<ReshapeQueueDescriptor>
 public:
     using Uint8Workload<ReshapeQueueDescriptor>::Uint8Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const ReshapeQueueDescriptor& data) const;
 };
 
 } //namespace armnn
@@ -14,17 +14,27 @@ namespace armnn
 {
 
 void RefResizeBilinearFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefResizeBilinearFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefResizeBilinearFloat32Workload::Execute(const ResizeBilinearQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefResizeBilinearFloat32Workload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
-    ResizeBilinear(GetInputTensorDataFloat(0, m_Data),
+    ResizeBilinear(GetInputTensorDataFloat(0, data),
         inputInfo,
-        GetOutputTensorDataFloat(0, m_Data),
+        GetOutputTensorDataFloat(0, data),
         outputInfo,
-        m_Data.m_Parameters.m_DataLayout);
+        data.m_Parameters.m_DataLayout);
 }
 
 } //namespace armnn
@@ -16,6 +16,10 @@ class RefResizeBilinearFloat32Workload : public Float32Workload<ResizeBilinearQu
 public:
     using Float32Workload<ResizeBilinearQueueDescriptor>::Float32Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const ResizeBilinearQueueDescriptor& data) const;
 };
 
 } //namespace armnn
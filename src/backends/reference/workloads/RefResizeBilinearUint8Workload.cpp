@@ -16,18 +16,28 @@ namespace armnn
 {
 
 void RefResizeBilinearUint8Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefResizeBilinearUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefResizeBilinearUint8Workload::Execute(const ResizeBilinearQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefResizeBilinearUint8Workload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo);
+    auto dequant = Dequantize(GetInputTensorDataU8(0, data), inputInfo);
 
     std::vector<float> results(outputInfo.GetNumElements());
     ResizeBilinear(dequant.data(), inputInfo, results.data(), outputInfo);
 
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), outputInfo);
+    Quantize(GetOutputTensorDataU8(0, data), results.data(), outputInfo);
 }
 
 } //namespace armnn
@@ -16,6 +16,10 @@ class RefResizeBilinearUint8Workload : public Uint8Workload<ResizeBilinearQueueD
 public:
     using Uint8Workload<ResizeBilinearQueueDescriptor>::Uint8Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const ResizeBilinearQueueDescriptor& data) const;
 };
 
 } //namespace armnn
@@ -14,12 +14,22 @@ namespace armnn
 {
 
 void RefRsqrtFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefRsqrtFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefRsqrtFloat32Workload::Execute(const RsqrtQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefRsqrtFloat32Workload_Execute");
 
-    Rsqrt(GetInputTensorDataFloat(0, m_Data),
-          GetOutputTensorDataFloat(0, m_Data),
-          GetTensorInfo(m_Data.m_Inputs[0]));
+    Rsqrt(GetInputTensorDataFloat(0, data),
+          GetOutputTensorDataFloat(0, data),
+          GetTensorInfo(data.m_Inputs[0]));
 }
 
 } //namespace armnn
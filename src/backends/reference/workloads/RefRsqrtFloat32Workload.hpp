@@ -16,6 +16,10 @@ class RefRsqrtFloat32Workload : public Float32Workload<RsqrtQueueDescriptor>
 public:
     using Float32Workload<RsqrtQueueDescriptor>::Float32Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const RsqrtQueueDescriptor& data) const;
 };
 
 } //namespace armnn
@@ -14,13 +14,23 @@ namespace armnn
 {
 
 void RefSoftmaxFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefSoftmaxFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefSoftmaxFloat32Workload::Execute(const SoftmaxQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSoftmaxFloat32Workload_Execute");
 
-    Softmax(GetInputTensorDataFloat(0, m_Data),
-            GetOutputTensorDataFloat(0, m_Data),
-            GetTensorInfo(m_Data.m_Inputs[0]),
-            m_Data.m_Parameters.m_Beta);
+    Softmax(GetInputTensorDataFloat(0, data),
+            GetOutputTensorDataFloat(0, data),
+            GetTensorInfo(data.m_Inputs[0]),
+            data.m_Parameters.m_Beta);
 }
 
 } //namespace armnn
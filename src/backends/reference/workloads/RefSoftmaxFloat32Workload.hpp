@@ -16,6 +16,10 @@ class RefSoftmaxFloat32Workload : public Float32Workload<SoftmaxQueueDescriptor>
 public:
     using Float32Workload<SoftmaxQueueDescriptor>::Float32Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const SoftmaxQueueDescriptor& data) const;
 };
 
 } //namespace armnn
@@ -10,27 +10,32 @@
 
 #include "Profiling.hpp"
 
-#include <vector>
-
 namespace armnn
 {
 
+RefSoftmaxUint8Workload::RefSoftmaxUint8Workload(const SoftmaxQueueDescriptor& descriptor, const WorkloadInfo& info)
+    : Uint8Workload<SoftmaxQueueDescriptor>(descriptor, info)
+    , m_Exponentials(MakeSoftmaxExpTable(info.m_InputTensorInfos[0], descriptor.m_Parameters.m_Beta)) {}
+
 void RefSoftmaxUint8Workload::Execute() const
 {
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSoftmaxUint8Workload_Execute");
-
-    const TensorInfo& tensorInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), tensorInfo);
+    Execute(m_Data);
+}
 
-    std::vector<float> results(tensorInfo.GetNumElements());
+void RefSoftmaxUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
 
-    Softmax(dequant.data(),
-            results.data(),
-            tensorInfo,
-            m_Data.m_Parameters.m_Beta);
+void RefSoftmaxUint8Workload::Execute(const SoftmaxQueueDescriptor& data) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSoftmaxUint8Workload_Execute");
 
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), GetTensorInfo(m_Data.m_Outputs[0]));
+    Softmax(GetInputTensorDataU8(0, data),
+            GetOutputTensorDataU8(0, data),
+            GetTensorInfo(data.m_Inputs[0]),
+            GetTensorInfo(data.m_Outputs[0]),
+            m_Exponentials);
 }
 
 } //namespace armnn
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "Softmax.hpp"
+
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
@@ -14,8 +16,14 @@ namespace armnn
 class RefSoftmaxUint8Workload : public Uint8Workload<SoftmaxQueueDescriptor>
 {
 public:
-    using Uint8Workload<SoftmaxQueueDescriptor>::Uint8Workload;
+    explicit RefSoftmaxUint8Workload(const SoftmaxQueueDescriptor& descriptor, const WorkloadInfo& info);
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const SoftmaxQueueDescriptor& data) const;
+
+    SoftmaxExpTable m_Exponentials;
 };
 
 } //namespace armnn
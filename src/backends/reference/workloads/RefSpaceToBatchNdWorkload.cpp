@@ -14,18 +14,30 @@ namespace armnn
 
 template<armnn::DataType DataType>
 void RefSpaceToBatchNdWorkload<DataType>::Execute() const
+{
+    Execute(m_Data);
+}
+
+template<armnn::DataType DataType>
+void RefSpaceToBatchNdWorkload<DataType>::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+template<armnn::DataType DataType>
+void RefSpaceToBatchNdWorkload<DataType>::Execute(const SpaceToBatchNdQueueDescriptor& data) const
 {
     using T = ResolveType<DataType>;
 
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, GetName() + "_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
-    const T* inputData = GetInputTensorData<T>(0, m_Data);
-    T* outputData = GetOutputTensorData<T>(0, m_Data);
+    const T* inputData = GetInputTensorData<T>(0, data);
+    T* outputData = GetOutputTensorData<T>(0, data);
 
-    SpaceToBatchNd(inputInfo, outputInfo, m_Data.m_Parameters, inputData, outputData);
+    SpaceToBatchNd(inputInfo, outputInfo, data.m_Parameters, inputData, outputData);
 }
 
 template class RefSpaceToBatchNdWorkload<DataType::Float32>;
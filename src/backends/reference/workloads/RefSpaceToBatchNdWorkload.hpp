@@ -25,6 +25,10 @@ public:
     using TypedWorkload<SpaceToBatchNdQueueDescriptor, DataType>::TypedWorkload;
 
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const SpaceToBatchNdQueueDescriptor& data) const;
 };
 
 using RefSpaceToBatchNdFloat32Workload = RefSpaceToBatchNdWorkload<DataType::Float32>;
@@ -13,9 +13,19 @@ namespace armnn
 {
 
 void RefSplitterFloat32Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefSplitterFloat32Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefSplitterFloat32Workload::Execute(const SplitterQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSplitterFloat32Workload_Execute");
-    Splitter<float>(m_Data);
+    Splitter<float>(data);
 }
 
 } //namespace armnn
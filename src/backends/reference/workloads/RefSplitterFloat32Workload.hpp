@@ -16,6 +16,10 @@ class RefSplitterFloat32Workload : public Float32Workload<SplitterQueueDescripto
 public:
     using Float32Workload<SplitterQueueDescriptor>::Float32Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const SplitterQueueDescriptor& data) const;
 };
 
 } //namespace armnn
@@ -13,9 +13,19 @@ namespace armnn
 {
 
 void RefSplitterUint8Workload::Execute() const
+{
+    Execute(m_Data);
+}
+
+void RefSplitterUint8Workload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+void RefSplitterUint8Workload::Execute(const SplitterQueueDescriptor& data) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSplitterUint8Workload_Execute");
-    Splitter<uint8_t>(m_Data);
+    Splitter<uint8_t>(data);
 }
 
 } //namespace armnn
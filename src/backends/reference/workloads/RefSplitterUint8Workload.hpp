@@ -16,6 +16,10 @@ class RefSplitterUint8Workload : public Uint8Workload<SplitterQueueDescriptor>
 public:
     using Uint8Workload<SplitterQueueDescriptor>::Uint8Workload;
     virtual void Execute() const override;
+    virtual void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const SplitterQueueDescriptor& data) const;
 };
 
 } //namespace armnn
@@ -14,18 +14,30 @@ namespace armnn
 
 template<armnn::DataType DataType>
 void RefStridedSliceWorkload<DataType>::Execute() const
+{
+    Execute(m_Data);
+}
+
+template<armnn::DataType DataType>
+void RefStridedSliceWorkload<DataType>::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(WithWorkingMemory(m_Data, workingMemDescriptor));
+}
+
+template<armnn::DataType DataType>
+void RefStridedSliceWorkload<DataType>::Execute(const StridedSliceQueueDescriptor& data) const
 {
     using T = ResolveType<DataType>;
 
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, GetName() + "_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
 
-    const T* inputData = GetInputTensorData<T>(0, m_Data);
-    T* outputData = GetOutputTensorData<T>(0, m_Data);
+    const T* inputData = GetInputTensorData<T>(0, data);
+    T* outputData = GetOutputTensorData<T>(0, data);
 
-    StridedSlice(inputInfo, outputInfo, m_Data.m_Parameters, inputData, outputData);
+    StridedSlice(inputInfo, outputInfo, data.m_Parameters, inputData, outputData);
 }
 
 template class RefStridedSliceWorkload<DataType::Float32>;
@@ -26,6 +26,10 @@ public:
     using TypedWorkload<StridedSliceQueueDescriptor, DataType>::TypedWorkload;
 
     void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const StridedSliceQueueDescriptor& data) const;
 };
 
 using RefStridedSliceFloat32Workload = RefStridedSliceWorkload<DataType::Float32>;
@@ -7,6 +7,8 @@
 
 #include "TensorBufferArrayView.hpp"
 
+#include <backendsCommon/ThreadPool.hpp>
+
 #include <boost/numeric/conversion/cast.hpp>
 
 #include <cmath>
@@ -53,10 +55,14 @@ void ResizeBilinear(const float*      in,
     TensorBufferArrayView<const float> input(inputInfo.GetShape(), in, dataLayout);
     TensorBufferArrayView<float> output(outputInfo.GetShape(), out, dataLayout);
 
-    for (unsigned int n = 0; n < batchSize; ++n)
+    // Each channel of each batch is resized on its own, so they can be shared out between threads.
+    ParallelFor(batchSize * channelCount, outputHeight * outputWidth, [&](unsigned int begin, unsigned int end)
     {
-        for (unsigned int c = 0; c < channelCount; ++c)
+        for (unsigned int index = begin; index < end; ++index)
         {
+            const unsigned int n = index / channelCount;
+            const unsigned int c = index % channelCount;
+
             for (unsigned int y = 0; y < outputHeight; ++y)
             {
                 // Corresponding real-valued height coordinate in input image.
@@ -92,7 +98,7 @@ void ResizeBilinear(const float*      in,
                 }
             }
         }
-    }
+    });
 }
 
 } //namespace armnn
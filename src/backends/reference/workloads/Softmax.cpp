@@ -4,8 +4,15 @@
 //
 
 #include "Softmax.hpp"
+#include "ConvImpl.hpp"
 
+#include <armnn/TypesUtils.hpp>
+
+#include <backendsCommon/ThreadPool.hpp>
+
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <vector>
 
 namespace armnn
@@ -15,35 +22,106 @@ namespace armnn
 void Softmax(const float* in, float* out, const TensorInfo& tensorInfo, float beta)
 {
     unsigned int numChannels = tensorInfo.GetShape()[1];
-    for (unsigned int n = 0; n < tensorInfo.GetShape()[0]; n++)
+
+    // The rows are independent of each other, so they can be shared out between threads.
+    ParallelFor(tensorInfo.GetShape()[0], numChannels, [&](unsigned int begin, unsigned int end)
     {
-        // Find maximum channel.
-        float max = in[n * numChannels];
-        for (unsigned int c = 1; c < numChannels; c++)
+        std::vector<float> exponentials(numChannels);
+
+        for (unsigned int n = begin; n < end; n++)
         {
-            float val = in[n * numChannels + c];
-            if (val > max)
+            // Find maximum channel.
+            float max = in[n * numChannels];
+            for (unsigned int c = 1; c < numChannels; c++)
             {
-                max = val;
+                float val = in[n * numChannels + c];
+                if (val > max)
+                {
+                    max = val;
+                }
             }
-        }
 
-        // Exponentiate all values and sum.
-        std::vector<float> exponentials(numChannels);
-        float              sum = 0.0f;
-        for (unsigned int c = 0; c < numChannels; c++)
-        {
-            float val       = in[n * numChannels + c];
-            exponentials[c] = expf((val - max) * beta);
-            sum += exponentials[c];
+            // Exponentiate all values and sum.
+            float sum = 0.0f;
+            for (unsigned int c = 0; c < numChannels; c++)
+            {
+                float val       = in[n * numChannels + c];
+                exponentials[c] = expf((val - max) * beta);
+                sum += exponentials[c];
+            }
+
+            // Divide exponentials by sum to give outputs.
+            for (unsigned int c = 0; c < numChannels; c++)
+            {
+                out[n * numChannels + c] = exponentials[c] / sum;
+            }
         }
+    });
+}
 
-        // Divide exponentials by sum to give outputs.
-        for (unsigned int c = 0; c < numChannels; c++)
+SoftmaxExpTable MakeSoftmaxExpTable(const TensorInfo& inputInfo, float beta)
+{
+    const double one = static_cast<double>(1ll << 31);
+    const double inputScale = inputInfo.GetQuantizationScale();
+
+    SoftmaxExpTable exponentials;
+    for (unsigned int i = 0; i < exponentials.size(); i++)
+    {
+        const double value = std::round(std::exp(-static_cast<double>(i) * inputScale * beta) * one);
+        exponentials[i] = static_cast<int32_t>(std::min(value, static_cast<double>(std::numeric_limits<int32_t>::max())));
+    }
+    return exponentials;
+}
+
+void Softmax(const uint8_t* in,
+             uint8_t* out,
+             const TensorInfo& inputInfo,
+             const TensorInfo& outputInfo,
+             const SoftmaxExpTable& exponentials)
+{
+    // Rescales a Q0.31 probability to the output quantization.
+    const QuantizedMultiplier multiplier(1.0f / outputInfo.GetQuantizationScale());
+    const int32_t outputOffset = outputInfo.GetQuantizationOffset();
+
+    unsigned int numChannels = inputInfo.GetShape()[1];
+    ParallelFor(inputInfo.GetShape()[0], numChannels, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int n = begin; n < end; n++)
         {
-            out[n * numChannels + c] = exponentials[c] / sum;
+            const uint8_t* inRow = in + n * numChannels;
+            uint8_t* outRow      = out + n * numChannels;
+
+            const uint8_t max = *std::max_element(inRow, inRow + numChannels);
+
+            // The maximum contributes exp(0), so the sum is at least 2^31 - 1.
+            int64_t sum = 0;
+            for (unsigned int c = 0; c < numChannels; c++)
+            {
+                sum += exponentials[max - inRow[c]];
+            }
+
+            // Brings the sum into [2^30, 2^31) so that 2^61 / sum fits in 32 bits, then the probability of each
+            // channel is exp * reciprocal / 2^(30 + shift) in Q0.31.
+            int shift = 0;
+            while ((sum >> shift) >= (1ll << 31))
+            {
+                ++shift;
+            }
+            const int64_t normalizedSum = sum >> shift;
+            const int64_t reciprocal    = ((1ll << 61) + normalizedSum / 2) / normalizedSum;
+            const int64_t rounding      = 1ll << (29 + shift);
+
+            for (unsigned int c = 0; c < numChannels; c++)
+            {
+                const int64_t probability = std::min<int64_t>(
+                    (exponentials[max - inRow[c]] * reciprocal + rounding) >> (30 + shift),
+                    std::numeric_limits<int32_t>::max());
+
+                const int32_t quantized = multiplier.Apply(probability, 1, 31) + outputOffset;
+                outRow[c] = static_cast<uint8_t>(std::min(std::max(quantized, 0), 255));
+            }
         }
-    }
+    });
 }
 
 } //namespace armnn
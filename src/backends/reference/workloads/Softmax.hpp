@@ -7,10 +7,28 @@
 
 #include <armnn/Tensor.hpp>
 
+#include <array>
+#include <cstdint>
+
 namespace armnn
 {
 
 /// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
 void Softmax(const float* in, float* out, const TensorInfo& tensorInfo, float beta);
 
+/// Exponentials used by the quantized softmax: entry i is exp(-i * inputScale * beta) in Q0.31 fixed point, i.e. the
+/// exponential of an input that is i quantization steps below the maximum of its row.
+using SoftmaxExpTable = std::array<int32_t, 256>;
+
+SoftmaxExpTable MakeSoftmaxExpTable(const TensorInfo& inputInfo, float beta);
+
+/// Quantized softmax working directly on the quantized values. The row maximum is found in the quantized domain, the
+/// exponentials are looked up from the table and the sum, its reciprocal and the rescaling to the output quantization
+/// are all done in fixed point.
+void Softmax(const uint8_t* in,
+             uint8_t* out,
+             const TensorInfo& inputInfo,
+             const TensorInfo& outputInfo,
+             const SoftmaxExpTable& exponentials);
+
 } //namespace armnn
@@ -0,0 +1,69 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+#include <boost/assert.hpp>
+
+namespace armnn
+{
+
+/// Calls function(subTensorIndex, tensorIndex, length) for each run of elements of a region of a tensor that follow
+/// each other in the memory of the tensor, with the index of the first element of the run in the (densely laid out)
+/// region and in the tensor.
+template <typename Function>
+void ForEachSubTensorRun(const TensorShape& tensorShape,
+                         const TensorShape& subTensorShape,
+                         const unsigned int* subTensorOrigin,
+                         Function function)
+{
+    const unsigned int numDimensions = tensorShape.GetNumDimensions();
+    BOOST_ASSERT(subTensorShape.GetNumDimensions() == numDimensions);
+
+    // The runs span the inner dimensions the region covers whole, and part of the next one.
+    unsigned int runDimension = numDimensions - 1;
+    while (runDimension > 0 && subTensorShape[runDimension] == tensorShape[runDimension])
+    {
+        --runDimension;
+    }
+
+    unsigned int runLength = 1;
+    unsigned int runStride = 1;
+    for (unsigned int i = numDimensions; i-- > runDimension;)
+    {
+        runLength *= subTensorShape[i];
+        runStride *= i > runDimension ? tensorShape[i] : 1;
+    }
+    if (runLength == 0)
+    {
+        return;
+    }
+
+    const unsigned int numRuns = subTensorShape.GetNumElements() / runLength;
+    unsigned int indices[MaxNumOfTensorDimensions] = { 0 };
+    for (unsigned int run = 0; run < numRuns; ++run)
+    {
+        unsigned int tensorIndex = 0;
+        for (unsigned int i = 0; i <= runDimension; ++i)
+        {
+            tensorIndex = tensorIndex * tensorShape[i] + subTensorOrigin[i] + indices[i];
+        }
+        function(run * runLength, tensorIndex * runStride, runLength);
+
+        // Moves on to the next run along the outer dimensions.
+        for (unsigned int i = runDimension; i-- > 0;)
+        {
+            if (++indices[i] < subTensorShape[i])
+            {
+                break;
+            }
+            indices[i] = 0;
+        }
+    }
+}
+
+} //namespace armnn
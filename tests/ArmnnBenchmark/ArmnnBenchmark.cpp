@@ -0,0 +1,610 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include <armnn/ArmNN.hpp>
+
+#if defined(ARMNN_SERIALIZER)
+#include "armnnDeserializer/IDeserializer.hpp"
+#endif
+#if defined(ARMNN_CAFFE_PARSER)
+#include "armnnCaffeParser/ICaffeParser.hpp"
+#endif
+#if defined(ARMNN_TF_PARSER)
+#include "armnnTfParser/ITfParser.hpp"
+#endif
+#if defined(ARMNN_TF_LITE_PARSER)
+#include "armnnTfLiteParser/ITfLiteParser.hpp"
+#endif
+#if defined(ARMNN_ONNX_PARSER)
+#include "armnnOnnxParser/IOnnxParser.hpp"
+#endif
+#include "../InferenceModel.hpp"
+
+#include <Profiling.hpp>
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/program_options.hpp>
+
+#if defined(__unix__)
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+
+namespace po = boost::program_options;
+
+using TContainer = boost::variant<std::vector<float>, std::vector<int>, std::vector<unsigned char>>;
+
+// Number of profiling events kept for the per-layer breakdown: enough for several inferences of large networks.
+constexpr unsigned int g_ProfilingRingBufferCapacity = 1u << 16;
+
+struct BenchmarkOptions
+{
+    std::string                   m_ModelFormat;
+    std::string                   m_ModelPath;
+    std::vector<armnn::BackendId> m_ComputeDevices;
+    std::vector<std::string>      m_InputNames;
+    std::vector<std::string>      m_InputTensorShapes;
+    std::vector<std::string>      m_OutputNames;
+    size_t                        m_SubgraphId;
+    unsigned int                  m_WarmupIterations;
+    unsigned int                  m_Iterations;
+    unsigned int                  m_NumThreads;
+    bool                          m_LayerBreakdown;
+    bool                          m_EnableFp16TurboMode;
+    std::string                   m_JsonFile;
+};
+
+struct LatencyStatistics
+{
+    double m_MinMs;
+    double m_MeanMs;
+    double m_P50Ms;
+    double m_P90Ms;
+    double m_P99Ms;
+    double m_MaxMs;
+};
+
+struct BenchmarkResults
+{
+    LatencyStatistics                   m_Latency;
+    double                              m_ThroughputPerSecond;
+    long                                m_PeakRssKb;
+    std::vector<armnn::EventStatistics> m_Layers;
+};
+
+std::vector<std::string> ParseStringList(const std::string& inputString, const char* delimiter)
+{
+    std::vector<std::string> result;
+    if (inputString.empty())
+    {
+        return result;
+    }
+    boost::split(result, inputString, boost::algorithm::is_any_of(delimiter), boost::token_compress_on);
+    for (std::string& token : result)
+    {
+        boost::trim(token);
+    }
+    return result;
+}
+
+armnn::TensorShape ParseTensorShape(const std::string& shape)
+{
+    std::vector<unsigned int> dims;
+    for (const std::string& dim : ParseStringList(shape, ", "))
+    {
+        dims.push_back(boost::numeric_cast<unsigned int>(std::stoul(dim)));
+    }
+    return armnn::TensorShape(boost::numeric_cast<unsigned int>(dims.size()), dims.data());
+}
+
+// Creates a container of the right type and size for each binding. The values do not matter for timing purposes.
+std::vector<TContainer> MakeContainers(const std::vector<InferenceModelInternal::BindingPointInfo>& bindings)
+{
+    std::vector<TContainer> containers;
+    for (const auto& binding : bindings)
+    {
+        const unsigned int numElements = binding.second.GetNumElements();
+        switch (binding.second.GetDataType())
+        {
+            case armnn::DataType::QuantisedAsymm8:
+                containers.push_back(std::vector<unsigned char>(numElements, 128));
+                break;
+            case armnn::DataType::Signed32:
+                containers.push_back(std::vector<int>(numElements, 1));
+                break;
+            default:
+                containers.push_back(std::vector<float>(numElements, 0.5f));
+                break;
+        }
+    }
+    return containers;
+}
+
+// Gets the value at the given percentile of the sorted values, using the nearest-rank method.
+double FindPercentile(const std::vector<double>& sortedValues, double percentile)
+{
+    const double rank = std::ceil(percentile / 100.0 * static_cast<double>(sortedValues.size()));
+    return sortedValues[std::max<size_t>(static_cast<size_t>(rank), 1) - 1];
+}
+
+LatencyStatistics CalculateLatencyStatistics(std::vector<double> latenciesMs)
+{
+    std::sort(latenciesMs.begin(), latenciesMs.end());
+
+    LatencyStatistics statistics;
+    statistics.m_MinMs  = latenciesMs.front();
+    statistics.m_MeanMs = std::accumulate(latenciesMs.begin(), latenciesMs.end(), 0.0) /
+                          static_cast<double>(latenciesMs.size());
+    statistics.m_P50Ms  = FindPercentile(latenciesMs, 50.0);
+    statistics.m_P90Ms  = FindPercentile(latenciesMs, 90.0);
+    statistics.m_P99Ms  = FindPercentile(latenciesMs, 99.0);
+    statistics.m_MaxMs  = latenciesMs.back();
+    return statistics;
+}
+
+long GetPeakRssKb()
+{
+#if defined(__unix__)
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        return usage.ru_maxrss;
+    }
+#endif
+    return -1;
+}
+
+// Lets the client threads start measuring together, once they have all warmed up.
+class Barrier
+{
+public:
+    Barrier(unsigned int numThreads, std::function<void()> onRelease)
+        : m_NumWaiting(numThreads), m_OnRelease(std::move(onRelease))
+    {}
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        if (--m_NumWaiting == 0)
+        {
+            m_OnRelease();
+            m_Released.notify_all();
+            return;
+        }
+        m_Released.wait(lock, [this]() { return m_NumWaiting == 0; });
+    }
+
+private:
+    unsigned int m_NumWaiting;
+    std::function<void()> m_OnRelease;
+    std::mutex m_Mutex;
+    std::condition_variable m_Released;
+};
+
+template<typename TParser>
+BenchmarkResults RunBenchmark(const BenchmarkOptions& options)
+{
+    using Clock = std::chrono::steady_clock;
+
+    typename InferenceModel<TParser, float>::Params params;
+    params.m_ModelPath           = options.m_ModelPath;
+    params.m_IsModelBinary       = options.m_ModelFormat.find("bin") != std::string::npos;
+    params.m_ComputeDevices      = options.m_ComputeDevices;
+    params.m_InputBindings       = options.m_InputNames;
+    params.m_OutputBindings      = options.m_OutputNames;
+    params.m_SubgraphId          = options.m_SubgraphId;
+    params.m_EnableFp16TurboMode = options.m_EnableFp16TurboMode;
+    for (const std::string& shape : options.m_InputTensorShapes)
+    {
+        params.m_InputShapes.push_back(ParseTensorShape(shape));
+    }
+
+    std::shared_ptr<armnn::IRuntime> runtime(armnn::IRuntime::Create(armnn::IRuntime::CreationOptions()));
+    InferenceModel<TParser, float> model(params, runtime);
+
+    // The per-layer breakdown uses the ring buffer mode of the profiler, which is cheap enough not to distort the
+    // latencies and can record the events of all the client threads.
+    std::shared_ptr<armnn::IProfiler> profiler = runtime->GetProfiler(model.GetNetworkIdentifier());
+    if (options.m_LayerBreakdown && profiler)
+    {
+        profiler->EnableProfiling(false);
+        profiler->EnableRingBufferProfiling(g_ProfilingRingBufferCapacity);
+    }
+    armnn::Profiler* clientProfiler =
+        options.m_LayerBreakdown ? static_cast<armnn::Profiler*>(profiler.get()) : nullptr;
+
+    const std::vector<TContainer> inputs = MakeContainers(model.GetInputBindingInfos());
+
+    Clock::time_point start;
+    Barrier barrier(options.m_NumThreads, [&]()
+    {
+        if (clientProfiler)
+        {
+            clientProfiler->EnableProfiling(true);
+        }
+        start = Clock::now();
+    });
+
+    // Each client evaluates the network with its own working memory, so the clients run concurrently. A client failing
+    // before the timed loop still waits at the barrier, so that the others are released, and aborts the benchmark.
+    std::vector<std::vector<double>> latenciesMs(options.m_NumThreads);
+    std::vector<std::string> errors(options.m_NumThreads);
+    std::atomic<bool> aborted(false);
+    auto RunClient = [&](unsigned int client)
+    {
+        armnn::ProfilerManager::GetInstance().RegisterProfiler(clientProfiler);
+        bool reachedBarrier = false;
+        try
+        {
+            std::unique_ptr<armnn::IWorkingMemHandle> workingMemHandle =
+                runtime->CreateWorkingMemHandle(model.GetNetworkIdentifier());
+            std::vector<TContainer> outputs = MakeContainers(model.GetOutputBindingInfos());
+            const armnn::InputTensors inputTensors = MakeInputTensors(model.GetInputBindingInfos(), inputs);
+            const armnn::OutputTensors outputTensors = MakeOutputTensors(model.GetOutputBindingInfos(), outputs);
+
+            auto RunInference = [&]()
+            {
+                if (runtime->Execute(*workingMemHandle, inputTensors, outputTensors) == armnn::Status::Failure)
+                {
+                    throw armnn::Exception("IRuntime::Execute failed");
+                }
+            };
+
+            for (unsigned int i = 0; i < options.m_WarmupIterations; ++i)
+            {
+                RunInference();
+            }
+            reachedBarrier = true;
+            barrier.Wait();
+
+            const unsigned int numIterations = aborted ? 0 : options.m_Iterations;
+            latenciesMs[client].reserve(numIterations);
+            for (unsigned int i = 0; i < numIterations; ++i)
+            {
+                const Clock::time_point inferenceStart = Clock::now();
+                RunInference();
+                latenciesMs[client].push_back(
+                    std::chrono::duration<double, std::milli>(Clock::now() - inferenceStart).count());
+            }
+        }
+        catch (const std::exception& e)
+        {
+            errors[client] = e.what();
+            if (!reachedBarrier)
+            {
+                aborted = true;
+                barrier.Wait();
+            }
+        }
+        armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+    };
+
+    std::vector<std::thread> clients;
+    for (unsigned int client = 0; client < options.m_NumThreads; ++client)
+    {
+        clients.emplace_back(RunClient, client);
+    }
+    for (std::thread& client : clients)
+    {
+        client.join();
+    }
+    const Clock::time_point end = Clock::now();
+
+    for (const std::string& error : errors)
+    {
+        if (!error.empty())
+        {
+            throw armnn::Exception(error);
+        }
+    }
+
+    std::vector<double> allLatenciesMs;
+    for (const std::vector<double>& clientLatenciesMs : latenciesMs)
+    {
+        allLatenciesMs.insert(allLatenciesMs.end(), clientLatenciesMs.begin(), clientLatenciesMs.end());
+    }
+
+    BenchmarkResults results;
+    results.m_Latency = CalculateLatencyStatistics(std::move(allLatenciesMs));
+    results.m_ThroughputPerSecond = static_cast<double>(options.m_NumThreads * options.m_Iterations) /
+                                    std::chrono::duration<double>(end - start).count();
+    results.m_PeakRssKb = GetPeakRssKb();
+    if (clientProfiler)
+    {
+        clientProfiler->EnableProfiling(false);
+        results.m_Layers = profiler->GetEventStatistics();
+
+        // Most expensive events first.
+        std::sort(results.m_Layers.begin(), results.m_Layers.end(),
+                  [](const armnn::EventStatistics& lhs, const armnn::EventStatistics& rhs)
+                  {
+                      return lhs.m_MeanMs * lhs.m_Count > rhs.m_MeanMs * rhs.m_Count;
+                  });
+    }
+    return results;
+}
+
+void WriteResults(std::ostream& out, const BenchmarkOptions& options, const BenchmarkResults& results)
+{
+    const LatencyStatistics& latency = results.m_Latency;
+    out << std::fixed << std::setprecision(3);
+    out << "Model:       " << options.m_ModelPath << std::endl;
+    out << "Iterations:  " << options.m_Iterations << " x " << options.m_NumThreads << " thread(s), after "
+        << options.m_WarmupIterations << " warmup iteration(s)" << std::endl;
+    out << "Latency (ms) - Min | Mean | P50 | P90 | P99 | Max" << std::endl;
+    out << "\t" << latency.m_MinMs << " " << latency.m_MeanMs << " " << latency.m_P50Ms << " "
+        << latency.m_P90Ms << " " << latency.m_P99Ms << " " << latency.m_MaxMs << std::endl;
+    out << "Throughput:  " << results.m_ThroughputPerSecond << " inferences/s" << std::endl;
+    out << "Peak RSS:    " << results.m_PeakRssKb << " KB" << std::endl;
+
+    if (!results.m_Layers.empty())
+    {
+        out << std::endl << "Event Stats - Name | Mean (ms) | P50 (ms) | P99 (ms) | Count" << std::endl;
+        for (const armnn::EventStatistics& layer : results.m_Layers)
+        {
+            out << "\t" << std::setw(50) << layer.m_Name << " " << std::setw(9) << layer.m_MeanMs << " "
+                << std::setw(9) << layer.m_P50Ms << " " << std::setw(9) << layer.m_P99Ms << " "
+                << std::setw(9) << layer.m_Count << std::endl;
+        }
+    }
+}
+
+std::string QuoteJsonString(const std::string& string)
+{
+    std::string quoted = "\"";
+    for (char c : string)
+    {
+        if (c == '"' || c == '\\')
+        {
+            quoted += '\\';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+void WriteJsonResults(std::ostream& out, const BenchmarkOptions& options, const BenchmarkResults& results)
+{
+    const LatencyStatistics& latency = results.m_Latency;
+    out << std::fixed << std::setprecision(6);
+    out << "{" << std::endl;
+    out << "\t\"model\": " << QuoteJsonString(options.m_ModelPath) << "," << std::endl;
+    out << "\t\"backends\": [";
+    for (size_t i = 0; i < options.m_ComputeDevices.size(); ++i)
+    {
+        out << (i == 0 ? "" : ", ") << QuoteJsonString(options.m_ComputeDevices[i].Get());
+    }
+    out << "]," << std::endl;
+    out << "\t\"warmup_iterations\": " << options.m_WarmupIterations << "," << std::endl;
+    out << "\t\"iterations\": " << options.m_Iterations << "," << std::endl;
+    out << "\t\"threads\": " << options.m_NumThreads << "," << std::endl;
+    out << "\t\"latency_ms\": { \"min\": " << latency.m_MinMs << ", \"mean\": " << latency.m_MeanMs
+        << ", \"p50\": " << latency.m_P50Ms << ", \"p90\": " << latency.m_P90Ms
+        << ", \"p99\": " << latency.m_P99Ms << ", \"max\": " << latency.m_MaxMs << " }," << std::endl;
+    out << "\t\"throughput_per_second\": " << results.m_ThroughputPerSecond << "," << std::endl;
+    out << "\t\"peak_rss_kb\": " << results.m_PeakRssKb << "," << std::endl;
+    out << "\t\"layers\": [";
+    for (size_t i = 0; i < results.m_Layers.size(); ++i)
+    {
+        const armnn::EventStatistics& layer = results.m_Layers[i];
+        out << (i == 0 ? "" : ",") << std::endl
+            << "\t\t{ \"name\": " << QuoteJsonString(layer.m_Name) << ", \"count\": " << layer.m_Count
+            << ", \"mean_ms\": " << layer.m_MeanMs << ", \"p50_ms\": " << layer.m_P50Ms
+            << ", \"p99_ms\": " << layer.m_P99Ms << " }";
+    }
+    out << std::endl << "\t]" << std::endl;
+    out << "}" << std::endl;
+}
+
+template<typename TParser>
+int MainImpl(const BenchmarkOptions& options)
+{
+    try
+    {
+        const BenchmarkResults results = RunBenchmark<TParser>(options);
+        WriteResults(std::cout, options, results);
+
+        if (!options.m_JsonFile.empty())
+        {
+            std::ofstream jsonFile(options.m_JsonFile);
+            if (!jsonFile)
+            {
+                BOOST_LOG_TRIVIAL(fatal) << "Cannot open \"" << options.m_JsonFile << "\" for writing";
+                return EXIT_FAILURE;
+            }
+            WriteJsonResults(jsonFile, options, results);
+        }
+    }
+    catch (const armnn::Exception& e)
+    {
+        BOOST_LOG_TRIVIAL(fatal) << "Armnn Error: " << e.what();
+        return EXIT_FAILURE;
+    }
+    catch (const std::exception& e)
+    {
+        BOOST_LOG_TRIVIAL(fatal) << "Error: " << e.what();
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+int RunBenchmarkForFormat(const BenchmarkOptions& options)
+{
+    const std::string& modelFormat = options.m_ModelFormat;
+    if (modelFormat.find("armnn") != std::string::npos)
+    {
+#if defined(ARMNN_SERIALIZER)
+        return MainImpl<armnnDeserializer::IDeserializer>(options);
+#else
+        BOOST_LOG_TRIVIAL(fatal) << "Not built with serialization support.";
+        return EXIT_FAILURE;
+#endif
+    }
+    else if (modelFormat.find("caffe") != std::string::npos)
+    {
+#if defined(ARMNN_CAFFE_PARSER)
+        return MainImpl<armnnCaffeParser::ICaffeParser>(options);
+#else
+        BOOST_LOG_TRIVIAL(fatal) << "Not built with Caffe parser support.";
+        return EXIT_FAILURE;
+#endif
+    }
+    else if (modelFormat.find("onnx") != std::string::npos)
+    {
+#if defined(ARMNN_ONNX_PARSER)
+        return MainImpl<armnnOnnxParser::IOnnxParser>(options);
+#else
+        BOOST_LOG_TRIVIAL(fatal) << "Not built with Onnx parser support.";
+        return EXIT_FAILURE;
+#endif
+    }
+    else if (modelFormat.find("tensorflow") != std::string::npos)
+    {
+#if defined(ARMNN_TF_PARSER)
+        return MainImpl<armnnTfParser::ITfParser>(options);
+#else
+        BOOST_LOG_TRIVIAL(fatal) << "Not built with Tensorflow parser support.";
+        return EXIT_FAILURE;
+#endif
+    }
+    else if (modelFormat.find("tflite") != std::string::npos)
+    {
+#if defined(ARMNN_TF_LITE_PARSER)
+        return MainImpl<armnnTfLiteParser::ITfLiteParser>(options);
+#else
+        BOOST_LOG_TRIVIAL(fatal) << "Not built with TfLite parser support.";
+        return EXIT_FAILURE;
+#endif
+    }
+
+    BOOST_LOG_TRIVIAL(fatal) << "Unknown model format: '" << modelFormat <<
+                             "'. Please include 'armnn', 'caffe', 'tensorflow', 'tflite' or 'onnx'";
+    return EXIT_FAILURE;
+}
+
+} // anonymous namespace
+
+int main(int argc, const char* argv[])
+{
+    // Configures logging for both the ARMNN library and this test program, keeping the benchmark output readable.
+    armnn::ConfigureLogging(true, true, armnn::LogSeverity::Warning);
+
+    BenchmarkOptions options;
+    std::vector<std::string> computeDevices;
+    std::string inputNames;
+    std::string inputTensorShapes;
+    std::string outputNames;
+
+    const std::string backendsMessage = "Which device to run layers on by default. Possible choices: "
+                                      + armnn::BackendRegistryInstance().GetBackendIdsAsString();
+
+    po::options_description desc("Options");
+    try
+    {
+        desc.add_options()
+            ("help", "Display usage information")
+            ("model-format,f", po::value(&options.m_ModelFormat)->required(),
+             "armnn-binary, caffe-binary, caffe-text, onnx-binary, onnx-text, tflite-binary, tensorflow-binary or "
+             "tensorflow-text.")
+            ("model-path,m", po::value(&options.m_ModelPath)->required(), "Path to model file, e.g. .armnn, "
+             ".caffemodel, .prototxt, .tflite, .onnx")
+            ("compute,c", po::value<std::vector<std::string>>(&computeDevices)->multitoken()->required(),
+             backendsMessage.c_str())
+            ("input-name,i", po::value(&inputNames),
+             "Identifier of the input tensors in the network separated by comma.")
+            ("input-tensor-shape,s", po::value(&inputTensorShapes),
+             "The shape of the input tensors in the network as a flat array of integers separated by comma. "
+             "Several shapes can be passed separating them by semicolon. "
+             "This parameter is optional, depending on the network.")
+            ("output-name,o", po::value(&outputNames),
+             "Identifier of the output tensors in the network separated by comma.")
+            ("subgraph-number,x", po::value<size_t>(&options.m_SubgraphId)->default_value(0),
+             "Id of the subgraph to be executed. Defaults to 0")
+            ("warmup-iterations,w", po::value<unsigned int>(&options.m_WarmupIterations)->default_value(5),
+             "Number of inferences run by each thread before measuring.")
+            ("iterations,n", po::value<unsigned int>(&options.m_Iterations)->default_value(50),
+             "Number of measured inferences run by each thread.")
+            ("threads,t", po::value<unsigned int>(&options.m_NumThreads)->default_value(1),
+             "Number of client threads running inferences concurrently, to measure the sustained throughput.")
+            ("layer-breakdown,l", po::bool_switch(&options.m_LayerBreakdown)->default_value(false),
+             "Reports the time spent in each layer, measured with the profiler.")
+            ("json-file,j", po::value(&options.m_JsonFile),
+             "Path to a file to also write the results to, in JSON format.")
+            ("fp16-turbo-mode,h", po::bool_switch(&options.m_EnableFp16TurboMode)->default_value(false),
+             "If this option is enabled, FP32 layers, weights and biases will be converted to FP16 where the "
+             "backend supports it");
+    }
+    catch (const std::exception& e)
+    {
+        // Coverity points out that default_value(...) can throw a bad_lexical_cast,
+        // and that desc.add_options() can throw boost::io::too_few_args.
+        // They really won't in any of these cases.
+        BOOST_ASSERT_MSG(false, "Caught unexpected exception");
+        BOOST_LOG_TRIVIAL(fatal) << "Fatal internal error: " << e.what();
+        return EXIT_FAILURE;
+    }
+
+    // Parses the command-line.
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+
+        if (vm.count("help") || argc <= 1)
+        {
+            std::cout << "Benchmarks a neural network model: runs warmup then measured inferences on one or more "
+                         "threads, and reports latency percentiles, throughput, peak memory usage and optionally "
+                         "the time spent in each layer." << std::endl;
+            std::cout << std::endl;
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+
+        po::notify(vm);
+    }
+    catch (const po::error& e)
+    {
+        std::cerr << e.what() << std::endl << std::endl;
+        std::cerr << desc << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (options.m_Iterations == 0 || options.m_NumThreads == 0)
+    {
+        BOOST_LOG_TRIVIAL(fatal) << "iterations and threads must be greater than zero.";
+        return EXIT_FAILURE;
+    }
+
+    std::copy(computeDevices.begin(), computeDevices.end(), std::back_inserter(options.m_ComputeDevices));
+    options.m_InputNames = ParseStringList(inputNames, ",");
+    options.m_InputTensorShapes = ParseStringList(inputTensorShapes, ";");
+    options.m_OutputNames = ParseStringList(outputNames, ",");
+
+    if (!options.m_InputTensorShapes.empty() && options.m_InputTensorShapes.size() != options.m_InputNames.size())
+    {
+        BOOST_LOG_TRIVIAL(fatal) << "input-name and input-tensor-shape must have the same amount of elements.";
+        return EXIT_FAILURE;
+    }
+
+    return RunBenchmarkForFormat(options);
+}
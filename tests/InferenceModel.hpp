@@ -548,6 +548,11 @@ public:
         }
     }
 
+    armnn::NetworkId GetNetworkIdentifier() const
+    {
+        return m_NetworkIdentifier;
+    }
+
     const BindingPointInfo& GetInputBindingInfo(unsigned int inputIndex = 0u) const
     {
         CheckInputIndexIsValid(inputIndex);